@@ -2,11 +2,6 @@
 //
 //////////////////////////////////////////////////////////////////////
 
-// for avx2 memcpy
-#include <immintrin.h>
-#include <cstdint>
-#include <cstring>
-
 #include <any>
 #include <algorithm>
 #include <cassert>
@@ -30,64 +25,6 @@ std::wstring G2::ansiToWstr(const std::string& str)
 }
 
 
-void G2::avx2_memcpy(void* dst,const void* src,size_t size)
-{
-	// 작은 데이터는 memcpy로 처리 (성능 유리)
-	if(size < 1024)
-	{
-		std::memcpy(dst,src,size);
-		return;
-	}
-
-	uint8_t* d = reinterpret_cast<uint8_t*>(dst);
-	const uint8_t* s = reinterpret_cast<const uint8_t*>(src);
-
-	size_t simdSize = size & ~31ULL;  // 32바이트 배수로 정렬
-	size_t remain   = size &  31ULL;  // 나머지 바이트
-
-	// --- AVX2 복사 (32바이트 단위) ---
-	for(size_t i = 0; i < simdSize; i += 32)
-	{
-		__m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i));
-		_mm256_storeu_si256(reinterpret_cast<__m256i*>(d + i),v);
-	}
-
-	// --- 남은 바이트는 memcpy로 처리 ---
-	if(remain > 0)
-	{
-		std::memcpy(d + simdSize,s + simdSize,remain);
-	}
-}
-
-void G2::avx2_memset32(void* dst, int32_t val, size_t count)
-{
-    int32_t* d = reinterpret_cast<int32_t*>(dst);
-
-    if (count * sizeof(int32_t) < 1024)
-    {
-        for (size_t i = 0; i < count; ++i)
-            d[i] = val;
-        return;
-    }
-
-    size_t simdCount = count & ~7ULL;  // 8개씩 처리 (32B)
-    size_t remain    = count & 7ULL;
-
-    __m256i vec = _mm256_set1_epi32(val);  // 8 x int32_t
-
-    for (size_t i = 0; i < simdCount; i += 8)
-    {
-        _mm256_storeu_si256(reinterpret_cast<__m256i*>(d + i), vec);
-    }
-
-    for (size_t i = simdCount; i < count; ++i)
-    {
-        d[i] = val;
-    }
-}
-
-
-
 HRESULT G2::DXCompileShaderFromFile(const std::string& szFileName, const std::string& szEntryPoint, const std::string& szShaderModel, ID3DBlob** ppBlobOut)
 {
 	HRESULT hr = S_OK;
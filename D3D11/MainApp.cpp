@@ -25,14 +25,11 @@ int MainApp::Init()
 	auto d3dContext = std::any_cast<ID3D11DeviceContext*>(IG2GraphicsD3D::getInstance()->GetContext());
 	HRESULT hr = S_OK;
 	
-	auto spineInst = make_unique<SceneSpine>();
-	if(spineInst)
-	{
-		if(SUCCEEDED(spineInst->Init("assets/spine/raptor/raptor-pma.atlas", "assets/spine/raptor/raptor-pro.json")))
-		{
-			m_spine = std::move(spineInst);
-		}
-	}
+	// atlases and skeleton data shared by all scenes.
+	m_spineCache = make_unique<spine::SkeletonDataCache>(&m_spineTextureLoader);
+	// the rig is parsed and its pages decoded on the loader threads. the scene is created in Update() once the textures are up.
+	m_spineLoader = make_unique<spine::AsyncLoader>(&m_spineTextureLoader);
+	m_spineLoad = m_spineLoader->load("assets/spine/raptor/raptor-pma.atlas", "assets/spine/raptor/raptor-pro.json");
 
 	if(FAILED(hr))
 		return hr;
@@ -90,7 +87,17 @@ int MainApp::Destroy()
 	G2::SAFE_RELEASE(m_cnstWorld);
 	G2::SAFE_RELEASE(m_cnstView	);
 	G2::SAFE_RELEASE(m_cnstProj	);
+	// scenes release their entries first, then the cache deletes the atlases and their textures.
 	m_spine = nullptr;
+	// the loader finishes a pending load before it stops, the cache then takes the result.
+	m_spineLoader = nullptr;
+	if(m_spineLoad)
+	{
+		if(auto entry = m_spineCache->acquire(*m_spineLoad))
+			m_spineCache->release(entry);
+		G2::SAFE_DELETE(m_spineLoad);
+	}
+	m_spineCache = nullptr;
 	return S_OK;
 }
 
@@ -98,6 +105,7 @@ int MainApp::Update()
 {
 	mTimer.Tick();
 	auto t = mTimer.DeltaTime();
+	UpdateSpineLoad();
 	if(m_spine)
 	{
 		XMMATRIX mvp = m_mtWorld * m_mtView * m_mtProj;
@@ -108,6 +116,25 @@ int MainApp::Update()
 }
 
 
+void MainApp::UpdateSpineLoad()
+{
+	if(!m_spineLoad)
+		return;
+	// uploads the decoded pages on this thread, which owns the device.
+	m_spineLoader->update();
+	if(!m_spineLoad->isDone())
+		return;
+
+	// scenes showing the same rig share one parse of it.
+	auto entry = m_spineCache->acquire(*m_spineLoad);
+	G2::SAFE_DELETE(m_spineLoad);
+	if(!entry)
+		return;
+	auto spineInst = make_unique<SceneSpine>();
+	if(SUCCEEDED(spineInst->Init(*m_spineCache, entry)))
+		m_spine = std::move(spineInst);
+}
+
 int MainApp::Render()
 {
 	auto d3dDevice  = std::any_cast<ID3D11Device*>(IG2GraphicsD3D::getInstance()->GetDevice());
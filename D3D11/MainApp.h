@@ -22,6 +22,11 @@ protected:
 	XMMATRIX					m_mtWorld			{};
 	GameTimer					mTimer				;
 
+	// the cached textures are released with the cache, before the device goes away.
+	SpineTextureLoader			m_spineTextureLoader;
+	unique_ptr<spine::SkeletonDataCache>	m_spineCache	{};
+	unique_ptr<spine::AsyncLoader>	m_spineLoader	{};
+	spine::AsyncLoad*			m_spineLoad			{};	// pending until the scene is created from it
 	unique_ptr<SceneSpine>		m_spine				{};
 public:
 	MainApp();
@@ -30,6 +35,8 @@ public:
 	virtual int Destroy();
 	virtual int Update();
 	virtual int Render();
+protected:
+	void	UpdateSpineLoad();
 };
 
 #endif
@@ -1,5 +1,7 @@
 ﻿#pragma warning(disable: 4081 4267)
 
+#include <cstddef>
+#include <cstring>
 #include <filesystem>
 #include <any>
 #include <Windows.h>
@@ -20,81 +22,6 @@ namespace spine {
 	}
 }
 
-int VtxSequenceSpine::resourceBinding(int order, void* attachment, ESPINE_ATTACHMENT_TYPE attachmentType, size_t vertexCount, size_t indexCount /*=0*/)
-{
-	HRESULT hr = S_OK;
-	auto d3dDevice  = std::any_cast<ID3D11Device*>(IG2GraphicsD3D::getInstance()->GetDevice());
-	if(!d3dDevice)
-		return E_FAIL;
-
-	if(0 >= vertexCount)
-		return E_FAIL;
-
-	this->drawOrder= order;
-	this->meshType = attachmentType;
-	this->countVtx = vertexCount;
-	this->countIdx = indexCount;
-	// vertex buffer
-	{
-		// position
-		D3D11_BUFFER_DESC ibDesc ={};
-		ibDesc.Usage = D3D11_USAGE_DYNAMIC;
-		ibDesc.ByteWidth = (UINT)vertexCount * sizeof(XMFLOAT2);
-		ibDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
-		ibDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
-		hr = d3dDevice->CreateBuffer(&ibDesc,nullptr,&bufPos);
-		if(FAILED(hr))
-			return hr;
-		// texture coord
-		ibDesc.ByteWidth = (UINT)vertexCount * sizeof(XMFLOAT2);
-		hr = d3dDevice->CreateBuffer(&ibDesc,nullptr,&bufTex);
-		if(FAILED(hr))
-			return hr;
-		// diffuse
-		ibDesc.ByteWidth = (UINT)vertexCount * sizeof(uint32_t);
-		hr = d3dDevice->CreateBuffer(&ibDesc,nullptr,&bufDif);
-		if(FAILED(hr))
-			return hr;
-
-		primitve = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP;
-	}
-	// index buffer
-	if(indexCount)
-	{
-		D3D11_BUFFER_DESC ibDesc ={};
-		ibDesc.Usage = D3D11_USAGE_DYNAMIC;
-		ibDesc.ByteWidth = (UINT)indexCount * sizeof(uint16_t);
-		ibDesc.BindFlags = D3D11_BIND_INDEX_BUFFER;
-		ibDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
-		hr = d3dDevice->CreateBuffer(&ibDesc,nullptr,&bufIdx);
-		if(FAILED(hr))
-			return hr;
-
-		primitve = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
-	}
-	return S_OK;
-}
-
-int VtxSequenceSpine::draw(ID3D11DeviceContext* d3dContext, ID3D11ShaderResourceView* texSRV)
-{
-	ID3D11Buffer* buffers[] ={ bufPos, bufDif, bufTex};
-	UINT strides[] ={sizeof(XMFLOAT2), sizeof(uint32_t), sizeof(XMFLOAT2)};
-	UINT offsets[] ={0,0,0};
-	d3dContext->IASetVertexBuffers(0, 3, buffers, strides, offsets);
-	d3dContext->IASetPrimitiveTopology(primitve);
-	d3dContext->PSSetShaderResources(0,1,&texSRV);
-	if(countIdx)
-	{
-		d3dContext->IASetIndexBuffer(bufIdx, DXGI_FORMAT_R16_UINT, 0);
-		d3dContext->DrawIndexed(countIdx, 0, 0);
-	}
-	else
-	{
-		d3dContext->Draw(countVtx, 0);
-	}
-	return 0;
-}
-
 SceneSpine::SceneSpine()
 {
 }
@@ -104,8 +31,11 @@ SceneSpine::~SceneSpine()
 	Destroy();
 }
 
-int SceneSpine::Init(const std::string& str_atlas, const std::string& str_skel)
+int SceneSpine::Init(SkeletonDataCache& cache, SkeletonDataCache::Entry* entry)
 {
+	// released by Destroy() even if creating the device objects fails.
+	m_spineCache = &cache;
+	m_spineData = entry;
 	HRESULT hr = S_OK;
 	auto d3dDevice  = std::any_cast<ID3D11Device*>(IG2GraphicsD3D::getInstance()->GetDevice());
 	auto d3dContext = std::any_cast<ID3D11DeviceContext*>(IG2GraphicsD3D::getInstance()->GetContext());
@@ -126,9 +56,9 @@ int SceneSpine::Init(const std::string& str_atlas, const std::string& str_skel)
 	// 1.3 create vertexLayout
 	D3D11_INPUT_ELEMENT_DESC layout[] =
 	{
-		{ "POSITION", 0, DXGI_FORMAT_R32G32_FLOAT   , 0, 0 , D3D11_INPUT_PER_VERTEX_DATA, 0 },
-		{ "COLOR"   , 0, DXGI_FORMAT_R8G8B8A8_UNORM , 1, 0 , D3D11_INPUT_PER_VERTEX_DATA, 0 },
-		{ "TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT   , 2, 0 , D3D11_INPUT_PER_VERTEX_DATA, 0 },
+		{ "POSITION", 0, DXGI_FORMAT_R32G32_FLOAT   , 0, offsetof(VtxSpine, p), D3D11_INPUT_PER_VERTEX_DATA, 0 },
+		{ "COLOR"   , 0, DXGI_FORMAT_R8G8B8A8_UNORM , 0, offsetof(VtxSpine, d), D3D11_INPUT_PER_VERTEX_DATA, 0 },
+		{ "TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT   , 0, offsetof(VtxSpine, t), D3D11_INPUT_PER_VERTEX_DATA, 0 },
 	};
 	UINT numElements = ARRAYSIZE(layout);
 	hr = d3dDevice->CreateInputLayout(layout, numElements, pBlob->GetBufferPointer(), pBlob->GetBufferSize(), &m_vtxLayout);
@@ -177,19 +107,30 @@ int SceneSpine::Init(const std::string& str_atlas, const std::string& str_skel)
 		}
 	}
 	{
-		D3D11_BLEND_DESC blendDesc ={};
-		blendDesc.RenderTarget[0].BlendEnable = TRUE;
-		blendDesc.RenderTarget[0].SrcBlend = D3D11_BLEND_SRC_ALPHA;
-		blendDesc.RenderTarget[0].DestBlend = D3D11_BLEND_INV_SRC_ALPHA;
-		blendDesc.RenderTarget[0].BlendOp = D3D11_BLEND_OP_ADD;
-		blendDesc.RenderTarget[0].SrcBlendAlpha = D3D11_BLEND_ONE;
-		blendDesc.RenderTarget[0].DestBlendAlpha = D3D11_BLEND_ZERO;
-		blendDesc.RenderTarget[0].BlendOpAlpha = D3D11_BLEND_OP_ADD;
-		blendDesc.RenderTarget[0].RenderTargetWriteMask = D3D11_COLOR_WRITE_ENABLE_ALL;
-		hr = d3dDevice->CreateBlendState(&blendDesc,&m_stateBlend);
-		if(FAILED(hr))
+		// source and destination color per spine::BlendMode: normal, additive, multiply, screen
+		const D3D11_BLEND blendFunc[4][2] =
 		{
-			return hr;
+			{ D3D11_BLEND_SRC_ALPHA , D3D11_BLEND_INV_SRC_ALPHA },
+			{ D3D11_BLEND_SRC_ALPHA , D3D11_BLEND_ONE           },
+			{ D3D11_BLEND_DEST_COLOR, D3D11_BLEND_INV_SRC_ALPHA },
+			{ D3D11_BLEND_ONE       , D3D11_BLEND_INV_SRC_COLOR },
+		};
+		for(int i = 0; i < ARRAYSIZE(m_stateBlend); ++i)
+		{
+			D3D11_BLEND_DESC blendDesc ={};
+			blendDesc.RenderTarget[0].BlendEnable = TRUE;
+			blendDesc.RenderTarget[0].SrcBlend = blendFunc[i][0];
+			blendDesc.RenderTarget[0].DestBlend = blendFunc[i][1];
+			blendDesc.RenderTarget[0].BlendOp = D3D11_BLEND_OP_ADD;
+			blendDesc.RenderTarget[0].SrcBlendAlpha = D3D11_BLEND_ONE;
+			blendDesc.RenderTarget[0].DestBlendAlpha = D3D11_BLEND_ZERO;
+			blendDesc.RenderTarget[0].BlendOpAlpha = D3D11_BLEND_OP_ADD;
+			blendDesc.RenderTarget[0].RenderTargetWriteMask = D3D11_COLOR_WRITE_ENABLE_ALL;
+			hr = d3dDevice->CreateBlendState(&blendDesc,&m_stateBlend[i]);
+			if(FAILED(hr))
+			{
+				return hr;
+			}
 		}
 	}
 	{
@@ -216,7 +157,7 @@ int SceneSpine::Init(const std::string& str_atlas, const std::string& str_skel)
 	if (FAILED(hr))
 		return hr;
 
-	InitSpine(str_atlas, str_skel);
+	InitSpine();
 
 	return S_OK;
 }
@@ -227,22 +168,28 @@ int SceneSpine::Destroy()
 	if(!m_spineAnimations.empty())
 		m_spineAnimations.clear();
 
-	for(auto& [key, sqc] :  m_spineSequence)
-	{
-		delete sqc;
-	}
-	m_spineSequence.clear();
-	
+	G2::SAFE_DELETE(	m_spineGeometry		);
+	G2::SAFE_RELEASE(	m_spineVtxBuf		);
+	G2::SAFE_RELEASE(	m_spineIdxBuf		);
+	m_spineVtxCapacity	= {};
+	m_spineIdxCapacity	= {};
+
 	G2::SAFE_DELETE(	m_spineSkeleton		);
 	G2::SAFE_DELETE(	m_spineAniState		);
-	G2::SAFE_DELETE(	m_spineSkeletonData	);
-	G2::SAFE_DELETE(	m_spineAtlas		);
+	// data and texture are owned by the cache
+	if(m_spineData)
+		m_spineCache->release(m_spineData);
+	m_spineData			= {};
+	m_spineCache		= {};
+	m_spineSkeletonData	= {};
+	m_spineAtlas		= {};
+	m_spineTexture		= {};
 
-	G2::SAFE_RELEASE(	m_spineTexture		);
 	G2::SAFE_RELEASE(	m_sampLinear		);
 	G2::SAFE_RELEASE(	m_cnstMVP			);
 	G2::SAFE_RELEASE(	m_stateRater		);
-	G2::SAFE_RELEASE(	m_stateBlend		);
+	for(auto& stateBlend : m_stateBlend)
+		G2::SAFE_RELEASE(stateBlend);
 	G2::SAFE_RELEASE(	m_stateDepthWrite	);
 	G2::SAFE_RELEASE(	m_shaderVtx			);
 	G2::SAFE_RELEASE(	m_shaderPxl			);
@@ -263,11 +210,8 @@ int SceneSpine::Update(float deltaTime)
 	// Calculate the new pose
 	m_spineSkeleton->updateWorldTransform(spine::Physics_Update);
 
-	// update spine sequence
-	UpdateSpineSequence();
-	// update vertex
-	UpdateSpineBuffer();
-	return S_OK;
+	// build and upload the frame geometry
+	return UpdateSpineBuffer();
 }
 
 int SceneSpine::Render()
@@ -279,7 +223,6 @@ int SceneSpine::Render()
 	d3dContext->RSSetState(m_stateRater);
 	float blendFactor[4] ={0,0,0,0};
 	UINT sampleMask = 0xffffffff;
-	d3dContext->OMSetBlendState(m_stateBlend,blendFactor,sampleMask);
 	d3dContext->OMSetDepthStencilState(m_stateDepthWrite,0);
 
 	// 1. Update constant value
@@ -298,11 +241,26 @@ int SceneSpine::Render()
 	// 6. set the sampler state
 	d3dContext->PSSetSamplers(0,1,&m_sampLinear);
 
-	for(auto [drawOrder, curSqc] : m_spineSequence)
+	if(!m_spineGeometry || !m_spineGeometry->getIndexCount())
+		return S_OK;
+
+	// 7. one vertex and index buffer for the whole skeleton, a draw per texture and blend mode
+	UINT stride = sizeof(VtxSpine);
+	UINT offset = 0;
+	d3dContext->IASetVertexBuffers(0, 1, &m_spineVtxBuf, &stride, &offset);
+	d3dContext->IASetIndexBuffer(m_spineIdxBuf, DXGI_FORMAT_R16_UINT, 0);
+	d3dContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+	auto& ranges = m_spineGeometry->getDrawRanges();
+	for(int i = 0; i < ranges.size(); ++i)
 	{
-		curSqc->draw(d3dContext, m_spineTexture);
+		const spine::DrawRange& range = ranges[i];
+		// regions keep a null texture while their page is uploaded later
+		auto* texSRV = range.texture ? static_cast<ID3D11ShaderResourceView*>(range.texture) : m_spineTexture;
+		d3dContext->PSSetShaderResources(0,1,&texSRV);
+		d3dContext->OMSetBlendState(m_stateBlend[range.blendMode],blendFactor,sampleMask);
+		d3dContext->DrawIndexed(range.indexCount, range.indexStart, range.vertexStart);
 	}
-	
+
 	return S_OK;
 }
 
@@ -311,24 +269,18 @@ void SceneSpine::SetMVP(const XMMATRIX& tmMVP)
 	m_tmMVP = tmMVP;
 }
 
-void SceneSpine::InitSpine(const std::string& str_atlas, const std::string& str_skel)
+void SceneSpine::InitSpine()
 {
 	Bone::setYDown(false);
 
-	std::filesystem::path str_path(str_skel);
-	m_spineAtlas = new Atlas(str_atlas.c_str(),this);
-	if(str_path.extension().generic_string().compare("json"))
-	{
-		SkeletonJson skl(m_spineAtlas);
-		m_spineSkeletonData = skl.readSkeletonDataFile(str_skel.c_str());
-	}
-	else
-	{
-		SkeletonBinary skl(m_spineAtlas);
-		m_spineSkeletonData = skl.readSkeletonDataFile(str_skel.c_str());
-	}
+	if(!m_spineData)
+		return;
+	m_spineAtlas = m_spineData->getAtlas();
+	m_spineSkeletonData = m_spineData->getSkeletonData();
+	m_spineTexture = static_cast<ID3D11ShaderResourceView*>(m_spineAtlas->getPages()[0]->texture);
 
 	m_spineSkeleton = new Skeleton(m_spineSkeletonData);
+	m_spineGeometry = new SkeletonGeometry(VertexLayout(sizeof(VtxSpine), offsetof(VtxSpine, p), offsetof(VtxSpine, t), offsetof(VtxSpine, d), -1, VertexColorFormat_ABGR));
 	m_spineSkeleton->setPosition(0.0F, -300.0F);
 	m_spineSkeleton->setScaleX(0.6f);
 	m_spineSkeleton->setScaleY(0.6f);
@@ -350,251 +302,98 @@ void SceneSpine::InitSpine(const std::string& str_atlas, const std::string& str_
 	m_spineAniState->addAnimation(0,"walk",true, 2.1F);
 }
 
-void SceneSpine::UpdateSpineSequence()
+int SceneSpine::UpdateSpineBuffer()
 {
-	auto drawOrder = m_spineSkeleton->getDrawOrder();
-	for(size_t i = 0; i < drawOrder.size(); ++i)
-	{
-		spine::Slot* slot = drawOrder[i];
-		spine::Attachment* attachment = slot->getAttachment();
-		if(!attachment)
-			continue;
-		if(attachment->getRTTI().isExactly(spine::MeshAttachment::rtti))
-		{
-			SetupSpineSequence(i, attachment, VtxSequenceSpine::ESPINE_MESH_ATTACH);
-		}
-		else if(attachment->getRTTI().isExactly(spine::RegionAttachment::rtti))
-		{
-			SetupSpineSequence(i, attachment, VtxSequenceSpine::ESPINE_MESH_REGION);
-		}
-	}
-}
+	if(!m_spineGeometry)
+		return E_FAIL;
+	m_spineGeometry->build(*m_spineSkeleton);
+	size_t vertexCount = m_spineGeometry->getVertexCount();
+	size_t indexCount  = m_spineGeometry->getIndexCount();
+	if(!indexCount)
+		return S_OK;
 
-void SceneSpine::UpdateSpineBuffer()
-{
+	HRESULT hr = S_OK;
+	auto d3dDevice  = std::any_cast<ID3D11Device*>(IG2GraphicsD3D::getInstance()->GetDevice());
 	auto d3dContext = std::any_cast<ID3D11DeviceContext*>(IG2GraphicsD3D::getInstance()->GetContext());
-	for(auto [drawOrder, curSqc] : m_spineSequence)
-	{
-		spine::Slot* slot = m_spineSkeleton->getDrawOrder().operator[](drawOrder);
-		spine::Attachment* attachment = slot->getAttachment();
-		if(curSqc->meshType == VtxSequenceSpine::ESPINE_ATTACHMENT_TYPE::ESPINE_MESH_ATTACH)
-		{
-			auto* attm = static_cast<spine::MeshAttachment*>(attachment);
-			auto* mesh = static_cast<spine::MeshAttachment*>(attachment);
-
-			// 색상
-			spine::Color c = slot->getColor();
-			c.a *= slot->getColor().a;
-			c.r *= slot->getColor().r;
-			c.g *= slot->getColor().g;
-			c.b *= slot->getColor().b;
-
-			spine::Color mColor = mesh->getColor();
-			c.a *= mColor.a; c.r *= mColor.r; c.g *= mColor.g; c.b *= mColor.b;
-
-			// 색상
-			uint32_t rgba =
-				(uint32_t(c.a * 255) << 24) |
-				(uint32_t(c.b * 255) << 16) |
-				(uint32_t(c.g * 255) << 8)  |
-				(uint32_t(c.r * 255) << 0);
-
-			// 텍스처
-			spine::TextureRegion* texRegion = mesh->getRegion();
-			if(!texRegion) continue;
-
-			auto* atlasRegion = reinterpret_cast<spine::AtlasRegion*>(texRegion);
-			auto* texSRV = reinterpret_cast<ID3D11ShaderResourceView*>(atlasRegion->page->texture);
-			if(!texSRV) continue;
-
-			// 위치 변환 및 복사
-			{
-				size_t bufSize = mesh->getWorldVerticesLength();
-				D3D11_MAPPED_SUBRESOURCE mapped ={};
-				if(SUCCEEDED(d3dContext->Map(curSqc->bufPos,0,D3D11_MAP_WRITE_DISCARD,0,&mapped))) {
-					float* ptr = (float*)mapped.pData;
-					mesh->computeWorldVertices(*slot,0, bufSize, ptr, 0, 2);
-					d3dContext->Unmap(curSqc->bufPos,0);
-				}
-			}
-			// color
-			{
-				size_t vtxCount = mesh->getWorldVerticesLength()/2;
-				D3D11_MAPPED_SUBRESOURCE mapped ={};
-				if(SUCCEEDED(d3dContext->Map(curSqc->bufDif,0,D3D11_MAP_WRITE_DISCARD,0,&mapped))) {
-					G2::avx2_memset32((uint32_t*)mapped.pData, rgba, vtxCount);
-					d3dContext->Unmap(curSqc->bufDif,0);
-				}
-			}
-			// 텍스처 좌표 복사
-			{
-				const float* uvs = mesh->getUVs().buffer();
-				auto bufSize = mesh->getUVs().size();
-				D3D11_MAPPED_SUBRESOURCE mapped ={};
-				if(SUCCEEDED(d3dContext->Map(curSqc->bufTex,0,D3D11_MAP_WRITE_DISCARD,0,&mapped))) {
-					G2::avx2_memcpy(mapped.pData,uvs,sizeof(float) * bufSize);
-					d3dContext->Unmap(curSqc->bufTex,0);
-				}
-			}
-			// index buffer
-			const uint16_t* indices = mesh->getTriangles().buffer();
-			UINT indexCount = mesh->getTriangles().size();
-			{
-				D3D11_MAPPED_SUBRESOURCE mapped ={};
-				if(SUCCEEDED(d3dContext->Map(curSqc->bufIdx,0,D3D11_MAP_WRITE_DISCARD,0,&mapped))) {
-					G2::avx2_memcpy(mapped.pData,indices,sizeof(uint16_t) * indexCount);
-					d3dContext->Unmap(curSqc->bufIdx,0);
-				}
-			}
-		}
-		else if(curSqc->meshType == VtxSequenceSpine::ESPINE_ATTACHMENT_TYPE::ESPINE_MESH_REGION)
-		{
-			auto* region = static_cast<spine::RegionAttachment*>(attachment);
-
-			// RegionAttachment → TextureRegion
-			spine::TextureRegion* texRegion = region->getRegion();
-			if(!texRegion)
-				continue;
-
-			// TextureRegion → AtlasRegion
-			auto* atlasRegion = reinterpret_cast<spine::AtlasRegion*>(texRegion);
-
-			// AtlasPage → rendererObject
-			auto* page = atlasRegion->page;
-			auto* texSRV = reinterpret_cast<ID3D11ShaderResourceView*>(page->texture);
-			if(!texSRV)
-				continue;
-
-			// 색상 계산
-			spine::Color c = m_spineSkeleton->getColor();
-			c.a *= slot->getColor().a;
-			c.r *= slot->getColor().r;
-			c.g *= slot->getColor().g;
-			c.b *= slot->getColor().b;
-
-			spine::Color rColor = region->getColor();
-			c.a *= rColor.a;
-			c.r *= rColor.r;
-			c.g *= rColor.g;
-			c.b *= rColor.b;
-
-			uint32_t rgba =
-				(uint32_t(c.a * 255) << 24) |
-				(uint32_t(c.r * 255) << 16) |
-				(uint32_t(c.g * 255) << 8)  |
-				(uint32_t(c.b * 255) << 0);
-
-			// 8. 렌더링 정점 복사
-			// 위치 변환 및 복사
-			{
-				size_t vtxCount = 8;
-				D3D11_MAPPED_SUBRESOURCE mapped ={};
-				if(SUCCEEDED(d3dContext->Map(curSqc->bufPos,0,D3D11_MAP_WRITE_DISCARD,0,&mapped))) {
-					float* ptr = (float*)mapped.pData;
-					region->computeWorldVertices(*slot,ptr,0,2);
-					d3dContext->Unmap(curSqc->bufPos,0);
-				}
-			}
-			// 텍스처 좌표 복사
-			{
-				D3D11_MAPPED_SUBRESOURCE mapped ={};
-				const float* uvs = region->getUVs().buffer();
-				auto uvSize = region->getUVs().size();
-				if(SUCCEEDED(d3dContext->Map(curSqc->bufTex,0,D3D11_MAP_WRITE_DISCARD,0,&mapped))) {
-					float* ptr = (float*)mapped.pData;
-					G2::avx2_memcpy(mapped.pData,uvs,sizeof(float) * uvSize);
-					d3dContext->Unmap(curSqc->bufTex,0);
-				}
-			}
-			// color
-			{
-				size_t vtxCount = 4;
-				D3D11_MAPPED_SUBRESOURCE mapped ={};
-				if(SUCCEEDED(d3dContext->Map(curSqc->bufDif,0,D3D11_MAP_WRITE_DISCARD,0,&mapped))) {
-					uint32_t* ptr = (uint32_t*)mapped.pData;
-					G2::avx2_memset32(ptr,rgba,vtxCount);
-					d3dContext->Unmap(curSqc->bufDif,0);
-				}
-			}
-		}
-	}
-}
 
-void SceneSpine::SetupSpineSequence(int order, void* attachment, VtxSequenceSpine::ESPINE_ATTACHMENT_TYPE attachmentType)
-{
-	size_t vertexCount = 4;
-	UINT   indexCount  = 0;
-	VtxSequenceSpine* sequenceCur{};
-	auto itr = m_spineSequence.find(order);
-	if(itr != m_spineSequence.end())
+	// buffers only grow, with some room so attachment changes don't recreate them every frame.
+	if(vertexCount > m_spineVtxCapacity)
 	{
-		sequenceCur = itr->second;
-	}
-
-	// 메시 타입 체크.
-	if(VtxSequenceSpine::ESPINE_ATTACHMENT_TYPE::ESPINE_MESH_ATTACH == attachmentType)
-	{
-		auto* mesh = static_cast<spine::MeshAttachment*>(attachment);
-		vertexCount = mesh->getWorldVerticesLength()/2;
-		indexCount = mesh->getTriangles().size();
-	}
-	else if(VtxSequenceSpine::ESPINE_ATTACHMENT_TYPE::ESPINE_MESH_REGION == attachmentType)
-	{
-		vertexCount = 4;
-		indexCount  = 0;
+		G2::SAFE_RELEASE(m_spineVtxBuf);
+		m_spineVtxCapacity = 0;
+		size_t capacity = vertexCount + vertexCount / 2;
+		D3D11_BUFFER_DESC vbDesc ={};
+		vbDesc.Usage = D3D11_USAGE_DYNAMIC;
+		vbDesc.ByteWidth = (UINT)(capacity * sizeof(VtxSpine));
+		vbDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+		vbDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+		hr = d3dDevice->CreateBuffer(&vbDesc,nullptr,&m_spineVtxBuf);
+		if(FAILED(hr))
+			return hr;
+		m_spineVtxCapacity = capacity;
 	}
-	else
+	if(indexCount > m_spineIdxCapacity)
 	{
-		// 존재하는데 어느 타입도 아니라면 삭제
-		if(sequenceCur)
-		{
-			delete sequenceCur;
-		}
-		m_spineSequence.erase(itr);
+		G2::SAFE_RELEASE(m_spineIdxBuf);
+		m_spineIdxCapacity = 0;
+		size_t capacity = indexCount + indexCount / 2;
+		D3D11_BUFFER_DESC ibDesc ={};
+		ibDesc.Usage = D3D11_USAGE_DYNAMIC;
+		ibDesc.ByteWidth = (UINT)(capacity * sizeof(uint16_t));
+		ibDesc.BindFlags = D3D11_BIND_INDEX_BUFFER;
+		ibDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+		hr = d3dDevice->CreateBuffer(&ibDesc,nullptr,&m_spineIdxBuf);
+		if(FAILED(hr))
+			return hr;
+		m_spineIdxCapacity = capacity;
 	}
 
-	// 시퀀스 생성
-	if(!sequenceCur)
-	{
-		sequenceCur = new VtxSequenceSpine;
-		m_spineSequence.emplace(order,sequenceCur);
-	}
-	else if(   sequenceCur->meshType == attachmentType				// 같은 메시 타입
-			&& sequenceCur->countVtx == vertexCount					// 같은 버텍스 크기
-			&& sequenceCur->countIdx == indexCount					// 같은 인덱스 크기
-	)
-	{
-		// 동일 정보라 할 일이 없음.
-		return;
-	}
-	else
-	{
-		// 삭제만
-		delete sequenceCur;
-		sequenceCur = new VtxSequenceSpine;
-		m_spineSequence[order] = sequenceCur;
-	}
-	// 새로운 버텍스 인덱스 생성
-	sequenceCur->resourceBinding(order, attachment, attachmentType, vertexCount, indexCount);
+	// one map per buffer for the whole skeleton
+	D3D11_MAPPED_SUBRESOURCE mapped ={};
+	hr = d3dContext->Map(m_spineVtxBuf,0,D3D11_MAP_WRITE_DISCARD,0,&mapped);
+	if(FAILED(hr))
+		return hr;
+	std::memcpy(mapped.pData, m_spineGeometry->getVertices(), vertexCount * sizeof(VtxSpine));
+	d3dContext->Unmap(m_spineVtxBuf,0);
+
+	hr = d3dContext->Map(m_spineIdxBuf,0,D3D11_MAP_WRITE_DISCARD,0,&mapped);
+	if(FAILED(hr))
+		return hr;
+	std::memcpy(mapped.pData, m_spineGeometry->getIndices(), indexCount * sizeof(uint16_t));
+	d3dContext->Unmap(m_spineIdxBuf,0);
+	return S_OK;
+}
+
+void* SpineTextureLoader::decode(spine::AtlasPage& page,const spine::String& path) {
+	// worker thread when loaded through an AsyncLoader: only read the image file, WIC decoding needs the device context.
+	int length = 0;
+	char* data = SpineExtension::readFile(path, &length);
+	if(!data)
+		return nullptr;
+	auto* image = new std::vector<uint8_t>(data, data + length);
+	SpineExtension::free(data, __FILE__, __LINE__);
+	return image;
 }
 
-void SceneSpine::load(spine::AtlasPage& page,const spine::String& path) {
-	auto fileName = path.buffer();
+void SpineTextureLoader::upload(spine::AtlasPage& page,const spine::String& path, void* decoded) {
+	auto* image = static_cast<std::vector<uint8_t>*>(decoded);
+	if(!image)
+		return;
 	HRESULT hr = S_OK;
 	auto d3dDevice  = std::any_cast<ID3D11Device*>(IG2GraphicsD3D::getInstance()->GetDevice());
 	auto d3dContext = std::any_cast<ID3D11DeviceContext*>(IG2GraphicsD3D::getInstance()->GetContext());
 	ID3D11Resource*				textureRsc{};
 	ID3D11ShaderResourceView*	textureView{};
-	auto wstr_file = G2::ansiToWstr(fileName);
-	hr  = DirectX::CreateWICTextureFromFile(d3dDevice, d3dContext, wstr_file.c_str(), &textureRsc, &textureView);
+	hr  = DirectX::CreateWICTextureFromMemory(d3dDevice, d3dContext, image->data(), image->size(), &textureRsc, &textureView);
+	delete image;
+	// the view keeps the resource alive
+	G2::SAFE_RELEASE(textureRsc);
 	if(SUCCEEDED(hr))
-	{
-		m_spineTexture = textureView;
-		page.texture = m_spineTexture;
-	}
+		page.texture = textureView;
 }
 
-void SceneSpine::unload(void* texture) {
-	texture = nullptr;
+void SpineTextureLoader::unload(void* texture) {
+	auto* textureView = static_cast<ID3D11ShaderResourceView*>(texture);
+	G2::SAFE_RELEASE(textureView);
 }
 
@@ -13,67 +13,62 @@ using namespace std;
 using namespace DirectX;
 
 
-struct VtxSequenceSpine
+// interleaved vertex written by spine::SkeletonGeometry, matches the input layout of spine.fx
+struct VtxSpine
 {
-	enum ESPINE_ATTACHMENT_TYPE { ESPINE_MESH_ATTACH=1, ESPINE_MESH_REGION, };
+	XMFLOAT2	p;
+	uint32_t	d;
+	XMFLOAT2	t;
+};
 
-	int				drawOrder	{};
-	int				meshType	{};
-	ID3D11Buffer*	bufPos		{};
-	ID3D11Buffer*	bufTex		{};
-	ID3D11Buffer*	bufDif		{};
-	ID3D11Buffer*	bufIdx		{};
-	size_t			countVtx	{};
-	size_t			countIdx	{};
-	D3D_PRIMITIVE_TOPOLOGY	primitve {D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP};
-	~VtxSequenceSpine()	{
-		G2::SAFE_RELEASE(bufPos);
-		G2::SAFE_RELEASE(bufTex);
-		G2::SAFE_RELEASE(bufDif);
-		G2::SAFE_RELEASE(bufIdx);
-		countVtx = {};
-		countIdx = {};
-	}
-	int resourceBinding(int order, void* attachment, ESPINE_ATTACHMENT_TYPE attachmentType, size_t vertexCount, size_t indexCount =0);
-	int draw(ID3D11DeviceContext* d3dContext, ID3D11ShaderResourceView* texSRV);
+// creates the atlas textures on the device. decode() only reads the image file, so it may run on a loader thread.
+class SpineTextureLoader : public spine::DeferredTextureLoader
+{
+public:
+	void* decode(spine::AtlasPage& page,const spine::String& path) override;
+	void  upload(spine::AtlasPage& page,const spine::String& path, void* decoded) override;
+	void  unload(void* texture) override;
 };
 
-class SceneSpine : public spine::TextureLoader
+class SceneSpine
 {
 protected:
 	ID3D11Buffer*				m_cnstMVP			{};
 	XMMATRIX					m_tmMVP				= XMMatrixIdentity();
 	ID3D11RasterizerState*		m_stateRater		{};
-	ID3D11BlendState*			m_stateBlend		{};
+	ID3D11BlendState*			m_stateBlend[4]		{};	// indexed by spine::BlendMode
 	ID3D11DepthStencilState*	m_stateDepthWrite	{};
 	ID3D11VertexShader*			m_shaderVtx			{};
 	ID3D11PixelShader*			m_shaderPxl			{};
 	ID3D11InputLayout*			m_vtxLayout			{};
 
 	std::vector<std::string>	m_spineAnimations	;
-	map<int, VtxSequenceSpine*>	m_spineSequence		;
+	spine::SkeletonGeometry*	m_spineGeometry		{};
+	ID3D11Buffer*				m_spineVtxBuf		{};
+	ID3D11Buffer*				m_spineIdxBuf		{};
+	size_t						m_spineVtxCapacity	{};
+	size_t						m_spineIdxCapacity	{};
 	ID3D11ShaderResourceView*	m_spineTexture		{};
 	ID3D11SamplerState*			m_sampLinear		{};
 	spine::Skeleton*			m_spineSkeleton		{};
 	spine::AnimationState*		m_spineAniState		{};
 	spine::SkeletonData*		m_spineSkeletonData	{};
 	spine::Atlas*				m_spineAtlas		{};
+	spine::SkeletonDataCache*	m_spineCache		{};
+	spine::SkeletonDataCache::Entry*	m_spineData	{};
 public:
 	SceneSpine();
 	virtual ~SceneSpine();
 
-	int		Init(const std::string& str_atlas, const std::string& str_skel);
+	// takes over the reference to the acquired entry. the cache must outlive the scene.
+	int		Init(spine::SkeletonDataCache& cache, spine::SkeletonDataCache::Entry* entry);
 	int		Destroy();
 	int		Update(float deltaTime);
 	int		Render();
 	void	SetMVP(const XMMATRIX& tmMVP);
 protected:
-	void	InitSpine(const std::string& str_atlas, const std::string& str_skel);
-	void	UpdateSpineSequence();
-	void	UpdateSpineBuffer();
-	void	SetupSpineSequence(int order, void* attachment, VtxSequenceSpine::ESPINE_ATTACHMENT_TYPE attachmentType);
-	void	load(spine::AtlasPage& page,const spine::String& path) override;
-	void	unload(void* texture) override;
+	void	InitSpine();
+	int		UpdateSpineBuffer();
 };
 
 #endif
@@ -0,0 +1,86 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated April 5, 2025. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2025, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+// Bakes .skel or .json skeleton data into the format loaded by spine::SkeletonBaked.
+//
+// Usage: spine-baker <skeleton.skel|skeleton.json> <skeleton.atlas> <output> [scale]
+
+#include <spine/spine.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace spine;
+
+namespace spine {
+	SpineExtension *getDefaultExtension() {
+		return new DefaultSpineExtension();
+	}
+}
+
+static bool endsWith(const char *string, const char *suffix) {
+	size_t length = strlen(string), suffixLength = strlen(suffix);
+	return length >= suffixLength && strcmp(string + length - suffixLength, suffix) == 0;
+}
+
+int main(int argc, char **argv) {
+	if (argc < 4) {
+		fprintf(stderr, "Usage: spine-baker <skeleton.skel|skeleton.json> <skeleton.atlas> <output> [scale]\n");
+		return 1;
+	}
+	float scale = argc > 4 ? (float) atof(argv[4]) : 1;
+
+	// Textures are not needed to bake, only the region names and sizes.
+	Atlas atlas(argv[2], NULL, false);
+	if (atlas.getPages().size() == 0) {
+		fprintf(stderr, "Unable to read atlas: %s\n", argv[2]);
+		return 1;
+	}
+
+	SkeletonData *skeletonData;
+	if (endsWith(argv[1], ".json")) {
+		SkeletonJson json(&atlas);
+		json.setScale(scale);
+		skeletonData = json.readSkeletonDataFile(argv[1]);
+		if (!skeletonData) fprintf(stderr, "%s\n", json.getError().buffer());
+	} else {
+		SkeletonBinary binary(&atlas);
+		binary.setScale(scale);
+		skeletonData = binary.readSkeletonDataFile(argv[1]);
+		if (!skeletonData) fprintf(stderr, "%s\n", binary.getError().buffer());
+	}
+	if (!skeletonData) return 1;
+
+	SkeletonBaker baker;
+	bool written = baker.writeFile(*skeletonData, argv[3]);
+	if (!written) fprintf(stderr, "%s\n", baker.getError().buffer());
+	delete skeletonData;
+	return written ? 0 : 1;
+}
@@ -119,8 +119,32 @@ namespace spine {
 		/// @param target After the first and before the last entry.
 		static int search(Vector<float> &values, float target);
 
+		/// Finds the last frame at or before target, scanning small frame counts and binary searching large ones.
+		/// @return The index of the frame's first entry, a multiple of step.
 		static int search(Vector<float> &values, float target, int step);
+
 	private:
+		/// Sets a frame index hint that search() checks first and updates, for calls made on this thread while the scope
+		/// exists. Results are the same with or without a hint. AnimationState points it at a TrackEntry's per timeline
+		/// cursor while it applies that timeline, so monotonic playback finds the next key in amortized O(1). The scope
+		/// starts without a hint and restores the previous one when it ends, so no hint outlives the apply that set it.
+		class SearchCursorScope {
+		public:
+			SearchCursorScope();
+
+			~SearchCursorScope();
+
+			/// @param cursor NULL disables the hint.
+			void set(int *cursor);
+
+		private:
+			SearchCursorScope(const SearchCursorScope &);
+
+			SearchCursorScope &operator=(const SearchCursorScope &);
+
+			int *_previous;
+		};
+
 		Vector<Timeline *> _timelines;
 		HashMap<PropertyId, bool> _timelineIds;
 		float _duration;
@@ -69,6 +69,8 @@ namespace spine {
 
 	class AttachmentTimeline;
 
+	class BakedAnimation;
+
 #ifdef SPINE_USE_STD_FUNCTION
 	typedef std::function<void (AnimationState* state, EventType type, TrackEntry* entry, Event* event)> AnimationStateListener;
 #else
@@ -135,6 +137,18 @@ namespace spine {
 
 		void setShortestRotation(bool inValue);
 
+		/// If true (the default), each timeline remembers the key frame it last found, so monotonic playback
+		/// finds the next key without searching. Playback results are the same either way.
+		bool getKeyframeCursors();
+
+		void setKeyframeCursors(bool inValue);
+
+		/// A baked animation of getAnimation() that is played back instead of evaluating its bone transform timelines, or NULL.
+		/// It is cleared when the entry is reused. See BakedAnimation.
+		BakedAnimation *getBakedAnimation();
+
+		void setBakedAnimation(BakedAnimation *inValue);
+
 		/// Seconds to postpone playing the animation. When a track entry is the current track entry, delay postpones incrementing
 		/// the track time. When a track entry is queued, delay is the time from the start of the previous animation to when the
 		/// track entry will become the current track entry.
@@ -292,13 +306,14 @@ namespace spine {
 
 	private:
 		Animation *_animation;
+		BakedAnimation *_bakedAnimation;
 		TrackEntry *_previous;
 		TrackEntry *_next;
 		TrackEntry *_mixingFrom;
 		TrackEntry *_mixingTo;
 		int _trackIndex;
 
-		bool _loop, _holdPrevious, _reverse, _shortestRotation;
+		bool _loop, _holdPrevious, _reverse, _shortestRotation, _keyframeCursors;
 		float _eventThreshold, _mixAttachmentThreshold, _alphaAttachmentThreshold, _mixDrawOrderThreshold;
 		float _animationStart, _animationEnd, _animationLast, _nextAnimationLast;
 		float _delay, _trackTime, _trackLast, _nextTrackLast, _trackEnd, _timeScale;
@@ -307,6 +322,7 @@ namespace spine {
 		Vector<int> _timelineMode;
 		Vector<TrackEntry *> _timelineHoldMix;
 		Vector<float> _timelinesRotation;
+		Vector<int> _timelineCursors;
 		AnimationStateListener _listener;
 		AnimationStateListenerObject *_listenerObject;
 
@@ -374,6 +390,11 @@ namespace spine {
 		/// animation state can be applied to multiple skeletons to pose them identically.
 		bool apply(Skeleton &skeleton);
 
+		/// Reserves memory so update() and apply() do not allocate while up to trackEntryCount track entries, current, queued
+		/// and mixing from, are in use on all tracks with any animations of the skeleton data. Without this, the state grows
+		/// the first time an animation is mixed and stops allocating after that.
+		void reserve(size_t trackEntryCount);
+
 		/// Removes all animations from all tracks, leaving skeletons in their previous pose.
 		/// It may be desired to use AnimationState.setEmptyAnimations(float) to mix the skeletons back to the setup pose,
 		/// rather than leaving them in their previous pose.
@@ -486,7 +507,7 @@ namespace spine {
 
 		static void
 		applyRotateTimeline(RotateTimeline *rotateTimeline, Skeleton &skeleton, float time, float alpha, MixBlend pose,
-							Vector<float> &timelinesRotation, size_t i, bool firstFrame);
+							Vector<float> &timelinesRotation, size_t i, bool firstFrame, BakedAnimation *baked = NULL);
 
 		void applyAttachmentTimeline(AttachmentTimeline *attachmentTimeline, Skeleton &skeleton, float animationTime,
 									 MixBlend pose, bool firstFrame);
@@ -496,6 +517,9 @@ namespace spine {
 
 		float applyMixingFrom(TrackEntry *to, Skeleton &skeleton, MixBlend currentPose);
 
+		/// Returns the entry's per timeline search cursors, or NULL if it has them disabled.
+		static int *getTimelineCursors(TrackEntry &entry, size_t timelineCount);
+
 		void queueEvents(TrackEntry *entry, float animationTime);
 
 		/// Sets the active TrackEntry for a given track number.
@@ -81,9 +81,14 @@ namespace spine {
 			bool operator==(const AnimationPair &other) const;
 		};
 
+		/// Pairs compare by animation name, so they hash by name too.
+		struct AnimationPairHash {
+			size_t operator()(const AnimationPair &pair) const;
+		};
+
 		SkeletonData *_skeletonData;
 		float _defaultMix;
-		HashMap<AnimationPair, float> _animationToMixTime;
+		HashMap<AnimationPair, float, AnimationPairHash> _animationToMixTime;
 	};
 }
 
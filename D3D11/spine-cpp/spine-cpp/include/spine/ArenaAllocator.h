@@ -0,0 +1,125 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated April 5, 2025. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2025, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_ArenaAllocator_h
+#define Spine_ArenaAllocator_h
+
+#include <spine/SpineObject.h>
+
+namespace spine {
+	/// Bump allocator for frame temporary allocations. Memory is only released in bulk by reset() or the destructor. Not thread safe,
+	/// use one arena per thread. See ArenaScope.
+	class SP_API ArenaAllocator : public SpineObject {
+	public:
+		/// @param blockSize The size of each block of memory requested from the SpineExtension instance.
+		explicit ArenaAllocator(size_t blockSize = 64 * 1024);
+
+		~ArenaAllocator();
+
+		/// Returns 16 byte aligned memory, or NULL if size is 0 or a new block could not be allocated or lies above the 48 bit
+		/// addresses isArenaMemory() can recognize. SpineExtension then allocates from the heap instead.
+		void *allocate(size_t size);
+
+		/// True if ptr was returned by allocate() since the last reset().
+		bool owns(const void *ptr) const;
+
+		/// True if ptr points into a block of any arena. Thread safe and lock free, a page map lookup.
+		static bool isArenaMemory(const void *ptr);
+
+		/// The size passed to allocate() for ptr, which must be arena memory.
+		static size_t getSize(const void *ptr);
+
+		/// Releases all allocations at once. The blocks are kept for reuse.
+		void reset();
+
+		/// The number of bytes allocated since the last reset(), including headers and alignment.
+		size_t getUsed() const;
+
+		/// The number of bytes of all blocks.
+		size_t getCapacity() const;
+
+	private:
+		struct Block {
+			Block *next;
+			char *memory;
+			size_t size;
+			size_t used;
+		};
+
+		static void registerBlock(Block *block);
+
+		static void unregisterBlock(Block *block);
+
+		ArenaAllocator(const ArenaAllocator &);
+
+		ArenaAllocator &operator=(const ArenaAllocator &);
+
+		Block *_first;
+		Block *_current;
+		size_t _blockSize;
+	};
+
+	/// While an ArenaScope is alive, SpineExtension::alloc(), calloc() and realloc() of a NULL pointer on the same thread are served
+	/// from its arena. Scopes nest, the innermost arena serves new allocations. Memory allocated before the scope is unaffected.
+	///
+	/// SpineExtension::free() and realloc() recognize arena memory on any thread, with or without a scope: free() does nothing,
+	/// realloc() copies into the owning arena while one of its scopes is active on the calling thread and onto the heap otherwise.
+	/// Memory allocated in a scope may so be freed after the scope ended, but not after the arena was reset or destroyed.
+	///
+	/// A scope captures every allocation on its thread, including objects that outlive the frame: TrackEntry and Event objects
+	/// created or pooled by AnimationState, lazily grown members of SkeletonRenderer or SkeletonClipping, and Strings or Vectors
+	/// added to long lived containers. Only run code in a scope whose allocations are all freed or abandoned before reset(), eg
+	/// local temporaries.
+	class SP_API ArenaScope {
+	public:
+		explicit ArenaScope(ArenaAllocator &arena);
+
+		~ArenaScope();
+
+		ArenaAllocator &getArena() {
+			return _arena;
+		}
+
+		/// The innermost scope of the calling thread. May be NULL.
+		static ArenaScope *getCurrent();
+
+		/// The arena of the innermost scope of the calling thread that owns ptr. May be NULL.
+		static ArenaAllocator *findOwner(const void *ptr);
+
+	private:
+		ArenaScope(const ArenaScope &);
+
+		ArenaScope &operator=(const ArenaScope &);
+
+		ArenaAllocator &_arena;
+		ArenaScope *_previous;
+	};
+}
+
+#endif /* Spine_ArenaAllocator_h */
@@ -0,0 +1,180 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated April 5, 2025. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2025, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_AsyncLoader_h
+#define Spine_AsyncLoader_h
+
+#include <spine/SpineObject.h>
+#include <spine/SpineString.h>
+#include <spine/TextureLoader.h>
+#include <spine/Vector.h>
+
+namespace spine {
+	class Atlas;
+
+	class AtlasPage;
+
+	class SkeletonData;
+
+	class AsyncLoader;
+
+	/// A TextureLoader that splits loading a page into a part that may run on any thread and a part that runs on the thread
+	/// owning the graphics context. AsyncLoader calls decode() on its worker threads, for several pages at once, and queues the
+	/// result for upload() on the thread calling AsyncLoader::update().
+	class SP_API DeferredTextureLoader : public TextureLoader {
+	public:
+		/// Called on a worker thread, possibly concurrently for other pages. Typically reads and decodes the image file.
+		/// @return Passed to upload(), may be NULL.
+		virtual void *decode(AtlasPage &page, const String &path) = 0;
+
+		/// Called on the thread calling AsyncLoader::update(). Creates the texture, sets AtlasPage::texture and releases the
+		/// decoded data.
+		virtual void upload(AtlasPage &page, const String &path, void *decoded) = 0;
+
+		/// Decodes and uploads on the calling thread, for atlases not loaded through an AsyncLoader.
+		virtual void load(AtlasPage &page, const String &path);
+	};
+
+	/// A load requested with AsyncLoader::load(). Owned by the caller, who may delete it once it is done.
+	class SP_API AsyncLoad : public SpineObject {
+		friend class AsyncLoader;
+
+		friend class SkeletonDataCache;
+
+	public:
+		/// True once the textures are uploaded and the listener was notified.
+		bool isDone();
+
+		const String &getAtlasPath();
+
+		const String &getSkeletonPath();
+
+		float getScale();
+
+		/// Owned by the caller once done, deleting the load does not delete it. NULL if the atlas could not be read.
+		Atlas *getAtlas();
+
+		/// Owned by the caller once done, deleting the load does not delete it. NULL if loading failed, see getError().
+		SkeletonData *getSkeletonData();
+
+		/// Empty if loading succeeded.
+		const String &getError();
+
+	private:
+		AsyncLoad(const String &atlasPath, const String &skeletonPath, float scale);
+
+		AsyncLoad(const AsyncLoad &);
+
+		AsyncLoad &operator=(const AsyncLoad &);
+
+		String _atlasPath;
+		String _skeletonPath;
+		float _scale;
+		Atlas *_atlas;
+		SkeletonData *_skeletonData;
+		String _error;
+		Vector<void *> _decoded;
+		int _tasks;
+		bool _done;
+	};
+
+	/// Receives completed loads, see AsyncLoader::setListener().
+	class SP_API AsyncLoaderListener {
+	public:
+		virtual ~AsyncLoaderListener() {
+		}
+
+		/// Called from AsyncLoader::update() or AsyncLoader::finish() once the textures of the load are uploaded. The load may be
+		/// deleted here, unless it was passed to AsyncLoader::finish().
+		virtual void loaded(AsyncLoader &loader, AsyncLoad &load) = 0;
+	};
+
+	/// Loads atlases and skeleton data on a pool of worker threads. The atlas text and the skeleton data, JSON, binary or baked
+	/// as detected by SkeletonBaked::isBaked() and the file extension, are parsed on a worker, while the pages of the atlas are
+	/// decoded by other workers when the texture loader is a DeferredTextureLoader. Textures are only created on the thread
+	/// calling update() or finish(), which must be the thread owning the graphics context. With a plain TextureLoader the whole
+	/// of TextureLoader::load() runs there.
+	///
+	/// The SpineExtension must be thread safe, as DefaultSpineExtension and DebugExtension are.
+	class SP_API AsyncLoader : public SpineObject {
+	public:
+		/// @param threadCount The number of worker threads, 0 uses one per hardware thread.
+		explicit AsyncLoader(TextureLoader *textureLoader, int threadCount = 0);
+
+		explicit AsyncLoader(DeferredTextureLoader *textureLoader, int threadCount = 0);
+
+		/// Finishes the pending loads, see finish(), then stops the worker threads.
+		~AsyncLoader();
+
+		/// Queues loading an atlas and the skeleton data using it. Returns immediately.
+		/// @param scale Applied to JSON and binary skeleton data. Baked data keeps the scale it was baked with and fails to load
+		/// with a scale other than 1.
+		AsyncLoad *load(const String &atlasPath, const String &skeletonPath, float scale = 1);
+
+		/// @param listener May be NULL.
+		void setListener(AsyncLoaderListener *listener);
+
+		/// Uploads the textures of loads whose parsing is done, marks them done and notifies the listener. Never blocks on the
+		/// workers.
+		/// @return The number of loads that became done.
+		int update();
+
+		/// Blocks until the load is done, or all loads if NULL, calling update() and running queued work on the calling thread
+		/// while waiting.
+		void finish(AsyncLoad *load = NULL);
+
+		/// The number of loads that are not done yet.
+		int getPendingCount();
+
+		int getThreadCount();
+
+		/// Reads JSON, binary or baked skeleton data on the calling thread, picking the loader the same way load() does. Baked
+		/// data is only read with a scale of 1.
+		/// @return NULL if reading failed, error is set then.
+		static SkeletonData *readSkeletonDataFile(Atlas *atlas, const String &path, float scale, String &error);
+
+	private:
+		AsyncLoader(const AsyncLoader &);
+
+		AsyncLoader &operator=(const AsyncLoader &);
+
+		struct Pool;
+
+		void start(int threadCount);
+
+		void run(AsyncLoad *load, int page);
+
+		TextureLoader *_textureLoader;
+		DeferredTextureLoader *_deferredLoader;
+		AsyncLoaderListener *_listener;
+		Pool *_pool;
+	};
+}
+
+#endif /* Spine_AsyncLoader_h */
@@ -31,6 +31,7 @@
 #define Spine_Attachment_h
 
 #include <spine/RTTI.h>
+#include <spine/AttachmentType.h>
 #include <spine/SpineObject.h>
 #include <spine/SpineString.h>
 
@@ -39,12 +40,19 @@ namespace spine {
 	RTTI_DECL
 
 	public:
+		/// For attachment classes other than the runtime's, getType() returns AttachmentType_Custom.
 		explicit Attachment(const String &name);
 
+		Attachment(const String &name, AttachmentType type);
+
 		virtual ~Attachment();
 
 		const String &getName() const;
 
+		/// The concrete attachment type, for switch based dispatch without going through getRTTI().
+		/// Linked meshes are MeshAttachments and report AttachmentType_Mesh.
+		AttachmentType getType() const { return _type; }
+
 		virtual Attachment *copy() = 0;
 
 		int getRefCount();
@@ -55,6 +63,7 @@ namespace spine {
 
 	private:
 		const String _name;
+		const AttachmentType _type;
 		int _refCount;
 	};
 }
@@ -38,7 +38,9 @@ namespace spine {
 		AttachmentType_Linkedmesh,
 		AttachmentType_Path,
 		AttachmentType_Point,
-		AttachmentType_Clipping
+		AttachmentType_Clipping,
+		/// Attachments of other classes, constructed without a type. Never read from skeleton files.
+		AttachmentType_Custom
 	};
 }
 
@@ -0,0 +1,155 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated April 5, 2025. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2025, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_BakedAnimation_h
+#define Spine_BakedAnimation_h
+
+#include <spine/MixBlend.h>
+#include <spine/MixDirection.h>
+#include <spine/SpineObject.h>
+#include <spine/Vector.h>
+
+namespace spine {
+	class Animation;
+
+	class Bone;
+
+	class Event;
+
+	class Skeleton;
+
+	class SkeletonData;
+
+	/// The bone transform timelines of an animation sampled at a fixed rate into a table of bone local transforms, which is
+	/// played back by interpolating linearly between samples instead of evaluating the timelines' curves. This is cheaper per
+	/// frame for many skeletons playing the same animations, at the cost of memory and some accuracy.
+	///
+	/// Each keyed bone property is a channel. Channels that stay within the storage tolerance of a single value keep only that
+	/// value, and if quantization is requested, channels whose 16-bit steps are within the storage tolerance keep 16-bit
+	/// samples. Other channels keep float samples. Timelines other than bone transforms are not baked and are applied as usual.
+	///
+	/// Set on a TrackEntry to have AnimationState play it, see TrackEntry::setBakedAnimation().
+	class SP_API BakedAnimation : public SpineObject {
+	public:
+		/// Samples the animation of the skeleton data.
+		/// @param sampleRate The number of samples per second.
+		/// @param storageTolerance How far the stored values of a channel may be from its samples when it is stored as a single
+		/// value or quantized, in the channel's units (degrees for rotation, skeleton units for translation and shear, and the
+		/// bone's scale). It does not bound the error between samples, which depends on the sample rate, see getError().
+		/// @param quantize If true, channels are stored with 16-bit samples where the storage tolerance allows.
+		BakedAnimation(SkeletonData &skeletonData, Animation &animation, float sampleRate = 30, float storageTolerance = 0.01f,
+					   bool quantize = false);
+
+		~BakedAnimation();
+
+		Animation &getAnimation();
+
+		float getSampleRate();
+
+		float getStorageTolerance();
+
+		int getSampleCount();
+
+		/// The number of keyed bone properties.
+		int getChannelCount();
+
+		/// The number of channels stored with 16-bit samples.
+		int getQuantizedCount();
+
+		/// The number of channels stored as a single value.
+		int getConstantCount();
+
+		/// The largest difference between the baked and the evaluated animation, measured at each sample and halfway between
+		/// samples when baking. At the samples it is within the storage tolerance, between them only a higher sample rate
+		/// reduces it. A curve much steeper than the sample interval, eg from a bezier handle at a key, keeps it large at any
+		/// rate, bake such animations at a rate that looks right or leave them unbaked.
+		float getError();
+
+		/// The number of bytes used by this baked animation, including the samples.
+		size_t getSize();
+
+		/// Returns true if the animation's timeline at the index is played back from the samples.
+		bool isBaked(size_t timelineIndex) {
+			return _timelineChannels[timelineIndex] != -1;
+		}
+
+		/// Returns the bone local value of the first channel of a baked timeline at the specified time.
+		float getValue(size_t timelineIndex, float time);
+
+		/// Applies a baked timeline as Timeline::apply() would, using the samples. When mixing out scale, the sign of the
+		/// samples is used rather than that of the setup or current pose.
+		void apply(size_t timelineIndex, Skeleton &skeleton, float time, float alpha, MixBlend blend, MixDirection direction);
+
+		/// Applies the animation as Animation::apply() would, with baked timelines using the samples.
+		void apply(Skeleton &skeleton, float lastTime, float time, bool loop, Vector<Event *> *pEvents, float alpha,
+				   MixBlend blend, MixDirection direction);
+
+	private:
+		enum Storage {
+			Storage_Constant, Storage_Float, Storage_Quantized
+		};
+
+		struct Channel {
+			int timeline;
+			int bone;
+			int property;
+			Storage storage;
+			int offset;
+			/// The offset of the step times for each sample interval, or -1 if the timeline has no stepped keys.
+			int steps;
+			float base, scale;
+			/// The time of the timeline's first frame, before which the timeline does not key the property.
+			float first;
+		};
+
+		BakedAnimation(const BakedAnimation &);
+
+		BakedAnimation &operator=(const BakedAnimation &);
+
+		void addStep(Channel &channel, float time);
+
+		float sample(const Channel &channel, float time);
+
+		static float &boneValue(Bone &bone, int property);
+
+		Animation &_animation;
+		float _sampleRate, _storageTolerance, _error;
+		int _sampleCount;
+		float _step, _inverseStep;
+		Vector<Channel> _channels;
+		/// The first channel of each timeline, or -1 if the timeline is not baked.
+		Vector<int> _timelineChannels;
+		Vector<float> _values;
+		Vector<unsigned short> _quantized;
+		/// The time of the first stepped key in each sample interval, or FLT_MAX, so playback holds a sample until the step.
+		Vector<float> _steps;
+	};
+}
+
+#endif /* Spine_BakedAnimation_h */
@@ -77,6 +77,8 @@ namespace spine {
             return (T *) _allocate((int) (sizeof(T) * num));
         }
 
+        /// Frees all allocations. If more than one block was used, the blocks are replaced by a single block with room for
+        /// half as much again, so the allocator settles at its high-water mark instead of growing a little every frame.
         void compress() {
             if (blocks.size() == 1) {
                 blocks[0].allocated = 0;
@@ -88,7 +90,23 @@ namespace spine {
                 SpineExtension::free(blocks[i].memory, __FILE__, __LINE__);
             }
             blocks.clear();
-            blocks.add(newBlock(totalSize));
+            blocks.add(newBlock(totalSize + (totalSize >> 1)));
+        }
+
+        /// Frees all allocations and makes sure numBytes can be allocated without allocating a new block.
+        void reserve(int numBytes) {
+            compress();
+            if (blocks[0].size >= numBytes) return;
+            SpineExtension::free(blocks[0].memory, __FILE__, __LINE__);
+            blocks[0] = newBlock(numBytes);
+        }
+
+        /// The number of bytes that can be allocated after compress() without allocating a new block.
+        int getCapacity() {
+            int capacity = 0;
+            for (int i = 0, n = (int)blocks.size(); i < n; i++)
+                capacity += blocks[i].size;
+            return capacity;
         }
 
     private:
@@ -97,7 +115,7 @@ namespace spine {
             int alignedNumBytes = numBytes + (numBytes % 16 != 0 ? 16 - (numBytes % 16) : 0);
             Block *block = &blocks[blocks.size() - 1];
             if (!block->canFit(alignedNumBytes)) {
-                blocks.add(newBlock(MathUtil::max(initialBlockSize, alignedNumBytes)));
+                blocks.add(newBlock(MathUtil::max(block->size, alignedNumBytes)));
                 block = &blocks[blocks.size() - 1];
             }
             return block->allocate(alignedNumBytes);
@@ -98,6 +98,10 @@ namespace spine {
 
         friend class InheritTimeline;
 
+		friend class SkeletonInstance;
+
+		friend class BakedAnimation;
+
 	RTTI_DECL
 
 	public:
@@ -264,7 +268,11 @@ namespace spine {
 
         Inherit getInherit() { return _inherit; }
 
-        void setInherit(Inherit inValue) { _inherit = inValue; }
+        void setInherit(Inherit inValue) {
+			if (_inherit == inValue) return;
+			_inherit = inValue;
+			_dirty = true;
+		}
 
 	private:
 		static bool yDown;
@@ -279,6 +287,12 @@ namespace spine {
 		float _c, _d, _worldY;
 		bool _sorted;
 		bool _active;
+		/// True if the world transform is not the one computed from the applied transform, eg because a constraint or
+		/// application code modified it, and must be recomputed by the next Skeleton::updateWorldTransform(Physics).
+		bool _dirty;
+		/// True if the world transform was written during the current Skeleton::updateWorldTransform(Physics), so the children
+		/// must be recomputed.
+		bool _updated;
         Inherit _inherit;
 	};
 }
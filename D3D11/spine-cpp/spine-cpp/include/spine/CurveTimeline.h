@@ -38,6 +38,8 @@ namespace spine {
 	class SP_API CurveTimeline : public Timeline {
 	RTTI_DECL
 
+		friend class BakedAnimation;
+
 	public:
 		explicit CurveTimeline(size_t frameCount, size_t frameEntries, size_t bezierCount);
 
@@ -84,6 +86,10 @@ namespace spine {
 
         float getScaleValue (float time, float alpha, MixBlend blend, MixDirection direction, float current, float setup);
 
+		/// Evaluates the curves of many timelines at the same time, as getCurveValue() would for each.
+		/// @param values Receives one value per timeline.
+		static void getCurveValues(CurveTimeline1 **timelines, size_t count, float time, float *values);
+
 	protected:
 		static const int ENTRIES = 2;
 		static const int VALUE = 1;
@@ -99,7 +105,12 @@ namespace spine {
 
 		void setFrame(size_t frame, float time, float value1, float value2);
 
-		float getCurveValue(float time);
+		/// Returns both values of the curves at the time.
+		void getCurveValue(float time, float &value1, float &value2);
+
+		/// Evaluates the curves of many timelines at the same time, as getCurveValue() would for each.
+		/// @param values Receives two values per timeline.
+		static void getCurveValues(CurveTimeline2 **timelines, size_t count, float time, float *values);
 
 	protected:
 		static const int ENTRIES = 3;
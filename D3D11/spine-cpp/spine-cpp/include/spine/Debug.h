@@ -34,9 +34,11 @@
 #include <spine/Vector.h>
 
 #include <map>
+#include <mutex>
 
 namespace spine {
 
+	/// Tracks allocations to report leaks. Thread safe, allocation bookkeeping is serialized by a mutex.
 	class SP_API DebugExtension : public SpineExtension {
 		struct Allocation {
 			void *address;
@@ -53,10 +55,11 @@ namespace spine {
 
 	public:
 		DebugExtension(SpineExtension *extension) : _extension(extension), _allocations(0), _reallocations(0),
-													_frees(0) {
+													_frees(0), _usedMemory(0) {
 		}
 
 		void reportLeaks() {
+			std::lock_guard<std::mutex> lock(_mutex);
 			for (std::map<void *, Allocation>::iterator it = _allocated.begin(); it != _allocated.end(); it++) {
 				printf("\"%s:%i (%zu bytes at %p)\n", it->second.fileName, it->second.line, it->second.size,
 					   it->second.address);
@@ -66,12 +69,14 @@ namespace spine {
 		}
 
 		void clearAllocations() {
+			std::lock_guard<std::mutex> lock(_mutex);
 			_allocated.clear();
 			_usedMemory = 0;
 		}
 
 		virtual void *_alloc(size_t size, const char *file, int line) {
 			void *result = _extension->_alloc(size, file, line);
+			std::lock_guard<std::mutex> lock(_mutex);
 			_allocated[result] = Allocation(result, size, file, line);
 			_allocations++;
 			_usedMemory += size;
@@ -80,6 +85,7 @@ namespace spine {
 
 		virtual void *_calloc(size_t size, const char *file, int line) {
 			void *result = _extension->_calloc(size, file, line);
+			std::lock_guard<std::mutex> lock(_mutex);
 			_allocated[result] = Allocation(result, size, file, line);
 			_allocations++;
 			_usedMemory += size;
@@ -87,6 +93,7 @@ namespace spine {
 		}
 
 		virtual void *_realloc(void *ptr, size_t size, const char *file, int line) {
+			std::lock_guard<std::mutex> lock(_mutex);
 			if (_allocated.count(ptr)) _usedMemory -= _allocated[ptr].size;
 			_allocated.erase(ptr);
 			void *result = _extension->_realloc(ptr, size, file, line);
@@ -97,6 +104,7 @@ namespace spine {
 		}
 
 		virtual void _free(void *mem, const char *file, int line) {
+			std::lock_guard<std::mutex> lock(_mutex);
 			if (_allocated.count(mem)) {
 				_extension->_free(mem, file, line);
 				_frees++;
@@ -111,6 +119,7 @@ namespace spine {
 
 		virtual char *_readFile(const String &path, int *length) {
             auto data = _extension->_readFile(path, length);
+            std::lock_guard<std::mutex> lock(_mutex);
 
             if (_allocated.count(data) == 0) {
                 _allocated[data] = Allocation(data, sizeof(char) * (*length), nullptr, 0);
@@ -121,7 +130,16 @@ namespace spine {
             return data;
 		}
 
+		virtual const char *_mapFile(const String &path, int *length) {
+			return _extension->_mapFile(path, length);
+		}
+
+		virtual void _unmapFile(const char *data, int length) {
+			_extension->_unmapFile(data, length);
+		}
+
 		size_t getUsedMemory() {
+			std::lock_guard<std::mutex> lock(_mutex);
 			return _usedMemory;
 		}
 
@@ -132,6 +150,7 @@ namespace spine {
 		size_t _reallocations;
 		size_t _frees;
 		size_t _usedMemory;
+		std::mutex _mutex;
 	};
 }
 
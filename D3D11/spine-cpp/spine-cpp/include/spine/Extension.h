@@ -43,22 +43,22 @@ namespace spine {
 	public:
 		template<typename T>
 		static T *alloc(size_t num, const char *file, int line) {
-			return (T *) getInstance()->_alloc(sizeof(T) * num, file, line);
+			return (T *) allocate(sizeof(T) * num, false, file, line);
 		}
 
 		template<typename T>
 		static T *calloc(size_t num, const char *file, int line) {
-			return (T *) getInstance()->_calloc(sizeof(T) * num, file, line);
+			return (T *) allocate(sizeof(T) * num, true, file, line);
 		}
 
 		template<typename T>
 		static T *realloc(T *ptr, size_t num, const char *file, int line) {
-			return (T *) getInstance()->_realloc(ptr, sizeof(T) * num, file, line);
+			return (T *) reallocate((void *) ptr, sizeof(T) * num, file, line);
 		}
 
 		template<typename T>
 		static void free(T *ptr, const char *file, int line) {
-			getInstance()->_free((void *) ptr, file, line);
+			deallocate((void *) ptr, file, line);
 		}
 
 		template<typename T>
@@ -70,8 +70,20 @@ namespace spine {
 			return getInstance()->_readFile(path, length);
 		}
 
+		/// Maps a file read only, for parsing without copying it. Returns NULL if mapping is not supported or failed, use
+		/// readFile() then. Release the data with unmapFile().
+		static const char *mapFile(const String &path, int *length) {
+			return getInstance()->_mapFile(path, length);
+		}
+
+		static void unmapFile(const char *data, int length) {
+			getInstance()->_unmapFile(data, length);
+		}
+
+		/// Sets the extension used by all threads. Call before any other spine-cpp function.
 		static void setInstance(SpineExtension *inSpineExtension);
 
+		/// Thread safe. The first call without an instance set uses getDefaultExtension().
 		static SpineExtension *getInstance();
 
 		virtual ~SpineExtension();
@@ -88,13 +100,23 @@ namespace spine {
 
 		virtual char *_readFile(const String &path, int *length) = 0;
 
+		/// Implement this function to map files into memory. The default does not support mapping and returns NULL.
+		virtual const char *_mapFile(const String &path, int *length);
+
+		virtual void _unmapFile(const char *data, int length);
+
 		virtual void _beforeFree(void *ptr) { SP_UNUSED(ptr); }
 
 	protected:
 		SpineExtension();
 
 	private:
-		static SpineExtension *_instance;
+		/// Serve the allocation from the calling thread's ArenaScope if there is one, else from the instance.
+		static void *allocate(size_t size, bool clear, const char *file, int line);
+
+		static void *reallocate(void *ptr, size_t size, const char *file, int line);
+
+		static void deallocate(void *ptr, const char *file, int line);
 	};
 
 	class SP_API DefaultSpineExtension : public SpineExtension {
@@ -113,6 +135,11 @@ namespace spine {
 		virtual void _free(void *mem, const char *file, int line) override;
 
 		virtual char *_readFile(const String &path, int *length) override;
+
+		/// Uses mmap on POSIX systems and MapViewOfFile on Windows.
+		virtual const char *_mapFile(const String &path, int *length) override;
+
+		virtual void _unmapFile(const char *data, int length) override;
 	};
 
 // This function is to be implemented by engine specific runtimes to provide
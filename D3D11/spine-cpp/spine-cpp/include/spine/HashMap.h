@@ -32,6 +32,7 @@
 
 #include <spine/Vector.h>
 #include <spine/SpineObject.h>
+#include <stdint.h>
 
 // Required for new with line number and file name in MSVC
 #ifdef _MSC_VER
@@ -42,7 +43,44 @@
 #endif
 
 namespace spine {
-	template<typename K, typename V>
+	/// Default hash for integer, enum and pointer keys. Other key types pass their own hash functor to HashMap.
+	template<typename K>
+	struct HashMapHash {
+		size_t operator()(const K &key) const {
+			return hashBits((uint64_t) key);
+		}
+
+		static size_t hashBits(uint64_t h) {
+			// splitmix64 finalizer, spreads sequential ids over the whole table
+			h ^= h >> 30;
+			h *= 0xbf58476d1ce4e5b9ULL;
+			h ^= h >> 27;
+			h *= 0x94d049bb133111ebULL;
+			h ^= h >> 31;
+			return (size_t) h;
+		}
+	};
+
+	template<>
+	struct HashMapHash<String> {
+		size_t operator()(const String &key) const {
+			return hashChars(key.buffer(), key.length());
+		}
+
+		static size_t hashChars(const char *chars, size_t length) {
+			// FNV-1a over the characters
+			uint64_t h = 0xcbf29ce484222325ULL;
+			for (size_t i = 0; i < length; i++) {
+				h ^= (unsigned char) chars[i];
+				h *= 0x100000001b3ULL;
+			}
+			return HashMapHash<uint64_t>::hashBits(h);
+		}
+	};
+
+	/// Open addressing hash map with linear probing. Entries live in a single contiguous table whose
+	/// capacity is a power of two, so put/find/remove are O(1) expected and clear() keeps the storage.
+	template<typename K, typename V, typename H = HashMapHash<K> >
 	class SP_API HashMap : public SpineObject {
 	private:
 		class Entry;
@@ -60,47 +98,48 @@ namespace spine {
 		public:
 			friend class HashMap;
 
-			explicit Entries(Entry *entry) : _entry(NULL), _hasChecked(false) {
-				_start.next = entry;
-				_entry = &_start;
+			explicit Entries(Entry *entries, size_t capacity) : _entries(entries), _capacity(capacity), _index(0), _hasChecked(false) {
 			}
 
 			Pair next() {
-				assert(_entry);
 				assert(_hasChecked);
-				_entry = _entry->next;
-				Pair pair(_entry->_key, _entry->_value);
+				assert(_index < _capacity);
+				Entry &entry = _entries[_index++];
+				Pair pair(entry._key, entry._value);
 				_hasChecked = false;
 				return pair;
 			}
 
 			bool hasNext() {
 				_hasChecked = true;
-				return _entry->next;
+				while (_index < _capacity && !_entries[_index]._used) _index++;
+				return _index < _capacity;
 			}
 
 		private:
+			Entry *_entries;
+			size_t _capacity;
+			size_t _index;
 			bool _hasChecked;
-			Entry _start;
-			Entry *_entry;
 		};
 
 		HashMap() :
-				_head(NULL),
+				_entries(NULL),
+				_capacity(0),
 				_size(0) {
 		}
 
 		~HashMap() {
 			clear();
+			if (_entries) SpineExtension::free(_entries, __FILE__, __LINE__);
 		}
 
+		/// Removes all entries but keeps the table, so refilling a map of similar size does not allocate.
 		void clear() {
-			for (Entry *entry = _head; entry != NULL;) {
-				Entry *next = entry->next;
-				delete entry;
-				entry = next;
+			if (_size == 0) return;
+			for (size_t i = 0; i < _capacity; i++) {
+				if (_entries[i]._used) destroy(_entries[i]);
 			}
-			_head = NULL;
 			_size = 0;
 		}
 
@@ -108,35 +147,23 @@ namespace spine {
 			return _size;
 		}
 
+		/// Grows the table so that at least the given number of entries fit without rehashing.
+		void reserve(size_t count) {
+			size_t capacity = _capacity ? _capacity : 8;
+			while (count * 4 > capacity * 3) capacity <<= 1;
+			if (capacity != _capacity) rehash(capacity);
+		}
+
 		void put(const K &key, const V &value) {
-			Entry *entry = find(key);
-			if (entry) {
-				entry->_key = key;
-				entry->_value = value;
-			} else {
-				entry = new(__FILE__, __LINE__) Entry();
-				entry->_key = key;
-				entry->_value = value;
-
-				Entry *oldHead = _head;
-
-				if (oldHead) {
-					_head = entry;
-					oldHead->prev = entry;
-					entry->next = oldHead;
-				} else {
-					_head = entry;
-				}
-				_size++;
-			}
+			insert(key, value);
 		}
 
 		bool addAll(Vector <K> &keys, const V &value) {
-			size_t oldSize = _size;
+			bool added = false;
 			for (size_t i = 0; i < keys.size(); i++) {
-				put(keys[i], value);
+				if (insert(keys[i], value)) added = true;
 			}
-			return _size != oldSize;
+			return added;
 		}
 
 		bool containsKey(const K &key) {
@@ -147,14 +174,21 @@ namespace spine {
 			Entry *entry = find(key);
 			if (!entry) return false;
 
-			Entry *prev = entry->prev;
-			Entry *next = entry->next;
-
-			if (prev) prev->next = next;
-			else _head = next;
-			if (next) next->prev = entry->prev;
-
-			delete entry;
+			// Backward shift deletion, moves later entries of the probe run into the hole so no tombstones are needed.
+			size_t mask = _capacity - 1;
+			size_t hole = (size_t) (entry - _entries);
+			size_t i = hole;
+			while (true) {
+				i = (i + 1) & mask;
+				Entry &candidate = _entries[i];
+				if (!candidate._used) break;
+				size_t home = _hash(candidate._key) & mask;
+				if (hole <= i ? (hole < home && home <= i) : (hole < home || home <= i)) continue;
+				_entries[hole]._key = candidate._key;
+				_entries[hole]._value = candidate._value;
+				hole = i;
+			}
+			destroy(_entries[hole]);
 			_size--;
 
 			return true;
@@ -170,30 +204,79 @@ namespace spine {
 		}
 
 		Entries getEntries() const {
-			return Entries(_head);
+			return Entries(_entries, _capacity);
 		}
 
 	private:
+		// Prevent copying
+		HashMap(const HashMap &other);
+
+		HashMap &operator=(const HashMap &other);
+
 		Entry *find(const K &key) {
-			for (Entry *entry = _head; entry != NULL; entry = entry->next) {
-				if (entry->_key == key)
-					return entry;
+			if (_size == 0) return NULL;
+			size_t mask = _capacity - 1;
+			for (size_t i = _hash(key) & mask;; i = (i + 1) & mask) {
+				Entry &entry = _entries[i];
+				if (!entry._used) return NULL;
+				if (entry._key == key) return &entry;
+			}
+		}
+
+		/// Returns true if the key was not in the map before.
+		bool insert(const K &key, const V &value) {
+			if ((_size + 1) * 4 > _capacity * 3) rehash(_capacity ? _capacity << 1 : 8);
+			size_t mask = _capacity - 1;
+			for (size_t i = _hash(key) & mask;; i = (i + 1) & mask) {
+				Entry &entry = _entries[i];
+				if (!entry._used) {
+					new (&entry._key) K(key);
+					new (&entry._value) V(value);
+					entry._used = true;
+					_size++;
+					return true;
+				}
+				if (entry._key == key) {
+					entry._key = key;
+					entry._value = value;
+					return false;
+				}
+			}
+		}
+
+		void rehash(size_t capacity) {
+			Entry *oldEntries = _entries;
+			size_t oldCapacity = _capacity;
+			_entries = SpineExtension::calloc<Entry>(capacity, __FILE__, __LINE__);
+			_capacity = capacity;
+			_size = 0;
+			for (size_t i = 0; i < oldCapacity; i++) {
+				Entry &entry = oldEntries[i];
+				if (!entry._used) continue;
+				insert(entry._key, entry._value);
+				destroy(entry);
 			}
-			return NULL;
+			if (oldEntries) SpineExtension::free(oldEntries, __FILE__, __LINE__);
+		}
+
+		static void destroy(Entry &entry) {
+			entry._key.~K();
+			entry._value.~V();
+			entry._used = false;
 		}
 
-		class SP_API Entry : public SpineObject {
+		// Storage is raw calloc'd memory, key and value are only constructed while _used is set.
+		class SP_API Entry {
 		public:
 			K _key;
 			V _value;
-			Entry *next;
-			Entry *prev;
-
-			Entry() : next(NULL), prev(NULL) {}
+			bool _used;
 		};
 
-		Entry *_head;
+		Entry *_entries;
+		size_t _capacity;
 		size_t _size;
+		H _hash;
 	};
 }
 
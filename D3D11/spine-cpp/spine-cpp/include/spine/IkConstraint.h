@@ -44,6 +44,8 @@ namespace spine {
 	class SP_API IkConstraint : public Updatable {
 		friend class Skeleton;
 
+		friend class SkeletonInstance;
+
 		friend class IkConstraintTimeline;
 
 	RTTI_DECL
@@ -70,11 +70,30 @@ namespace spine {
 		/* Supply a block of JSON, and this returns a Json object you can interrogate. Call Json_dispose when finished. */
 		explicit Json(const char *value);
 
+		/* As above, for a block of JSON that is not NUL terminated. */
+		Json(const char *value, int length);
+
 		~Json();
 
+		/* Read access to a parsed item, eg to walk a whole document. */
+		int getType() { return _type; }
+
+		const char *getName() { return _name; }
+
+		Json *getChild() { return _child; }
+
+		Json *getNext() { return _next; }
+
+		int getSize() { return _size; }
+
+		const char *getValueString() { return _valueString; }
+
+		float getValueFloat() { return _valueFloat; }
+
+		int getValueInt() { return _valueInt; }
 
 	private:
-		static const char *_error;
+		struct Document;
 
 		Json *_next;
 #if SPINE_JSON_HAVE_PREV
@@ -91,23 +110,27 @@ namespace spine {
 
 		const char *_name; /* The item's name string, if this item is the child of, or is in the list of subitems of an object. */
 
+		Document *_document; /* Set on the root only. Owns the text and nodes of the whole tree, which are freed at once. */
+
+		void parse(const char *value, int length);
+
 		/* Utility to jump whitespace and cr/lf */
-		static const char *skip(const char *inValue);
+		static char *skip(char *inValue);
 
 		/* Parser core - when encountering text, process appropriately. */
-		static const char *parseValue(Json *item, const char *value);
+		static char *parseValue(Json *item, char *value, Document *document);
 
-		/* Parse the input text into an unescaped cstring, and populate item. */
-		static const char *parseString(Json *item, const char *str);
+		/* Unescape the input string in place, NUL terminate it and populate item. */
+		static char *parseString(Json *item, char *str);
 
 		/* Parse the input text to generate a number, and populate the result into item. */
-		static const char *parseNumber(Json *item, const char *num);
+		static char *parseNumber(Json *item, char *num);
 
 		/* Build an array from input text. */
-		static const char *parseArray(Json *item, const char *value);
+		static char *parseArray(Json *item, char *value, Document *document);
 
 		/* Build an object from the text. */
-		static const char *parseObject(Json *item, const char *value);
+		static char *parseObject(Json *item, char *value, Document *document);
 
 		static int json_strcasecmp(const char *s1, const char *s2);
 	};
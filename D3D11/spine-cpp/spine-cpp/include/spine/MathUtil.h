@@ -43,6 +43,8 @@ namespace spine {
 	private:
 		MathUtil();
 
+		static bool _fastTrig;
+
 	public:
 		static const float Pi;
 		static const float Pi_2;
@@ -62,18 +64,33 @@ namespace spine {
 
 		static float abs(float v);
 
-		/// Returns the sine in radians from a lookup table.
+		/// Returns the sine in radians, see setFastTrig().
 		static float sin(float radians);
 
-		/// Returns the cosine in radians from a lookup table.
+		/// Returns the cosine in radians, see setFastTrig().
 		static float cos(float radians);
 
-		/// Returns the sine in radians from a lookup table.
+		/// Returns the sine in degrees, see setFastTrig().
 		static float sinDeg(float degrees);
 
-		/// Returns the cosine in radians from a lookup table.
+		/// Returns the cosine in degrees, see setFastTrig().
 		static float cosDeg(float degrees);
 
+		/// Computes the sine and cosine of an angle in radians at once, sharing the range reduction when fast trig is enabled.
+		static void sinCos(float radians, float &sine, float &cosine);
+
+		/// Computes the sines and cosines of count angles in radians. When fast trig is enabled and SSE2 is available, four angles
+		/// are evaluated at a time.
+		static void sinCos(const float *radians, float *sines, float *cosines, size_t count);
+
+		/// Selects the backend of sin(), cos(), sinDeg(), cosDeg() and sinCos(). When false, the C library's single precision
+		/// sin and cos are called. When true, the angle is reduced to [-pi/4, pi/4] and a minimax polynomial is evaluated in single precision,
+		/// with a largest absolute error of 1e-7 for |radians| <= 8192. Larger angles fall back to the C library. Defaults to
+		/// true if SPINE_FAST_TRIG is defined, else false.
+		static void setFastTrig(bool fastTrig);
+
+		static bool isFastTrig();
+
 		/// Returns atan2 in radians, faster but less accurate than Math.Atan2. Average error of 0.00231 radians (0.1323
 		/// degrees), largest error of 0.00488 radians (0.2796 degrees).
 		static float atan2(float y, float x);
@@ -0,0 +1,100 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated April 5, 2025. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2025, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_NameIndex_h
+#define Spine_NameIndex_h
+
+#include <spine/HashMap.h>
+#include <spine/SpineObject.h>
+#include <spine/SpineString.h>
+#include <spine/Vector.h>
+
+namespace spine {
+	/// Hashed name to index lookup for a vector of named items, see SkeletonData::buildNameIndex().
+	/// Keys point at the item names, so the index is only valid as long as the items it was built from.
+	class SP_API NameIndex : public SpineObject {
+	public:
+		NameIndex() : _count(0) {
+		}
+
+		/// Indexes items by getName(). When several items share a name, the first one wins, same as ContainerUtil::findWithName.
+		template<typename T>
+		void build(Vector<T *> &items) {
+			_indices.clear();
+			_indices.reserve(items.size());
+			for (size_t i = items.size(); i > 0; i--) {
+				const String &name = items[i - 1]->getName();
+				_indices.put(Key(name.buffer(), name.length()), (int) (i - 1));
+			}
+			_count = items.size();
+		}
+
+		void clear() {
+			_indices.clear();
+			_count = 0;
+		}
+
+		/// True if the index was built from a vector of the given size. A size mismatch means items were added or removed since.
+		bool isValid(size_t itemCount) const {
+			return _count == itemCount && _count > 0;
+		}
+
+		/// @return -1 if no item has the name.
+		int find(const String &name) {
+			Key key(name.buffer(), name.length());
+			if (!_indices.containsKey(key)) return -1;
+			return _indices[key];
+		}
+
+	private:
+		class Key {
+		public:
+			Key(const char *chars, size_t length) : _chars(chars), _length(length) {
+			}
+
+			bool operator==(const Key &other) const {
+				return _length == other._length && (_chars == other._chars || (_chars && other._chars && !memcmp(_chars, other._chars, _length)));
+			}
+
+			const char *_chars;
+			size_t _length;
+		};
+
+		struct KeyHash {
+			size_t operator()(const Key &key) const {
+				return HashMapHash<String>::hashChars(key._chars, key._length);
+			}
+		};
+
+		HashMap<Key, int, KeyHash> _indices;
+		size_t _count;
+	};
+}
+
+#endif /* Spine_NameIndex_h */
@@ -48,6 +48,8 @@ namespace spine {
 	class SP_API PathConstraint : public Updatable {
 		friend class Skeleton;
 
+		friend class SkeletonInstance;
+
 		friend class PathConstraintMixTimeline;
 
 		friend class PathConstraintPositionTimeline;
@@ -97,6 +99,10 @@ namespace spine {
 
         void setToSetupPose();
 
+		/// Grows the scratch buffers so update() does not allocate for path attachments with up to the specified number of world
+		/// vertices. The buffers that depend only on the bone count are reserved by the constructor.
+		void reserve(size_t worldVerticesLength);
+
 	private:
 		static const float EPSILON;
 		static const int NONE;
@@ -45,6 +45,8 @@ namespace spine {
 
         friend class Skeleton;
 
+        friend class SkeletonInstance;
+
         friend class PhysicsConstraintTimeline;
 
         friend class PhysicsConstraintInertiaTimeline;
@@ -159,6 +161,8 @@ namespace spine {
         void rotate(float x, float y, float degrees);
 
     private:
+        float getDampingPower(float step);
+
         PhysicsConstraintData& _data;
         Bone* _bone;
 
@@ -191,6 +195,10 @@ namespace spine {
         Skeleton& _skeleton;
         float _remaining;
         float _lastTime;
+
+        float _powDamping;
+        float _powStep;
+        float _dampingPower;
     };
 }
 
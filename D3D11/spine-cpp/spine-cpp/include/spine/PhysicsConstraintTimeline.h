@@ -269,6 +269,7 @@ namespace spine {
 
     public:
         explicit PhysicsConstraintResetTimeline(size_t frameCount, int physicsConstraintIndex): Timeline(frameCount, 1), _constraintIndex(physicsConstraintIndex) {
+            _type = TimelineType_PhysicsConstraintReset;
             PropertyId ids[] = {((PropertyId)Property_PhysicsConstraintReset) << 32};
             setPropertyIds(ids, 1);
         }
@@ -280,6 +281,8 @@ namespace spine {
         void setFrame(int frame, float time) {
             _frames[frame] = time;
         }
+
+        int getPhysicsConstraintIndex() { return _constraintIndex; }
     private:
         int _constraintIndex;
     };
@@ -41,9 +41,19 @@ namespace spine {
 
 		const char *getClassName() const;
 
-		bool isExactly(const RTTI &rtti) const;
+		/// Identity is the address of the static rtti object, so this is a single pointer compare.
+		bool isExactly(const RTTI &rtti) const {
+			return this == &rtti;
+		}
 
-		bool instanceOf(const RTTI &rtti) const;
+		bool instanceOf(const RTTI &rtti) const {
+			const RTTI *pCompare = this;
+			while (pCompare) {
+				if (pCompare == &rtti) return true;
+				pCompare = pCompare->_pBaseRTTI;
+			}
+			return false;
+		}
 
 	private:
 		// Prevent copying
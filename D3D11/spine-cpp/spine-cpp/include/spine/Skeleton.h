@@ -36,6 +36,7 @@
 #include <spine/SpineString.h>
 #include <spine/Color.h>
 #include <spine/Physics.h>
+#include <spine/VertexSkinning.h>
 
 namespace spine {
 	class SkeletonData;
@@ -63,6 +64,8 @@ namespace spine {
 	class SP_API Skeleton : public SpineObject {
 		friend class AnimationState;
 
+		friend class Bone;
+
 		friend class SkeletonBounds;
 
 		friend class SkeletonClipping;
@@ -117,9 +120,18 @@ namespace spine {
 
 		friend class TwoColorTimeline;
 
+		friend class SkeletonInstance;
+
+		friend class PhysicsConstraint;
+
 	public:
 		explicit Skeleton(SkeletonData *skeletonData);
 
+		/// @param compactPose If true, all bones are constructed in one contiguous block in parent first order instead of being
+		/// allocated separately, so updateWorldTransform() walks their local and world transforms sequentially. Useful when many
+		/// skeleton instances are updated each frame.
+		Skeleton(SkeletonData *skeletonData, bool compactPose);
+
 		~Skeleton();
 
 		/// Caches information about bones and constraints. Must be called if bones, constraints or weighted path attachments are added
@@ -130,15 +142,33 @@ namespace spine {
 
         /// Updates the world transform for each bone and applies all constraints.
         ///
+        /// A bone's world transform is only recomputed if its applied transform differs from its local transform, its parent
+        /// was recomputed, or its world transform was modified since, eg by a constraint or Bone::setA(). Unchanged subtrees
+        /// keep the world transforms from the previous call.
+        ///
         /// See [World transforms](http://esotericsoftware.com/spine-runtime-skeletons#World-transforms) in the Spine
         /// Runtimes Guide.
 		void updateWorldTransform(Physics physics);
 
 		void updateWorldTransform(Physics physics, Bone *parent);
 
+		/// Copies the bones' world matrices into the snapshot used to skin weighted attachments. Not needed normally: changing a
+		/// bone's world transform invalidates the snapshot and the next weighted attachment computing world vertices refreshes it.
+		void updateBoneMatrices();
+
+		BoneMatrices &getBoneMatrices();
+
+		/// The number of bones whose world transform was recomputed by the last updateWorldTransform(Physics), not counting
+		/// bones updated by constraints.
+		size_t getUpdatedBoneCount();
+
 		/// Sets the bones, constraints, and slots to their setup pose values.
 		void setToSetupPose();
 
+		/// Reserves the deform of every slot keyed by a deform timeline of the data's animations, so applying them does not
+		/// allocate.
+		void reserveDeform();
+
 		/// Sets the bones and constraints to their setup pose values.
 		void setBonesToSetupPose();
 
@@ -199,7 +229,11 @@ namespace spine {
 
 		Vector<Bone *> &getBones();
 
-		Vector<Updatable *> &getUpdateCacheList();
+		/// The bones and constraints in update order. Read only, call updateCache() to rebuild it.
+		const Vector<Updatable *> &getUpdateCacheList();
+
+		/// True if the bones are stored in one contiguous block, see Skeleton(SkeletonData *, bool).
+		bool isCompactPose();
 
 		Vector<Slot *> &getSlots();
 
@@ -241,6 +275,20 @@ namespace spine {
 
         void update(float delta);
 
+		/// The maximum number of substeps each physics constraint may take per updateWorldTransform(Physics). Time beyond
+		/// that is dropped, so after a long frame physics runs slower than real time instead of making the next frame longer
+		/// too. 0 (the default) is unlimited.
+		void setPhysicsMaxSteps(int steps);
+
+		int getPhysicsMaxSteps();
+
+		/// The number of substeps taken by all physics constraints during the last updateWorldTransform(Physics).
+		int getPhysicsSteps();
+
+		/// The most time in seconds any physics constraint dropped during the last updateWorldTransform(Physics) because of
+		/// setPhysicsMaxSteps(int).
+		float getPhysicsTimeDropped();
+
         /// Rotates the physics constraint so next {@link #update(Physics)} forces are applied as if the bone rotated around the
 	    /// specified point in world space.
         void physicsTranslate(float x, float y);
@@ -258,11 +306,19 @@ namespace spine {
 		Vector<PathConstraint *> _pathConstraints;
         Vector<PhysicsConstraint *> _physicsConstraints;
 		Vector<Updatable *> _updateCache;
+		Vector<Bone *> _updateCacheBones;
+		Bone *_compactBones;
+		BoneMatrices _boneMatrices;
 		Skin *_skin;
 		Color _color;
 		float _scaleX, _scaleY;
 		float _x, _y;
         float _time;
+		float _appliedX, _appliedY, _appliedScaleX, _appliedScaleY;
+		size_t _updatedBoneCount;
+		int _physicsMaxSteps;
+		int _physicsSteps;
+		float _physicsTimeDropped;
 
 		void sortIkConstraint(IkConstraint *constraint);
 
@@ -278,6 +334,12 @@ namespace spine {
 
 		void sortBone(Bone *bone);
 
+		void init(bool compactPose);
+
+		void updateCacheBones();
+
+		void invalidateConstrainedBones(Updatable *constraint);
+
 		static void sortReset(Vector<Bone *> &bones);
 	};
 }
@@ -0,0 +1,186 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated April 5, 2025. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2025, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_SkeletonBaked_h
+#define Spine_SkeletonBaked_h
+
+#include <spine/Vector.h>
+#include <spine/SpineObject.h>
+#include <spine/SpineString.h>
+#include <spine/Color.h>
+
+namespace spine {
+	class SkeletonData;
+
+	class Atlas;
+
+	class AttachmentLoader;
+
+	class Skin;
+
+	class Attachment;
+
+	class MeshAttachment;
+
+	class VertexAttachment;
+
+	class Animation;
+
+	class Timeline;
+
+	class Sequence;
+
+	class BoneData;
+
+	class ConstraintData;
+
+	/// Loads skeleton data from the baked format written by SkeletonBaker.
+	///
+	/// A baked file is a fully resolved SkeletonData: curves are already expanded to their bezier segments and every
+	/// timeline, vertex and UV array is stored as a flat, 4 byte aligned native array, so loading is a sequence of
+	/// bulk copies rather than per value decoding. Data is stored in the byte order and at the scale it was baked with.
+	class SP_API SkeletonBaked : public SpineObject {
+	public:
+		/// "SPBK" read as a little endian int.
+		static const int MAGIC = 0x4b425053;
+		static const int FORMAT_VERSION = 1;
+		static const int ENDIAN_MARK = 0x01020304;
+
+		static const int CONSTRAINT_IK = 0;
+		static const int CONSTRAINT_TRANSFORM = 1;
+		static const int CONSTRAINT_PATH = 2;
+		static const int CONSTRAINT_PHYSICS = 3;
+
+		static const int PHYSICS_INERTIA = 0;
+		static const int PHYSICS_STRENGTH = 1;
+		static const int PHYSICS_DAMPING = 2;
+		static const int PHYSICS_MASS = 3;
+		static const int PHYSICS_WIND = 4;
+		static const int PHYSICS_GRAVITY = 5;
+		static const int PHYSICS_MIX = 6;
+
+		explicit SkeletonBaked(Atlas *atlas);
+
+		explicit SkeletonBaked(AttachmentLoader *attachmentLoader, bool ownsLoader = false);
+
+		~SkeletonBaked();
+
+		/// Returns true if the data starts with a baked header, so callers can pick a loader by content.
+		static bool isBaked(const unsigned char *data, int length);
+
+		SkeletonData *readSkeletonData(const unsigned char *data, int length);
+
+		SkeletonData *readSkeletonDataFile(const String &path);
+
+		String &getError() { return _error; }
+
+	private:
+		struct DataInput : public SpineObject {
+			const unsigned char *cursor;
+			const unsigned char *end;
+			bool overflow;
+		};
+
+		struct LinkedMeshRef {
+			MeshAttachment *mesh;
+			int skinIndex;
+			int slotIndex;
+			String parent;
+			bool inheritTimeline;
+		};
+
+		AttachmentLoader *_attachmentLoader;
+		Vector<LinkedMeshRef> _linkedMeshes;
+		String _error;
+		const bool _ownsLoader;
+
+		void setError(const char *value1, const char *value2);
+
+		/// Stops reading corrupt data, the first error is kept.
+		void setInvalid(DataInput *input);
+
+		SkeletonData *readFailed(SkeletonData *skeletonData);
+
+		int readInt(DataInput *input);
+
+		/// Reads an item count, which must fit in the remaining input.
+		int readCount(DataInput *input);
+
+		/// Reads an index below count. Returns 0 for corrupt data.
+		int readIndex(DataInput *input, size_t count);
+
+		/// Reads an index into items, which must be in range. Returns NULL for corrupt data.
+		template<typename T>
+		T *readReference(DataInput *input, Vector<T *> &items) {
+			return readReference(input, items, readInt(input));
+		}
+
+		template<typename T>
+		T *readReference(DataInput *input, Vector<T *> &items, int index) {
+			if (index >= 0 && index < (int) items.size() && items[index]) return items[index];
+			setInvalid(input);
+			return NULL;
+		}
+
+		float readFloat(DataInput *input);
+
+		bool readBoolean(DataInput *input);
+
+		void readString(DataInput *input, String &string);
+
+		/// Reads a string that must not be empty. Returns false for corrupt data.
+		bool readName(DataInput *input, String &string);
+
+		void readColor(DataInput *input, Color &color);
+
+		const unsigned char *readBlock(DataInput *input, size_t count, size_t size);
+
+		void readFloats(DataInput *input, Vector<float> &array);
+
+		void readInts(DataInput *input, Vector<int> &array);
+
+		void readShorts(DataInput *input, Vector<unsigned short> &array);
+
+		Sequence *readSequence(DataInput *input);
+
+		Skin *readSkin(DataInput *input, SkeletonData *skeletonData);
+
+		Attachment *readAttachment(DataInput *input, Skin *skin, int slotIndex, const String &attachmentName, SkeletonData *skeletonData);
+
+		void validateVertices(DataInput *input, VertexAttachment *attachment, SkeletonData *skeletonData);
+
+		Attachment *readAttachmentRef(DataInput *input, SkeletonData *skeletonData);
+
+		Animation *readAnimation(DataInput *input, SkeletonData *skeletonData);
+
+		Timeline *readTimeline(DataInput *input, SkeletonData *skeletonData);
+	};
+}
+
+#endif /* Spine_SkeletonBaked_h */
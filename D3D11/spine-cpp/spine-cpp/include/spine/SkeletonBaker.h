@@ -0,0 +1,108 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated April 5, 2025. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2025, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_SkeletonBaker_h
+#define Spine_SkeletonBaker_h
+
+#include <spine/Vector.h>
+#include <spine/SpineObject.h>
+#include <spine/SpineString.h>
+#include <spine/Color.h>
+
+namespace spine {
+	class SkeletonData;
+
+	class Skin;
+
+	class Attachment;
+
+	class VertexAttachment;
+
+	class Animation;
+
+	class Timeline;
+
+	class Sequence;
+
+	/// Writes loaded skeleton data in the baked format read by SkeletonBaked. Bake offline from .skel or .json data
+	/// loaded at the scale the game uses.
+	class SP_API SkeletonBaker : public SpineObject {
+	public:
+		SkeletonBaker();
+
+		/// Replaces the contents of output with the baked data. Returns false and sets the error if the data references
+		/// something it does not contain.
+		bool write(SkeletonData &skeletonData, Vector<unsigned char> &output);
+
+		bool writeFile(SkeletonData &skeletonData, const String &path);
+
+		String &getError() { return _error; }
+
+	private:
+		Vector<unsigned char> *_output;
+		SkeletonData *_skeletonData;
+		String _error;
+
+		void setError(const char *value1, const char *value2);
+
+		void writeBytes(const void *bytes, size_t length);
+
+		void align();
+
+		void writeInt(int value);
+
+		void writeFloat(float value);
+
+		void writeBoolean(bool value);
+
+		void writeString(const String &string);
+
+		void writeColor(Color &color);
+
+		void writeFloats(Vector<float> &array);
+
+		void writeInts(Vector<int> &array);
+
+		void writeShorts(Vector<unsigned short> &array);
+
+		void writeSequence(Sequence *sequence);
+
+		bool writeSkin(Skin *skin);
+
+		bool writeAttachment(Attachment *attachment);
+
+		bool writeAttachmentRef(Attachment *attachment);
+
+		bool writeAnimation(Animation *animation);
+
+		bool writeTimeline(Timeline *timeline);
+	};
+}
+
+#endif /* Spine_SkeletonBaker_h */
@@ -0,0 +1,115 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated April 5, 2025. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2025, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_SkeletonBatch_h
+#define Spine_SkeletonBatch_h
+
+#include <spine/Physics.h>
+#include <spine/SpineObject.h>
+#include <spine/Vector.h>
+
+namespace spine {
+	class Skeleton;
+
+	class AnimationState;
+
+	class SkeletonBatch;
+
+	struct RenderCommand;
+
+	/// Receives the render commands of each instance, see SkeletonBatch::setListener().
+	class SP_API SkeletonBatchListener {
+	public:
+		virtual ~SkeletonBatchListener() {
+		}
+
+		/// Called on the thread that updated the instance, possibly concurrently for other instances. The commands are only valid
+		/// until this returns, copy what is needed.
+		/// @param thread The index of the calling thread, 0 is the thread that called SkeletonBatch::update().
+		virtual void rendered(SkeletonBatch &batch, size_t index, RenderCommand *commands, int thread) = 0;
+	};
+
+	/// Updates many independent skeleton instances per frame on a work-stealing thread pool. For each instance update() runs
+	/// AnimationState::update(), AnimationState::apply(), Skeleton::update(), Skeleton::updateWorldTransform() and, if a listener
+	/// is set, SkeletonRenderer::render(). Each instance is processed start to end by a single thread and each thread has its own
+	/// renderer and clipping scratch, so the results do not depend on the thread count or scheduling.
+	///
+	/// Instances may share SkeletonData and AnimationStateData, but not Skeleton or AnimationState. AnimationState listeners are
+	/// called on the worker threads. Sequence attachments switch the region of the attachment shared by all instances of a
+	/// SkeletonData, so instances using them are rendered one at a time.
+	class SP_API SkeletonBatch : public SpineObject {
+	public:
+		/// @param threadCount The number of threads including the one calling update(), 0 uses one per hardware thread.
+		explicit SkeletonBatch(int threadCount = 0);
+
+		~SkeletonBatch();
+
+		/// Adds an instance, the batch does not take ownership.
+		/// @param state May be NULL.
+		/// @return The index passed to the listener.
+		size_t add(Skeleton *skeleton, AnimationState *state);
+
+		void clear();
+
+		size_t size();
+
+		Skeleton *getSkeleton(size_t index);
+
+		AnimationState *getState(size_t index);
+
+		/// @param listener May be NULL to skip rendering.
+		void setListener(SkeletonBatchListener *listener);
+
+		int getThreadCount();
+
+		/// Updates all instances and returns once every instance is done.
+		void update(float delta, Physics physics = Physics_Update);
+
+	private:
+		SkeletonBatch(const SkeletonBatch &);
+
+		SkeletonBatch &operator=(const SkeletonBatch &);
+
+		struct Pool;
+
+		void updateInstance(size_t index, int thread);
+
+		void work(int thread);
+
+		Vector<Skeleton *> _skeletons;
+		Vector<AnimationState *> _states;
+		Vector<bool> _sequenced;
+		SkeletonBatchListener *_listener;
+		float _delta;
+		Physics _physics;
+		Pool *_pool;
+	};
+}
+
+#endif /* Spine_SkeletonBatch_h */
@@ -42,6 +42,10 @@ namespace spine {
 	public:
 		SkeletonClipping();
 
+		/// Grows the buffers so clipping attachments with up to clipVertexCount vertices, and clipping up to the specified number
+		/// of output vertices and triangle indices per attachment, does not allocate.
+		void reserve(size_t vertexCount, size_t indexCount, size_t clipVertexCount);
+
 		size_t clipStart(Slot &slot, ClippingAttachment *clip);
 
 		void clipEnd(Slot &slot);
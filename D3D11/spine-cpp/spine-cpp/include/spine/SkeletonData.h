@@ -30,6 +30,7 @@
 #ifndef Spine_SkeletonData_h
 #define Spine_SkeletonData_h
 
+#include <spine/NameIndex.h>
 #include <spine/Vector.h>
 #include <spine/SpineString.h>
 
@@ -65,7 +66,7 @@ namespace spine {
 
 		~SkeletonData();
 
-		/// Finds a bone by comparing each bone's name.
+		/// Finds a bone by comparing each bone's name, or through the name index if buildNameIndex() was called.
 		/// It is more efficient to cache the results of this method than to call it multiple times.
 		/// @return May be NULL.
 		BoneData *findBone(const String &boneName);
@@ -94,6 +95,35 @@ namespace spine {
         /// @return May be NULL.
         PhysicsConstraintData *findPhysicsConstraint(const String &constraintName);
 
+		/// Resolves a name once to an index that can be kept instead of the name. The index addresses both the
+		/// SkeletonData vector and the matching Skeleton vector, e.g. getBones()[index] on any Skeleton of this data.
+		/// @return -1 if not found.
+		int findBoneIndex(const String &boneName);
+
+		/// @return -1 if not found.
+		int findSlotIndex(const String &slotName);
+
+		/// @return -1 if not found.
+		int findIkConstraintIndex(const String &constraintName);
+
+		/// @return -1 if not found.
+		int findTransformConstraintIndex(const String &constraintName);
+
+		/// @return -1 if not found.
+		int findPathConstraintIndex(const String &constraintName);
+
+		/// @return -1 if not found.
+		int findPhysicsConstraintIndex(const String &constraintName);
+
+		/// Builds hashed name lookups for all find methods. SkeletonJson and SkeletonBinary call this once loading
+		/// finished. An index whose vector changed size since it was built is ignored and lookups fall back to
+		/// a linear scan, call this again after adding, removing or renaming items.
+		void buildNameIndex();
+
+		/// Packs the weighted vertex attachments of all skins for the SIMD skinning kernels, see
+		/// VertexAttachment::updateSkinningLayout(). SkeletonJson and SkeletonBinary call this once loading finished.
+		void buildSkinningLayouts();
+
 		const String &getName();
 
 		void setName(const String &inValue);
@@ -184,6 +214,8 @@ namespace spine {
 		String _version;
 		String _hash;
 		Vector<char *> _strings;
+		NameIndex _boneIndex, _slotIndex, _skinIndex, _eventIndex, _animationIndex;
+		NameIndex _ikConstraintIndex, _transformConstraintIndex, _pathConstraintIndex, _physicsConstraintIndex;
 
 		// Nonessential.
 		float _fps;
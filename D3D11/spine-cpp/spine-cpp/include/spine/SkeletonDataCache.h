@@ -0,0 +1,185 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated April 5, 2025. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2025, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_SkeletonDataCache_h
+#define Spine_SkeletonDataCache_h
+
+#include <spine/HashMap.h>
+#include <spine/SpineObject.h>
+#include <spine/SpineString.h>
+
+#include <mutex>
+
+namespace spine {
+	class AsyncLoad;
+
+	class Atlas;
+
+	class SkeletonData;
+
+	class TextureLoader;
+
+	/// Shares loaded skeleton data and atlases between everything showing the same rig, so each combination of files and scale
+	/// is parsed once. Entries are reference counted. Released entries stay cached for reuse, and the least recently used of them
+	/// are deleted once the estimated size of the cache exceeds the budget. Entries in use are never deleted, so the size may
+	/// exceed the budget.
+	///
+	/// Paths are compared after normalizing separators and "." and ".." segments, and case insensitively on Windows. Atlases are
+	/// shared by all skeleton data using the same atlas path.
+	///
+	/// Thread safe, a mutex serializes all methods, so a miss being read blocks other threads' acquire() and release().
+	/// Textures are created by the TextureLoader on the thread calling acquire() with a miss. To load off the thread owning the
+	/// graphics context, load with an AsyncLoader and pass the done load to acquire(AsyncLoad &).
+	class SP_API SkeletonDataCache : public SpineObject {
+	public:
+		struct AtlasEntry;
+
+		class SP_API Entry : public SpineObject {
+			friend class SkeletonDataCache;
+
+		public:
+			SkeletonData *getSkeletonData();
+
+			Atlas *getAtlas();
+
+			float getScale();
+
+			/// Not synchronized, only exact while no other thread acquires or releases the entry.
+			int getReferenceCount();
+
+			/// The estimated size of the skeleton data in bytes, see SkeletonDataCache::estimateSize().
+			size_t getSize();
+
+		private:
+			Entry(const String &key, AtlasEntry *atlas, SkeletonData *skeletonData, float scale);
+
+			~Entry();
+
+			String _key;
+			AtlasEntry *_atlas;
+			SkeletonData *_skeletonData;
+			float _scale;
+			int _references;
+			size_t _size;
+			size_t _lastUse;
+		};
+
+		/// @param textureLoader Used for all atlases, must outlive the cache.
+		/// @param budget The estimated size in bytes above which released entries are deleted.
+		explicit SkeletonDataCache(TextureLoader *textureLoader, size_t budget = 64 * 1024 * 1024);
+
+		/// Deletes all entries, including those still acquired.
+		~SkeletonDataCache();
+
+		/// Returns the cached entry for the files and scale, reading them on a miss. Call release() once done with it. Baked
+		/// skeleton data keeps the scale it was baked with and is only read with a scale of 1.
+		/// @return NULL if reading failed, see getError().
+		Entry *acquire(const String &atlasPath, const String &skeletonPath, float scale = 1);
+
+		/// Returns the cached entry for the files and scale of a done load, taking ownership of the load's atlas and skeleton
+		/// data so AsyncLoad::getAtlas() and getSkeletonData() return NULL afterward. If the entry is cached already, the loaded
+		/// copies are deleted. The loader should use the cache's texture loader. Call release() once done with the entry.
+		/// @return NULL if the load failed, see getError().
+		Entry *acquire(AsyncLoad &load);
+
+		/// Adds a reference to an acquired entry, which then needs one more release().
+		void retain(Entry *entry);
+
+		/// Removes a reference. The entry stays cached until it is evicted or acquired again.
+		void release(Entry *entry);
+
+		/// Deletes released entries that are over the budget.
+		void setBudget(size_t budget);
+
+		size_t getBudget();
+
+		/// The estimated size in bytes of all cached skeleton data and atlases, acquired or not.
+		size_t getSize();
+
+		/// The number of entries, acquired or not.
+		size_t getEntryCount();
+
+		/// The number of acquire() calls that found a cached entry.
+		size_t getHits();
+
+		/// The number of acquire() calls that read the files.
+		size_t getMisses();
+
+		/// The number of released entries deleted by the budget or clear().
+		size_t getEvictions();
+
+		void resetCounters();
+
+		/// Deletes all released entries.
+		void clear();
+
+		/// The error of the last failed acquire() on any thread.
+		String getError();
+
+		/// Estimates the heap memory used by skeleton data: the data objects, timeline frames and curves, attachment vertices, UVs
+		/// and triangles.
+		static size_t estimateSize(SkeletonData &skeletonData);
+
+		/// Estimates the memory used by an atlas, counting each page as width * height * 4 bytes of texture.
+		static size_t estimateSize(Atlas &atlas);
+
+	private:
+		SkeletonDataCache(const SkeletonDataCache &);
+
+		SkeletonDataCache &operator=(const SkeletonDataCache &);
+
+		Entry *add(const String &key, AtlasEntry *atlas, SkeletonData *skeletonData, float scale);
+
+		Entry *use(Entry *entry);
+
+		AtlasEntry *acquireAtlas(const String &path);
+
+		AtlasEntry *adoptAtlas(const String &path, Atlas *atlas);
+
+		void releaseAtlas(AtlasEntry *atlas);
+
+		void evict(size_t budget);
+
+		void remove(Entry *entry);
+
+		TextureLoader *_textureLoader;
+		HashMap<String, Entry *> _entries;
+		HashMap<String, AtlasEntry *> _atlases;
+		size_t _budget;
+		size_t _size;
+		size_t _clock;
+		size_t _hits;
+		size_t _misses;
+		size_t _evictions;
+		String _error;
+		std::mutex _mutex;
+	};
+}
+
+#endif /* Spine_SkeletonDataCache_h */
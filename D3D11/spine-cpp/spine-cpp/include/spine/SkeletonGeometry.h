@@ -0,0 +1,93 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated April 5, 2025. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2025, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_SkeletonGeometry_h
+#define Spine_SkeletonGeometry_h
+
+#include <spine/SkeletonRenderer.h>
+#include <spine/Vector.h>
+
+namespace spine {
+	class Skeleton;
+
+	/// Consecutive indices drawn with one texture and blend mode. Indices are relative to vertexStart, so a draw is
+	/// DrawIndexed(indexCount, indexStart, vertexStart) or its equivalent. Colors the layout leaves out are the same for the
+	/// whole range, in color and darkColor as in RenderCommand.
+	struct SP_API DrawRange {
+		void *texture;
+		BlendMode blendMode;
+		uint32_t color;
+		uint32_t darkColor;
+		int32_t vertexStart;
+		int32_t vertexCount;
+		int32_t indexStart;
+		int32_t indexCount;
+	};
+
+	/// Builds one contiguous interleaved vertex array, one index array and a list of draw ranges for a skeleton each frame,
+	/// so a backend can upload the geometry with a single map of a vertex and an index buffer. Adjacent render commands with
+	/// the same texture, blend mode and colors the layout leaves out share a draw range. The arrays grow to the largest frame built and are kept.
+	class SP_API SkeletonGeometry : public SpineObject {
+	public:
+		explicit SkeletonGeometry(const VertexLayout &layout);
+
+		~SkeletonGeometry();
+
+		void build(Skeleton &skeleton);
+
+		const VertexLayout &getLayout();
+
+		/// The vertices of the last build, getVertexCount() * getLayout().stride bytes.
+		void *getVertices();
+
+		size_t getVertexCount();
+
+		uint16_t *getIndices();
+
+		size_t getIndexCount();
+
+		Vector<DrawRange> &getDrawRanges();
+
+		/// The renderer the geometry is built with, eg to reserve memory.
+		SkeletonRenderer &getRenderer();
+
+	private:
+		SkeletonGeometry(const SkeletonGeometry &);
+
+		VertexLayout _layout;
+		SkeletonRenderer _renderer;
+		Vector<uint8_t> _vertices;
+		Vector<uint16_t> _indices;
+		size_t _vertexCount;
+		size_t _indexCount;
+		Vector<DrawRange> _drawRanges;
+	};
+}
+
+#endif /* Spine_SkeletonGeometry_h */
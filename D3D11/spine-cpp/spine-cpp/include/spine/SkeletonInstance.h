@@ -0,0 +1,122 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated April 5, 2025. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2025, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_SkeletonInstance_h
+#define Spine_SkeletonInstance_h
+
+#include <spine/Color.h>
+#include <spine/SpineObject.h>
+
+namespace spine {
+	class SkeletonData;
+
+	class Skeleton;
+
+	class Skin;
+
+	/// The mutable pose of a skeleton without its bone, slot and constraint objects, for large numbers of instances of the same
+	/// SkeletonData. It holds bone local transforms, slot colors, attachments, sequence indices and deform, the draw order,
+	/// constraint mixes and physics state, and the skeleton's skin, position, scale, color and time, all in a single allocation.
+	/// Names, hierarchy, constraint targets and everything else immutable is read from the SkeletonData.
+	///
+	/// Instances are posed through a full Skeleton of the same data, shared by all of them:
+	///
+	///     instance.load(skeleton);
+	///     animation->apply(skeleton, lastTime, time, true, NULL, 1, MixBlend_Replace, MixDirection_In);
+	///     skeleton.updateWorldTransform(Physics_Update);
+	///     // render skeleton
+	///     instance.store(skeleton);
+	///
+	/// Deform is kept for the slots that deform timelines of the data key, other deform is dropped by store().
+	class SP_API SkeletonInstance : public SpineObject {
+	public:
+		/// Creates an instance in the setup pose.
+		explicit SkeletonInstance(SkeletonData *data);
+
+		/// Copies another instance of the same data, which is a single allocation and copy. Faster than creating an instance
+		/// from the data when spawning many.
+		SkeletonInstance(const SkeletonInstance &other);
+
+		~SkeletonInstance();
+
+		SkeletonData *getData();
+
+		/// Copies the pose of the skeleton, which must be of the same data, into this instance.
+		void store(Skeleton &skeleton);
+
+		/// Copies this pose into the skeleton, which must be of the same data. World transforms are not computed.
+		void load(Skeleton &skeleton);
+
+		void setToSetupPose();
+
+		Skin *getSkin();
+
+		/// Sets the skin without changing attachments. Call setToSetupPose() afterward to use the skin's setup attachments.
+		void setSkin(Skin *skin);
+
+		float getX();
+
+		void setX(float inValue);
+
+		float getY();
+
+		void setY(float inValue);
+
+		void setPosition(float x, float y);
+
+		float getScaleX();
+
+		void setScaleX(float inValue);
+
+		float getScaleY();
+
+		void setScaleY(float inValue);
+
+		Color &getColor();
+
+		float getTime();
+
+		void setTime(float time);
+
+		/// The size in bytes of the pose allocation.
+		size_t getSize();
+
+	private:
+		SkeletonInstance &operator=(const SkeletonInstance &);
+
+		struct Header;
+
+		Header &header() const;
+
+		SkeletonData *_data;
+		char *_pose;
+	};
+}
+
+#endif /* Spine_SkeletonInstance_h */
@@ -73,6 +73,9 @@ namespace spine {
 
 		SkeletonData *readSkeletonData(const char *json);
 
+		/// As readSkeletonData(const char *), for JSON that is not NUL terminated.
+		SkeletonData *readSkeletonData(const char *json, int length);
+
 		void setScale(float scale) { _scale = scale; }
 
 		String &getError() { return _error; }
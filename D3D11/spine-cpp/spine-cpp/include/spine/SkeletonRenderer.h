@@ -48,6 +48,56 @@ namespace spine {
         BlendMode blendMode;
         void *texture;
         RenderCommand *next;
+        /// Interleaved rendering only: the command's first vertex in the vertex buffer and the index of that vertex and of
+        /// the command's first index in their buffers. Indices are relative to vertexStart. NULL and 0 otherwise.
+        void *vertices;
+        int32_t vertexStart;
+        int32_t indexStart;
+        /// Interleaved rendering with 32 bit indices only: the command's indices, indices is NULL then. NULL otherwise.
+        uint32_t *indices32;
+        /// Interleaved rendering only: the color and dark color in the layout's color format. For colors the layout leaves
+        /// out, commands are split so this is the color of all their vertices, which the backend sets per draw, eg in a
+        /// shader constant. 0 otherwise.
+        uint32_t color;
+        uint32_t darkColor;
+    };
+
+    enum VertexColorFormat {
+        /// 0xAARRGGBB, the packing of RenderCommand colors.
+        VertexColorFormat_ARGB = 0,
+        /// 0xAABBGGRR, bytes in R, G, B, A order in memory on little endian machines, eg DXGI_FORMAT_R8G8B8A8_UNORM.
+        VertexColorFormat_ABGR
+    };
+
+    /// Describes an interleaved vertex with two float position and uv components and optional 32 bit colors. Offsets and
+    /// the stride are in bytes and must be multiples of 4. A negative color or dark color offset leaves it out of the
+    /// vertices, RenderCommand color or darkColor has it per command then.
+    struct SP_API VertexLayout {
+        int32_t stride;
+        int32_t position;
+        int32_t uv;
+        int32_t color;
+        int32_t darkColor;
+        VertexColorFormat colorFormat;
+
+        VertexLayout(int32_t stride, int32_t position, int32_t uv, int32_t color = -1, int32_t darkColor = -1,
+                     VertexColorFormat colorFormat = VertexColorFormat_ARGB) : stride(stride), position(position), uv(uv),
+                     color(color), darkColor(darkColor), colorFormat(colorFormat) {
+        }
+    };
+
+    /// A skeleton rendered by the multi skeleton render(), with an affine transform applied to its world vertices, a world
+    /// vertex (vx, vy) is drawn at (a * vx + b * vy + x, c * vx + d * vy + y). The default is the identity.
+    struct SP_API RenderInstance {
+        Skeleton *skeleton;
+        float a, b, c, d, x, y;
+
+        RenderInstance() : skeleton(NULL), a(1), b(0), c(0), d(1), x(0), y(0) {
+        }
+
+        RenderInstance(Skeleton &skeleton, float a = 1, float b = 0, float c = 0, float d = 1, float x = 0, float y = 0) :
+                skeleton(&skeleton), a(a), b(b), c(c), d(d), x(x), y(y) {
+        }
     };
 
     class SP_API SkeletonRenderer: public SpineObject {
@@ -57,12 +107,58 @@ namespace spine {
         ~SkeletonRenderer();
 
         RenderCommand *render(Skeleton &skeleton);
+
+        /// Renders the skeleton in a single pass straight into a caller supplied interleaved vertex buffer, eg a mapped
+        /// upload buffer, without intermediate copies. Commands are batched as for render(Skeleton &), except that colors
+        /// the layout has per vertex do not split them, and their vertices are consecutive in the buffer. Colors the layout
+        /// leaves out are in RenderCommand color and darkColor. Indices go to the
+        /// index buffer or, if it is NULL, to memory owned by the renderer. Returns NULL if nothing is drawn or the
+        /// capacities, in vertices and indices, are too small; getVertexCount() and getIndexCount() give the required sizes.
+        RenderCommand *render(Skeleton &skeleton, const VertexLayout &layout, void *vertices, size_t vertexCapacity,
+                              uint16_t *indices = NULL, size_t indexCapacity = 0);
+
+        /// Renders the skeletons one after another, each in its draw order, into one interleaved vertex buffer as the single
+        /// skeleton render() does. Batches continue across skeletons, so instances sharing an atlas page and blend mode are
+        /// drawn with a single command.
+        RenderCommand *render(const RenderInstance *instances, size_t count, const VertexLayout &layout, void *vertices,
+                              size_t vertexCapacity, uint16_t *indices = NULL, size_t indexCapacity = 0);
+
+        /// Like the above with 32 bit indices in RenderCommand indices32, so batches are not split to keep vertex indices
+        /// below 0xffff. Use it when getVertexCount() of the 16 bit render is above that.
+        RenderCommand *render(const RenderInstance *instances, size_t count, const VertexLayout &layout, void *vertices,
+                              size_t vertexCapacity, uint32_t *indices, size_t indexCapacity = 0);
+
+        /// The number of vertices and indices of the last interleaved render.
+        size_t getVertexCount();
+
+        size_t getIndexCount();
+
+        /// The number of commands, ie draw calls, and the most vertices in one of them of the last interleaved render. Both
+        /// are 0 if it returned NULL. The average vertices per draw call is getVertexCount() / getDrawCallCount().
+        size_t getDrawCallCount();
+
+        size_t getMaxBatchVertices();
+
+        /// Reserves memory so render() does not allocate for skeletons with up to the specified number of vertices and
+        /// triangle indices in total, the specified number of slots and clipping attachments with up to clipVertexCount
+        /// vertices. Without this, the renderer grows to the largest frame it has rendered and stops allocating after that.
+        void reserve(size_t vertexCount, size_t indexCount, size_t slotCount, size_t clipVertexCount);
     private:
+        RenderCommand *renderInterleaved(const RenderInstance *instances, size_t count, const VertexLayout &layout,
+                                         void *vertices, size_t vertexCapacity, void *indices, size_t indexCapacity,
+                                         bool wideIndices);
+
         BlockAllocator _allocator;
         Vector<float> _worldVertices;
         Vector<unsigned short> _quadIndices;
         SkeletonClipping _clipping;
         Vector<RenderCommand *> _renderCommands;
+        Vector<uint16_t> _indices;
+        Vector<uint32_t> _indices32;
+        size_t _vertexCount;
+        size_t _indexCount;
+        size_t _drawCallCount;
+        size_t _maxBatchVertices;
     };
 }
 
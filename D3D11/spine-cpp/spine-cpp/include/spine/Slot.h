@@ -48,6 +48,8 @@ namespace spine {
 
 		friend class Skeleton;
 
+		friend class SkeletonInstance;
+
 		friend class SkeletonBounds;
 
 		friend class SkeletonClipping;
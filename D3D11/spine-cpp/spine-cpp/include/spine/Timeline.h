@@ -36,6 +36,7 @@
 #include <spine/MixDirection.h>
 #include <spine/SpineObject.h>
 #include <spine/Property.h>
+#include <spine/TimelineType.h>
 
 namespace spine {
 	class Skeleton;
@@ -74,12 +75,16 @@ namespace spine {
 
 		virtual Vector <PropertyId> &getPropertyIds();
 
+		/// The concrete timeline type, for switch based dispatch without going through getRTTI().
+		TimelineType getType() const { return _type; }
+
 	protected:
 		void setPropertyIds(PropertyId propertyIds[], size_t propertyIdsCount);
 
         Vector <PropertyId> _propertyIds;
 		Vector<float> _frames;
 		size_t _frameEntries;
+		TimelineType _type;
 	};
 }
 
@@ -38,6 +38,10 @@ namespace spine {
 	public:
 		~Triangulator();
 
+		/// Grows the buffers and fills the polygon pools so triangulating and decomposing polygons with up to the specified number
+		/// of vertices does not allocate.
+		void reserve(size_t vertexCount);
+
 		Vector<int> &triangulate(Vector<float> &vertices);
 
 		Vector<Vector < float>* > &
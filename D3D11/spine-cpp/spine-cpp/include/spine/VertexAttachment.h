@@ -33,6 +33,7 @@
 #include <spine/Attachment.h>
 
 #include <spine/Vector.h>
+#include <spine/VertexSkinning.h>
 
 namespace spine {
 	class Slot;
@@ -48,8 +49,11 @@ namespace spine {
 	RTTI_DECL
 
 	public:
+		/// For attachment classes other than the runtime's, getType() returns AttachmentType_Custom.
 		explicit VertexAttachment(const String &name);
 
+		VertexAttachment(const String &name, AttachmentType type);
+
 		virtual ~VertexAttachment();
 
 		void computeWorldVertices(Slot &slot, float *worldVertices);
@@ -71,10 +75,26 @@ namespace spine {
 		/// Gets a unique ID for this attachment.
 		int getId();
 
+		/// The bone count and bone indices of each vertex of a weighted attachment, else empty. Changing them in place needs
+		/// updateSkinningLayout() afterwards, else the SIMD skinning kernels keep using the old ones.
 		Vector<int> &getBones();
 
+		/// Copies the bones and rebuilds the skinning layout.
+		void setBones(Vector<int> &bones);
+
+		/// The x, y and weight of each bone influence of a weighted attachment, else the x and y of each vertex. Changing them in
+		/// place needs updateSkinningLayout() afterwards, else the SIMD skinning kernels keep using the old ones.
 		Vector<float> &getVertices();
 
+		/// Copies the vertices and rebuilds the skinning layout.
+		void setVertices(Vector<float> &vertices);
+
+		/// Repacks the bones and vertices of a weighted attachment for the SIMD skinning kernels. SkeletonData::buildSkinningLayouts()
+		/// calls this after loading, setBones(), setVertices() and copyTo() call it too.
+		void updateSkinningLayout();
+
+		SkinningLayout &getSkinningLayout();
+
 		size_t getWorldVerticesLength();
 
 		void setWorldVerticesLength(size_t inValue);
@@ -90,6 +110,7 @@ namespace spine {
 		Vector<float> _vertices;
 		size_t _worldVerticesLength;
 		Attachment *_timelineAttachment;
+		SkinningLayout _skinningLayout;
 
 	private:
 		const int _id;
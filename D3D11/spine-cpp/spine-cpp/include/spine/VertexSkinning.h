@@ -0,0 +1,160 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated April 5, 2025. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2025, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_VertexSkinning_h
+#define Spine_VertexSkinning_h
+
+#include <spine/SpineObject.h>
+#include <spine/Vector.h>
+
+namespace spine {
+	class Bone;
+
+	/// Packed copy of the bones' world matrices, indexed like Skeleton::getBones(). Each bone is one row of 8 floats: a, b, c, d,
+	/// worldX, worldY and 2 floats of padding, so a SIMD kernel loads a bone with one 32 byte load and transposes the rows of a
+	/// vertex batch into a, b, c, d, worldX and worldY lanes.
+	/// Skeleton::updateWorldTransform() and anything else changing a bone's world transform invalidate it. The first weighted
+	/// attachment computing world vertices afterwards refreshes it, so skeletons without weighted attachments never copy their bones.
+	class SP_API BoneMatrices : public SpineObject {
+	public:
+		static const int Stride = 8;
+
+		BoneMatrices();
+
+		~BoneMatrices();
+
+		/// Copies the world matrix of each bone and marks the snapshot valid.
+		void update(Vector<Bone *> &bones);
+
+		void invalidate() {
+			_valid = false;
+		}
+
+		bool isValid() const {
+			return _valid;
+		}
+
+		size_t size() const {
+			return _size;
+		}
+
+		const float *getMatrices() const {
+			return _buffer;
+		}
+
+	private:
+		BoneMatrices(const BoneMatrices &);
+
+		BoneMatrices &operator=(const BoneMatrices &);
+
+		float *_buffer;
+		size_t _size;
+		size_t _capacity;
+		bool _valid;
+	};
+
+	/// The weighted vertices of an attachment regrouped for the SIMD kernels. Vertices are packed in batches of BatchSize and each
+	/// batch has one row per influence: the n-th row holds the bone index, x, y, weight and deform index of the n-th influence of
+	/// every vertex in the batch. Lanes of vertices with fewer influences are padded.
+	class SP_API SkinningLayout : public SpineObject {
+		friend class VertexSkinning;
+
+	public:
+		static const int BatchSize = 8;
+
+		SkinningLayout();
+
+		/// Packs the attachment's bones and vertices, see VertexAttachment::getBones() and VertexAttachment::getVertices(). The
+		/// layout stays empty if the vertices do not hold 3 values per influence of the bones.
+		void build(Vector<int> &bones, Vector<float> &vertices);
+
+		void clear();
+
+		/// True if the layout was built from bones and vertices of the given lengths.
+		bool isValid(size_t bonesLength, size_t verticesLength) const {
+			return _vertexCount > 0 && _bonesLength == bonesLength && _verticesLength == verticesLength;
+		}
+
+		size_t getVertexCount() const {
+			return _vertexCount;
+		}
+
+	private:
+		SkinningLayout(const SkinningLayout &);
+
+		SkinningLayout &operator=(const SkinningLayout &);
+
+		Vector<int> _counts;
+		Vector<int> _rowStarts;
+		Vector<int> _rowBones;
+		Vector<int> _rowDeform;
+		Vector<float> _rowValues;
+		size_t _vertexCount;
+		size_t _bonesLength;
+		size_t _verticesLength;
+	};
+
+	enum SkinningKernel {
+		SkinningKernel_Scalar = 0,
+		SkinningKernel_Sse2,
+		SkinningKernel_Avx2
+	};
+
+	/// Batch kernels for weighted vertex attachments. The SSE2 and AVX2 kernels transform 4 and 8 vertices at a time, one vertex
+	/// per lane, and sum each vertex's bone influences in the same order as the scalar loop in VertexAttachment, so the results
+	/// match.
+	class SP_API VertexSkinning : public SpineObject {
+	private:
+		VertexSkinning();
+
+	public:
+		/// The best kernel the CPU supports, detected once.
+		static SkinningKernel getSupportedKernel();
+
+		/// The kernel used by computeWeighted(), the supported kernel unless overridden.
+		static SkinningKernel getKernel();
+
+		/// Overrides the kernel, eg to compare kernels. Kernels the CPU does not support fall back to the supported kernel. Not
+		/// thread safe, call before skinning starts.
+		static void setKernel(SkinningKernel kernel);
+
+		/// Computes world vertices for a weighted attachment.
+		/// @param firstVertex The index of the first vertex to transform.
+		/// @param deform The slot's deform. May be NULL.
+		/// @param vertexCount The number of vertices to transform.
+		/// @param worldVertices The output world vertices, x and y of the first vertex are written to index 0 and 1.
+		/// @param stride The number of worldVertices entries between the value pairs written.
+		/// @return False if the scalar kernel is selected or firstVertex does not start a batch, the caller transforms the
+		/// vertices itself then.
+		static bool computeWeighted(const BoneMatrices &matrices, SkinningLayout &layout, size_t firstVertex,
+									const float *deform, size_t vertexCount, float *worldVertices, size_t stride);
+	};
+}
+
+#endif /* Spine_VertexSkinning_h */
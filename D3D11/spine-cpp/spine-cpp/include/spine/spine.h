@@ -33,12 +33,15 @@
 #include <spine/Animation.h>
 #include <spine/AnimationState.h>
 #include <spine/AnimationStateData.h>
+#include <spine/ArenaAllocator.h>
+#include <spine/AsyncLoader.h>
 #include <spine/Atlas.h>
 #include <spine/AtlasAttachmentLoader.h>
 #include <spine/Attachment.h>
 #include <spine/AttachmentLoader.h>
 #include <spine/AttachmentTimeline.h>
 #include <spine/AttachmentType.h>
+#include <spine/BakedAnimation.h>
 #include <spine/BlendMode.h>
 #include <spine/Bone.h>
 #include <spine/BoneData.h>
@@ -68,6 +71,7 @@
 #include <spine/MeshAttachment.h>
 #include <spine/MixBlend.h>
 #include <spine/MixDirection.h>
+#include <spine/NameIndex.h>
 #include <spine/PathAttachment.h>
 #include <spine/PathConstraint.h>
 #include <spine/PathConstraintData.h>
@@ -88,10 +92,16 @@
 #include <spine/ScaleTimeline.h>
 #include <spine/ShearTimeline.h>
 #include <spine/Skeleton.h>
+#include <spine/SkeletonBaked.h>
+#include <spine/SkeletonBaker.h>
+#include <spine/SkeletonBatch.h>
 #include <spine/SkeletonBinary.h>
 #include <spine/SkeletonBounds.h>
 #include <spine/SkeletonClipping.h>
 #include <spine/SkeletonData.h>
+#include <spine/SkeletonDataCache.h>
+#include <spine/SkeletonGeometry.h>
+#include <spine/SkeletonInstance.h>
 #include <spine/SkeletonJson.h>
 #include <spine/SkeletonRenderer.h>
 #include <spine/Skin.h>
@@ -102,6 +112,7 @@
 #include <spine/SpineString.h>
 #include <spine/TextureLoader.h>
 #include <spine/Timeline.h>
+#include <spine/TimelineType.h>
 #include <spine/TransformConstraint.h>
 #include <spine/TransformConstraintData.h>
 #include <spine/TransformConstraintTimeline.h>
@@ -110,6 +121,7 @@
 #include <spine/Updatable.h>
 #include <spine/Vector.h>
 #include <spine/VertexAttachment.h>
+#include <spine/VertexSkinning.h>
 #include <spine/Vertices.h>
 
 #endif
@@ -43,8 +43,9 @@ Animation::Animation(const String &name, Vector<Timeline *> &timelines, float du
 																						  _duration(duration),
 																						  _name(name) {
 	assert(_name.length() > 0);
+	_timelineIds.reserve(timelines.size());
 	for (size_t i = 0; i < timelines.size(); i++) {
-		Vector<PropertyId> propertyIds = timelines[i]->getPropertyIds();
+		Vector<PropertyId> &propertyIds = timelines[i]->getPropertyIds();
 		for (size_t ii = 0; ii < propertyIds.size(); ii++)
 			_timelineIds.put(propertyIds[ii], true);
 	}
@@ -91,17 +92,67 @@ void Animation::setDuration(float inValue) {
 	_duration = inValue;
 }
 
+namespace {
+	// Frame index hint for the timeline being applied on this thread, see Animation::SearchCursorScope.
+	thread_local int *searchCursor = NULL;
+
+	// Frame counts up to this are scanned linearly, larger ones are binary searched.
+	const size_t LINEAR_SEARCH_FRAMES = 16;
+
+	// True if frame is the one search() returns: the last frame at or before target, or frame 0.
+	inline bool isSearchResult(const float *frames, size_t frameCount, size_t step, size_t frame, float target) {
+		return (frame == 0 || frames[frame * step] <= target) &&
+			   (frame + 1 >= frameCount || frames[(frame + 1) * step] > target);
+	}
+}
+
 int Animation::search(Vector<float> &frames, float target) {
-	size_t n = (int) frames.size();
-	for (size_t i = 1; i < n; i++) {
-		if (frames[i] > target) return (int) (i - 1);
+	return search(frames, target, 1);
+}
+
+int Animation::search(Vector<float> &values, float target, int step) {
+	const float *frames = values.buffer();
+	size_t frameCount = values.size() / step;
+	int *cursor = searchCursor;
+	if (cursor) {
+		// Monotonic playback stays on the cursor frame or moves to the next one.
+		size_t frame = (size_t) *cursor;
+		if (frame < frameCount) {
+			if (isSearchResult(frames, frameCount, step, frame, target)) return (int) (frame * step);
+			if (frame + 1 < frameCount && isSearchResult(frames, frameCount, step, frame + 1, target)) {
+				*cursor = (int) (frame + 1);
+				return (int) ((frame + 1) * step);
+			}
+		}
 	}
-	return (int) (n - 1);
+
+	// Finds the first frame after target, same as the linear scan even for NaN or duplicate keys.
+	size_t frame;
+	if (frameCount <= LINEAR_SEARCH_FRAMES) {
+		for (frame = 1; frame < frameCount; frame++)
+			if (frames[frame * step] > target) break;
+	} else {
+		size_t low = 1, high = frameCount;
+		while (low < high) {
+			size_t mid = (low + high) >> 1;
+			if (frames[mid * step] > target) high = mid;
+			else low = mid + 1;
+		}
+		frame = low;
+	}
+	frame--;
+	if (cursor) *cursor = (int) frame;
+	return (int) (frame * step);
+}
+
+Animation::SearchCursorScope::SearchCursorScope() : _previous(searchCursor) {
+	searchCursor = NULL;
+}
+
+Animation::SearchCursorScope::~SearchCursorScope() {
+	searchCursor = _previous;
 }
 
-int Animation::search(Vector<float> &frames, float target, int step) {
-	size_t n = frames.size();
-	for (size_t i = step; i < n; i += step)
-		if (frames[i] > target) return (int) (i - step);
-	return (int) (n - step);
+void Animation::SearchCursorScope::set(int *cursor) {
+	searchCursor = cursor;
 }
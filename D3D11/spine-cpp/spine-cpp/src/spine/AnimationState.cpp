@@ -31,6 +31,7 @@
 #include <spine/Animation.h>
 #include <spine/AnimationStateData.h>
 #include <spine/AttachmentTimeline.h>
+#include <spine/BakedAnimation.h>
 #include <spine/Bone.h>
 #include <spine/BoneData.h>
 #include <spine/DrawOrderTimeline.h>
@@ -53,9 +54,9 @@ void dummyOnAnimationEventFunc(AnimationState *state, spine::EventType type, Tra
 	SP_UNUSED(event);
 }
 
-TrackEntry::TrackEntry() : _animation(NULL), _previous(NULL), _next(NULL), _mixingFrom(NULL), _mixingTo(0),
+TrackEntry::TrackEntry() : _animation(NULL), _bakedAnimation(NULL), _previous(NULL), _next(NULL), _mixingFrom(NULL), _mixingTo(0),
 						   _trackIndex(0), _loop(false), _holdPrevious(false), _reverse(false),
-						   _shortestRotation(false),
+						   _shortestRotation(false), _keyframeCursors(true),
 						   _eventThreshold(0), _mixAttachmentThreshold(0), _alphaAttachmentThreshold(0), _mixDrawOrderThreshold(0), _animationStart(0),
 						   _animationEnd(0), _animationLast(0), _nextAnimationLast(0), _delay(0), _trackTime(0),
 						   _trackLast(0), _nextTrackLast(0), _trackEnd(0), _timeScale(1.0f), _alpha(0), _mixTime(0),
@@ -87,6 +88,17 @@ bool TrackEntry::getShortestRotation() { return _shortestRotation; }
 
 void TrackEntry::setShortestRotation(bool inValue) { _shortestRotation = inValue; }
 
+bool TrackEntry::getKeyframeCursors() { return _keyframeCursors; }
+
+void TrackEntry::setKeyframeCursors(bool inValue) { _keyframeCursors = inValue; }
+
+BakedAnimation *TrackEntry::getBakedAnimation() { return _bakedAnimation; }
+
+void TrackEntry::setBakedAnimation(BakedAnimation *inValue) {
+	assert(inValue == NULL || &inValue->getAnimation() == _animation);
+	_bakedAnimation = inValue;
+}
+
 float TrackEntry::getDelay() { return _delay; }
 
 void TrackEntry::setDelay(float inValue) { _delay = inValue; }
@@ -197,6 +209,7 @@ void TrackEntry::setListener(AnimationStateListenerObject *inValue) {
 
 void TrackEntry::reset() {
 	_animation = NULL;
+	_bakedAnimation = NULL;
 	_previous = NULL;
 	_next = NULL;
 	_mixingFrom = NULL;
@@ -207,6 +220,7 @@ void TrackEntry::reset() {
 	_timelineMode.clear();
 	_timelineHoldMix.clear();
 	_timelinesRotation.clear();
+	_timelineCursors.clear();
 
 	_listener = dummyOnAnimationEventFunc;
 	_listenerObject = NULL;
@@ -466,11 +480,17 @@ bool AnimationState::apply(Skeleton &skeleton) {
 		}
 		size_t timelineCount = current._animation->_timelines.size();
 		Vector<Timeline *> &timelines = current._animation->_timelines;
+		int *cursors = getTimelineCursors(current, timelineCount);
+		Animation::SearchCursorScope searchCursor;
+		BakedAnimation *baked = current._bakedAnimation;
 		if ((i == 0 && alpha == 1) || blend == MixBlend_Add) {
 			if (i == 0) attachments = true;
 			for (size_t ii = 0; ii < timelineCount; ++ii) {
 				Timeline *timeline = timelines[ii];
-				if (timeline->getRTTI().isExactly(AttachmentTimeline::rtti))
+				searchCursor.set(cursors ? cursors + ii : NULL);
+				if (baked && baked->isBaked(ii))
+					baked->apply(ii, skeleton, applyTime, alpha, blend, MixDirection_In);
+				else if (timeline->getType() == TimelineType_Attachment)
 					applyAttachmentTimeline(static_cast<AttachmentTimeline *>(timeline), skeleton, applyTime, blend,
 											attachments);
 				else
@@ -489,11 +509,14 @@ bool AnimationState::apply(Skeleton &skeleton) {
 				assert(timeline);
 
 				MixBlend timelineBlend = timelineMode[ii] == Subsequent ? blend : MixBlend_Setup;
+				searchCursor.set(cursors ? cursors + ii : NULL);
 
-				if (!shortestRotation && timeline->getRTTI().isExactly(RotateTimeline::rtti))
+				if (!shortestRotation && timeline->getType() == TimelineType_Rotate)
 					applyRotateTimeline(static_cast<RotateTimeline *>(timeline), skeleton, applyTime, alpha,
-										timelineBlend, timelinesRotation, ii << 1, firstFrame);
-				else if (timeline->getRTTI().isExactly(AttachmentTimeline::rtti))
+										timelineBlend, timelinesRotation, ii << 1, firstFrame, baked);
+				else if (baked && baked->isBaked(ii))
+					baked->apply(ii, skeleton, applyTime, alpha, timelineBlend, MixDirection_In);
+				else if (timeline->getType() == TimelineType_Attachment)
 					applyAttachmentTimeline(static_cast<AttachmentTimeline *>(timeline), skeleton, applyTime,
 											blend, attachments);
 				else
@@ -523,6 +546,36 @@ bool AnimationState::apply(Skeleton &skeleton) {
 	return applied;
 }
 
+void AnimationState::reserve(size_t trackEntryCount) {
+	Vector<Animation *> &animations = _data->getSkeletonData()->getAnimations();
+	size_t timelineCount = 0, propertyCount = 0, eventCount = 0;
+	for (size_t i = 0; i < animations.size(); ++i) {
+		Vector<Timeline *> &timelines = animations[i]->getTimelines();
+		if (timelines.size() > timelineCount) timelineCount = timelines.size();
+		for (size_t ii = 0; ii < timelines.size(); ++ii) {
+			propertyCount += timelines[ii]->getPropertyIds().size();
+			if (timelines[ii]->getRTTI().isExactly(EventTimeline::rtti)) eventCount += timelines[ii]->getFrameCount();
+		}
+	}
+	_propertyIDs.reserve(propertyCount);
+	_events.ensureCapacity(eventCount);
+	_queue->_eventQueueEntries.ensureCapacity(trackEntryCount * 4 + eventCount);
+
+	// Entries come back to the pool with their capacity, so growing them once covers any animation later.
+	Vector<TrackEntry *> entries;
+	entries.ensureCapacity(trackEntryCount);
+	for (size_t i = 0; i < trackEntryCount; ++i) {
+		TrackEntry *entry = _trackEntryPool.obtain();
+		entry->_timelineMode.ensureCapacity(timelineCount);
+		entry->_timelineHoldMix.ensureCapacity(timelineCount);
+		entry->_timelinesRotation.ensureCapacity(timelineCount << 1);
+		entry->_timelineCursors.ensureCapacity(timelineCount);
+		entries.add(entry);
+	}
+	for (size_t i = 0; i < entries.size(); ++i)
+		_trackEntryPool.free(entries[i]);
+}
+
 void AnimationState::clearTracks() {
 	bool oldDrainDisabled = _queue->_drainDisabled;
 	_queue->_drainDisabled = true;
@@ -727,11 +780,16 @@ void AnimationState::applyAttachmentTimeline(AttachmentTimeline *attachmentTimel
 
 
 void AnimationState::applyRotateTimeline(RotateTimeline *rotateTimeline, Skeleton &skeleton, float time, float alpha,
-										 MixBlend blend, Vector<float> &timelinesRotation, size_t i, bool firstFrame) {
+										 MixBlend blend, Vector<float> &timelinesRotation, size_t i, bool firstFrame,
+										 BakedAnimation *baked) {
 	if (firstFrame) timelinesRotation[i] = 0;
+	if (baked && !baked->isBaked(i >> 1)) baked = NULL;
 
 	if (alpha == 1) {
-		rotateTimeline->apply(skeleton, 0, time, NULL, 1, blend, MixDirection_In);
+		if (baked)
+			baked->apply(i >> 1, skeleton, time, 1, blend, MixDirection_In);
+		else
+			rotateTimeline->apply(skeleton, 0, time, NULL, 1, blend, MixDirection_In);
 		return;
 	}
 
@@ -751,7 +809,7 @@ void AnimationState::applyRotateTimeline(RotateTimeline *rotateTimeline, Skeleto
 		}
 	} else {
 		r1 = blend == MixBlend_Setup ? bone->_data._rotation : bone->_rotation;
-		r2 = bone->_data._rotation + rotateTimeline->getCurveValue(time);
+		r2 = baked ? baked->getValue(i >> 1, time) : bone->_data._rotation + rotateTimeline->getCurveValue(time);
 	}
 
 	// Mix between rotations using the direction of the shortest route on the first frame while detecting crosses.
@@ -848,9 +906,17 @@ float AnimationState::applyMixingFrom(TrackEntry *to, Skeleton &skeleton, MixBle
 		if (mix < from->_eventThreshold) events = &_events;
 	}
 
+	int *cursors = getTimelineCursors(*from, timelineCount);
+	Animation::SearchCursorScope searchCursor;
+	BakedAnimation *baked = from->_bakedAnimation;
 	if (blend == MixBlend_Add) {
-		for (size_t i = 0; i < timelineCount; i++)
-			timelines[i]->apply(skeleton, animationLast, applyTime, events, alphaMix, blend, MixDirection_Out);
+		for (size_t i = 0; i < timelineCount; i++) {
+			searchCursor.set(cursors ? cursors + i : NULL);
+			if (baked && baked->isBaked(i))
+				baked->apply(i, skeleton, applyTime, alphaMix, blend, MixDirection_Out);
+			else
+				timelines[i]->apply(skeleton, animationLast, applyTime, events, alphaMix, blend, MixDirection_Out);
+		}
 	} else {
 		Vector<int> &timelineMode = from->_timelineMode;
 		Vector<TrackEntry *> &timelineHoldMix = from->_timelineHoldMix;
@@ -869,7 +935,7 @@ float AnimationState::applyMixingFrom(TrackEntry *to, Skeleton &skeleton, MixBle
 			float alpha;
 			switch (timelineMode[i]) {
 				case Subsequent:
-					if (!drawOrder && (timeline->getRTTI().isExactly(DrawOrderTimeline::rtti))) continue;
+					if (!drawOrder && timeline->getType() == TimelineType_DrawOrder) continue;
 					timelineBlend = blend;
 					alpha = alphaMix;
 					break;
@@ -892,14 +958,17 @@ float AnimationState::applyMixingFrom(TrackEntry *to, Skeleton &skeleton, MixBle
 					break;
 			}
 			from->_totalAlpha += alpha;
-			if (!shortestRotation && (timeline->getRTTI().isExactly(RotateTimeline::rtti))) {
+			searchCursor.set(cursors ? cursors + i : NULL);
+			if (!shortestRotation && timeline->getType() == TimelineType_Rotate) {
 				applyRotateTimeline((RotateTimeline *) timeline, skeleton, applyTime, alpha, timelineBlend,
-									timelinesRotation, i << 1, firstFrame);
-			} else if (timeline->getRTTI().isExactly(AttachmentTimeline::rtti)) {
+									timelinesRotation, i << 1, firstFrame, baked);
+			} else if (baked && baked->isBaked(i)) {
+				baked->apply(i, skeleton, applyTime, alpha, timelineBlend, direction);
+			} else if (timeline->getType() == TimelineType_Attachment) {
 				applyAttachmentTimeline(static_cast<AttachmentTimeline *>(timeline), skeleton, applyTime, timelineBlend,
 										attachments && alpha >= from->_alphaAttachmentThreshold);
 			} else {
-				if (drawOrder && timeline->getRTTI().isExactly(DrawOrderTimeline::rtti) &&
+				if (drawOrder && timeline->getType() == TimelineType_DrawOrder &&
 					timelineBlend == MixBlend_Setup)
 					direction = MixDirection_In;
 				timeline->apply(skeleton, animationLast, applyTime, events, alpha, timelineBlend, direction);
@@ -918,6 +987,12 @@ float AnimationState::applyMixingFrom(TrackEntry *to, Skeleton &skeleton, MixBle
 	return mix;
 }
 
+int *AnimationState::getTimelineCursors(TrackEntry &entry, size_t timelineCount) {
+	if (!entry._keyframeCursors) return NULL;
+	if (entry._timelineCursors.size() != timelineCount) entry._timelineCursors.setSize(timelineCount, 0);
+	return entry._timelineCursors.buffer();
+}
+
 void AnimationState::setAttachment(Skeleton &skeleton, Slot &slot, const String &attachmentName, bool attachments) {
 	slot.setAttachment(
 			attachmentName.isEmpty() ? NULL : skeleton.getAttachment(slot.getData().getIndex(), attachmentName));
@@ -996,11 +1071,13 @@ TrackEntry *AnimationState::newTrackEntry(size_t trackIndex, Animation *animatio
 
 	entry._trackIndex = (int) trackIndex;
 	entry._animation = animation;
+	entry._bakedAnimation = NULL;
 	entry._loop = loop;
 	entry._holdPrevious = 0;
 
 	entry._reverse = false;
 	entry._shortestRotation = false;
+	entry._keyframeCursors = true;
 
 	entry._eventThreshold = 0;
 	entry._alphaAttachmentThreshold = 0;
@@ -1082,9 +1159,9 @@ continue_outer:
 		if (!_propertyIDs.addAll(ids, true)) {
 			timelineMode[i] = Subsequent;
 		} else {
-			if (to == NULL || timeline->getRTTI().isExactly(AttachmentTimeline::rtti) ||
-				timeline->getRTTI().isExactly(DrawOrderTimeline::rtti) ||
-				timeline->getRTTI().isExactly(EventTimeline::rtti) || !to->_animation->hasTimeline(ids)) {
+			if (to == NULL || timeline->getType() == TimelineType_Attachment ||
+				timeline->getType() == TimelineType_DrawOrder ||
+				timeline->getType() == TimelineType_Event || !to->_animation->hasTimeline(ids)) {
 				timelineMode[i] = First;
 			} else {
 				for (TrackEntry *next = to->_mixingTo; next != NULL; next = next->_mixingTo) {
@@ -0,0 +1,217 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated April 5, 2025. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2025, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/ArenaAllocator.h>
+
+#include <spine/Extension.h>
+
+#include <assert.h>
+#include <atomic>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace spine;
+
+namespace {
+	// Each allocation is preceded by a header holding its size, padded to keep the allocation 16 byte aligned.
+	const size_t HeaderSize = 16;
+
+	inline size_t align(size_t size) {
+		return (size + 15) & ~(size_t) 15;
+	}
+
+	thread_local ArenaScope *currentScope = NULL;
+
+	// Block memory is page aligned and whole pages are marked in a three level page map covering 48 bit addresses, so
+	// free() and realloc() recognize arena memory on any thread with a few atomic loads, without a lock or a search.
+	const size_t PageBits = 12, LevelBits = 12, AddressBits = PageBits + 3 * LevelBits;
+	const size_t PageSize = (size_t) 1 << PageBits, LevelSize = (size_t) 1 << LevelBits;
+
+	struct PageMapLeaf {
+		std::atomic<unsigned char> pages[LevelSize];
+	};
+
+	struct PageMapNode {
+		std::atomic<PageMapLeaf *> leaves[LevelSize];
+	};
+
+	std::atomic<PageMapNode *> pageMap[LevelSize];
+	std::atomic<size_t> registeredBlocks(0);
+
+	// Memory above the covered addresses, eg with 5 level paging, cannot be marked and is not used for blocks.
+	inline bool isMappable(uintptr_t address, size_t size) {
+		return AddressBits >= sizeof(uintptr_t) * 8 || (address + size) >> AddressBits == 0;
+	}
+
+	inline size_t levelIndex(uintptr_t address, size_t level) {
+		return (size_t) (address >> (PageBits + level * LevelBits)) & (LevelSize - 1);
+	}
+
+	// Map nodes are process wide and never freed. They come from the C heap, outside of the SpineExtension accounting.
+	template<typename T>
+	T *getOrCreate(std::atomic<T *> &slot) {
+		T *node = slot.load(std::memory_order_acquire);
+		if (node) return node;
+		T *created = (T *) ::calloc(1, sizeof(T));
+		if (slot.compare_exchange_strong(node, created, std::memory_order_acq_rel)) return created;
+		::free(created);
+		return node;
+	}
+
+	void markPages(const char *memory, size_t size, unsigned char value) {
+		for (uintptr_t address = (uintptr_t) memory, end = address + size; address < end; address += PageSize) {
+			PageMapNode *node = getOrCreate(pageMap[levelIndex(address, 2)]);
+			PageMapLeaf *leaf = getOrCreate(node->leaves[levelIndex(address, 1)]);
+			leaf->pages[levelIndex(address, 0)].store(value, std::memory_order_release);
+		}
+	}
+}
+
+ArenaAllocator::ArenaAllocator(size_t blockSize) : _first(NULL), _current(NULL), _blockSize(blockSize) {
+}
+
+ArenaAllocator::~ArenaAllocator() {
+	SpineExtension *extension = SpineExtension::getInstance();
+	for (Block *block = _first; block;) {
+		Block *next = block->next;
+		unregisterBlock(block);
+		extension->_free(block, __FILE__, __LINE__);
+		block = next;
+	}
+}
+
+void *ArenaAllocator::allocate(size_t size) {
+	if (size == 0) return NULL;
+	size_t needed = HeaderSize + align(size);
+	Block *block = _current;
+	while (block && block->size - block->used < needed)
+		block = block->next;
+	if (!block) {
+		// Blocks come straight from the instance, not through SpineExtension::alloc, which could route back to this arena.
+		// The memory starts on a page boundary and spans whole pages, so no page is shared with heap memory.
+		size_t blockSize = ((needed > _blockSize ? needed : _blockSize) + PageSize - 1) & ~(PageSize - 1);
+		SpineExtension *extension = SpineExtension::getInstance();
+		block = (Block *) extension->_alloc(align(sizeof(Block)) + PageSize - 1 + blockSize, __FILE__, __LINE__);
+		if (!block) return NULL;
+		uintptr_t memory = ((uintptr_t) block + align(sizeof(Block)) + PageSize - 1) & ~(uintptr_t) (PageSize - 1);
+		if (!isMappable(memory, blockSize)) {
+			extension->_free(block, __FILE__, __LINE__);
+			return NULL;
+		}
+		block->next = NULL;
+		block->memory = (char *) memory;
+		block->size = blockSize;
+		block->used = 0;
+		registerBlock(block);
+		if (_current) {
+			block->next = _current->next;
+			_current->next = block;
+		} else
+			_first = block;
+	}
+	_current = block;
+	char *header = block->memory + block->used;
+	block->used += needed;
+	*(size_t *) header = size;
+	return header + HeaderSize;
+}
+
+bool ArenaAllocator::owns(const void *ptr) const {
+	const char *p = (const char *) ptr;
+	for (Block *block = _first; block; block = block->next) {
+		if (p >= block->memory && p < block->memory + block->used) return true;
+		if (block == _current) break;
+	}
+	return false;
+}
+
+bool ArenaAllocator::isArenaMemory(const void *ptr) {
+	if (!ptr || registeredBlocks.load(std::memory_order_acquire) == 0) return false;
+	uintptr_t address = (uintptr_t) ptr;
+	if (!isMappable(address, 0)) return false;
+	PageMapNode *node = pageMap[levelIndex(address, 2)].load(std::memory_order_acquire);
+	if (!node) return false;
+	PageMapLeaf *leaf = node->leaves[levelIndex(address, 1)].load(std::memory_order_acquire);
+	return leaf && leaf->pages[levelIndex(address, 0)].load(std::memory_order_acquire) != 0;
+}
+
+size_t ArenaAllocator::getSize(const void *ptr) {
+	return *(const size_t *) ((const char *) ptr - HeaderSize);
+}
+
+void ArenaAllocator::registerBlock(Block *block) {
+	assert(isMappable((uintptr_t) block->memory, block->size));
+	markPages(block->memory, block->size, 1);
+	registeredBlocks.fetch_add(1, std::memory_order_release);
+}
+
+void ArenaAllocator::unregisterBlock(Block *block) {
+	markPages(block->memory, block->size, 0);
+	registeredBlocks.fetch_sub(1, std::memory_order_release);
+}
+
+void ArenaAllocator::reset() {
+	for (Block *block = _first; block; block = block->next)
+		block->used = 0;
+	_current = _first;
+}
+
+size_t ArenaAllocator::getUsed() const {
+	size_t used = 0;
+	for (Block *block = _first; block; block = block->next)
+		used += block->used;
+	return used;
+}
+
+size_t ArenaAllocator::getCapacity() const {
+	size_t capacity = 0;
+	for (Block *block = _first; block; block = block->next)
+		capacity += block->size;
+	return capacity;
+}
+
+ArenaScope::ArenaScope(ArenaAllocator &arena) : _arena(arena), _previous(currentScope) {
+	currentScope = this;
+}
+
+ArenaScope::~ArenaScope() {
+	currentScope = _previous;
+}
+
+ArenaScope *ArenaScope::getCurrent() {
+	return currentScope;
+}
+
+ArenaAllocator *ArenaScope::findOwner(const void *ptr) {
+	for (ArenaScope *scope = currentScope; scope; scope = scope->_previous) {
+		if (scope->_arena.owns(ptr)) return &scope->_arena;
+	}
+	return NULL;
+}
@@ -0,0 +1,338 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated April 5, 2025. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2025, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/AsyncLoader.h>
+
+#include <spine/Atlas.h>
+#include <spine/SkeletonBaked.h>
+#include <spine/SkeletonBinary.h>
+#include <spine/SkeletonData.h>
+#include <spine/SkeletonJson.h>
+
+#include <condition_variable>
+#include <mutex>
+#include <new>
+#include <thread>
+
+using namespace spine;
+
+namespace {
+	bool isJson(const String &path) {
+		size_t length = path.length();
+		return length >= 5 && !strcmp(path.buffer() + length - 5, ".json");
+	}
+}
+
+void DeferredTextureLoader::load(AtlasPage &page, const String &path) {
+	upload(page, path, decode(page, path));
+}
+
+AsyncLoad::AsyncLoad(const String &atlasPath, const String &skeletonPath, float scale) : _atlasPath(atlasPath),
+																						  _skeletonPath(skeletonPath),
+																						  _scale(scale),
+																						  _atlas(NULL),
+																						  _skeletonData(NULL),
+																						  _tasks(1),
+																						  _done(false) {
+}
+
+bool AsyncLoad::isDone() {
+	return _done;
+}
+
+const String &AsyncLoad::getAtlasPath() {
+	return _atlasPath;
+}
+
+float AsyncLoad::getScale() {
+	return _scale;
+}
+
+const String &AsyncLoad::getSkeletonPath() {
+	return _skeletonPath;
+}
+
+Atlas *AsyncLoad::getAtlas() {
+	return _atlas;
+}
+
+SkeletonData *AsyncLoad::getSkeletonData() {
+	return _skeletonData;
+}
+
+const String &AsyncLoad::getError() {
+	return _error;
+}
+
+/// A task reads the atlas and skeleton data of a load when page is -1, else decodes that page. A load is ready for update()
+/// once all of its tasks ran. All memory comes from the SpineExtension, only the threads' start up state is allocated by
+/// the standard library.
+struct AsyncLoader::Pool : public SpineObject {
+	struct Task {
+		AsyncLoad *load;
+		int page;
+	};
+
+	explicit Pool(int threadCount) : threadCount(threadCount), threads(NULL), threadsStarted(0), tasks(), nextTask(0),
+									 ready(), pending(0), quit(false) {
+		threads = SpineExtension::alloc<std::thread>(threadCount, __FILE__, __LINE__);
+	}
+
+	~Pool() {
+		for (int i = 0; i < threadsStarted; i++)
+			threads[i].~thread();
+		SpineExtension::free(threads, __FILE__, __LINE__);
+	}
+
+	bool hasTask() {
+		return nextTask < tasks.size();
+	}
+
+	/// Tasks run in the order they were queued. The queue is emptied once all ran, so its memory is reused.
+	Task nextQueued() {
+		Task task = tasks[nextTask++];
+		if (nextTask == tasks.size()) {
+			tasks.clear();
+			nextTask = 0;
+		}
+		return task;
+	}
+
+	int threadCount;
+	std::thread *threads;
+	int threadsStarted;
+	Vector<Task> tasks;
+	size_t nextTask;
+	Vector<AsyncLoad *> ready;
+	std::mutex mutex;
+	std::condition_variable work;
+	std::condition_variable changed;
+	int pending;
+	bool quit;
+};
+
+AsyncLoader::AsyncLoader(TextureLoader *textureLoader, int threadCount) : _textureLoader(textureLoader),
+																		  _deferredLoader(NULL),
+																		  _listener(NULL),
+																		  _pool(NULL) {
+	start(threadCount);
+}
+
+AsyncLoader::AsyncLoader(DeferredTextureLoader *textureLoader, int threadCount) : _textureLoader(textureLoader),
+																				  _deferredLoader(textureLoader),
+																				  _listener(NULL),
+																				  _pool(NULL) {
+	start(threadCount);
+}
+
+AsyncLoader::~AsyncLoader() {
+	finish();
+	{
+		std::lock_guard<std::mutex> lock(_pool->mutex);
+		_pool->quit = true;
+	}
+	_pool->work.notify_all();
+	for (int i = 0; i < _pool->threadsStarted; i++)
+		_pool->threads[i].join();
+	delete _pool;
+}
+
+void AsyncLoader::start(int threadCount) {
+	if (threadCount <= 0) threadCount = (int) std::thread::hardware_concurrency();
+	if (threadCount <= 0) threadCount = 1;
+	_pool = new (__FILE__, __LINE__) Pool(threadCount);
+	for (int thread = 0; thread < threadCount; thread++) {
+		new (_pool->threads + _pool->threadsStarted++) std::thread([this]() {
+			Pool &pool = *_pool;
+			while (true) {
+				Pool::Task task;
+				{
+					std::unique_lock<std::mutex> lock(pool.mutex);
+					pool.work.wait(lock, [&pool]() { return pool.quit || pool.hasTask(); });
+					if (pool.quit) return;
+					task = pool.nextQueued();
+				}
+				run(task.load, task.page);
+			}
+		});
+	}
+}
+
+AsyncLoad *AsyncLoader::load(const String &atlasPath, const String &skeletonPath, float scale) {
+	AsyncLoad *load = new (__FILE__, __LINE__) AsyncLoad(atlasPath, skeletonPath, scale);
+	Pool::Task task = {load, -1};
+	{
+		std::lock_guard<std::mutex> lock(_pool->mutex);
+		_pool->tasks.add(task);
+		_pool->pending++;
+	}
+	_pool->work.notify_one();
+	return load;
+}
+
+void AsyncLoader::setListener(AsyncLoaderListener *listener) {
+	_listener = listener;
+}
+
+int AsyncLoader::update() {
+	Vector<AsyncLoad *> ready;
+	{
+		std::lock_guard<std::mutex> lock(_pool->mutex);
+		if (_pool->ready.size() == 0) return 0;
+		ready.addAll(_pool->ready);
+		_pool->ready.clear();
+	}
+	for (size_t i = 0; i < ready.size(); i++) {
+		AsyncLoad *load = ready[i];
+		if (load->_atlas) {
+			Vector<AtlasPage *> &pages = load->_atlas->getPages();
+			for (size_t ii = 0, nn = pages.size(); ii < nn; ii++) {
+				AtlasPage &page = *pages[ii];
+				if (_deferredLoader)
+					_deferredLoader->upload(page, page.texturePath, load->_decoded[ii]);
+				else if (_textureLoader)
+					_textureLoader->load(page, page.texturePath);
+			}
+			load->_decoded.clear();
+		}
+		load->_done = true;
+		{
+			std::lock_guard<std::mutex> lock(_pool->mutex);
+			_pool->pending--;
+		}
+		if (_listener) _listener->loaded(*this, *load);
+	}
+	return (int) ready.size();
+}
+
+void AsyncLoader::finish(AsyncLoad *load) {
+	while (true) {
+		update();
+		Pool::Task task;
+		{
+			std::unique_lock<std::mutex> lock(_pool->mutex);
+			if (load ? load->_done : _pool->pending == 0) return;
+			_pool->changed.wait(lock, [this]() { return _pool->ready.size() > 0 || _pool->hasTask(); });
+			if (_pool->ready.size() > 0) continue;
+			task = _pool->nextQueued();
+		}
+		run(task.load, task.page);
+	}
+}
+
+int AsyncLoader::getPendingCount() {
+	std::lock_guard<std::mutex> lock(_pool->mutex);
+	return _pool->pending;
+}
+
+int AsyncLoader::getThreadCount() {
+	return _pool->threadCount;
+}
+
+void AsyncLoader::run(AsyncLoad *load, int page) {
+	if (page >= 0) {
+		AtlasPage &atlasPage = *load->_atlas->getPages()[page];
+		load->_decoded[page] = _deferredLoader->decode(atlasPage, atlasPage.texturePath);
+	} else {
+		/* Textures are created by update(), the atlas keeps the loader to unload them. */
+		Atlas *atlas = new (__FILE__, __LINE__) Atlas(load->_atlasPath, _textureLoader, false);
+		int pageCount = (int) atlas->getPages().size();
+		if (pageCount == 0) {
+			delete atlas;
+			load->_error = "Unable to read atlas file: ";
+			load->_error.append(load->_atlasPath);
+		} else {
+			load->_atlas = atlas;
+			if (_deferredLoader) {
+				load->_decoded.setSize(pageCount, NULL);
+				{
+					std::lock_guard<std::mutex> lock(_pool->mutex);
+					load->_tasks += pageCount;
+					for (int i = 0; i < pageCount; i++) {
+						Pool::Task task = {load, i};
+						_pool->tasks.add(task);
+					}
+				}
+				_pool->work.notify_all();
+				_pool->changed.notify_all();
+			}
+			load->_skeletonData = readSkeletonDataFile(atlas, load->_skeletonPath, load->_scale, load->_error);
+		}
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(_pool->mutex);
+		if (--load->_tasks != 0) return;
+		_pool->ready.add(load);
+	}
+	_pool->changed.notify_all();
+}
+
+SkeletonData *AsyncLoader::readSkeletonDataFile(Atlas *atlas, const String &path, float scale, String &error) {
+	int length;
+	const char *data = SpineExtension::mapFile(path, &length);
+	bool mapped = data != NULL;
+	if (!mapped) data = SpineExtension::readFile(path, &length);
+	if (length == 0 || !data) {
+		if (data) SpineExtension::free(data, __FILE__, __LINE__);
+		error = "Unable to read skeleton file: ";
+		error.append(path);
+		return NULL;
+	}
+
+	SkeletonData *skeletonData;
+	if (SkeletonBaked::isBaked((const unsigned char *) data, length)) {
+		if (scale != 1) {
+			/* Baked data has the scale it was baked with, another would give different data under the same files. */
+			skeletonData = NULL;
+			error = "Baked skeleton data can only be read with scale 1: ";
+			error.append(path);
+		} else {
+			SkeletonBaked baked(atlas);
+			skeletonData = baked.readSkeletonData((const unsigned char *) data, length);
+			if (!skeletonData) error = baked.getError();
+		}
+	} else if (isJson(path)) {
+		SkeletonJson json(atlas);
+		json.setScale(scale);
+		skeletonData = json.readSkeletonData(data, length);
+		if (!skeletonData) error = json.getError();
+	} else {
+		SkeletonBinary binary(atlas);
+		binary.setScale(scale);
+		skeletonData = binary.readSkeletonData((const unsigned char *) data, length);
+		if (!skeletonData) error = binary.getError();
+	}
+
+	if (mapped)
+		SpineExtension::unmapFile(data, length);
+	else
+		SpineExtension::free(data, __FILE__, __LINE__);
+	return skeletonData;
+}
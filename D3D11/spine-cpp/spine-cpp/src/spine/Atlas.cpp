@@ -51,12 +51,18 @@ Atlas::Atlas(const String &path, TextureLoader *textureLoader, bool createTextur
 	memcpy(dir, path.buffer(), dirLength);
 	dir[dirLength] = '\0';
 
-	data = SpineExtension::readFile(path, &length);
+	data = SpineExtension::mapFile(path, &length);
 	if (data) {
 		load(data, length, dir, createTexture);
+		SpineExtension::unmapFile(data, length);
+	} else {
+		data = SpineExtension::readFile(path, &length);
+		if (data) {
+			load(data, length, dir, createTexture);
+		}
+		SpineExtension::free(data, __FILE__, __LINE__);
 	}
 
-	SpineExtension::free(data, __FILE__, __LINE__);
 	SpineExtension::free(dir, __FILE__, __LINE__);
 }
 
@@ -58,10 +58,16 @@ namespace spine {
 		SP_UNUSED(skin);
 		RegionAttachment *attachment = new (__FILE__, __LINE__) RegionAttachment(name);
 		if (sequence) {
-			if (!loadSequence(_atlas, path, sequence)) return NULL;
+			if (!loadSequence(_atlas, path, sequence)) {
+				delete attachment;
+				return NULL;
+			}
 		} else {
 			AtlasRegion *region = findRegion(path);
-			if (!region) return NULL;
+			if (!region) {
+				delete attachment;
+				return NULL;
+			}
 			attachment->setRegion(region);
 		}
 		return attachment;
@@ -72,10 +78,16 @@ namespace spine {
 		MeshAttachment *attachment = new (__FILE__, __LINE__) MeshAttachment(name);
 
 		if (sequence) {
-			if (!loadSequence(_atlas, path, sequence)) return NULL;
+			if (!loadSequence(_atlas, path, sequence)) {
+				delete attachment;
+				return NULL;
+			}
 		} else {
 			AtlasRegion *region = findRegion(path);
-			if (!region) return NULL;
+			if (!region) {
+				delete attachment;
+				return NULL;
+			}
 			attachment->setRegion(region);
 		}
 		return attachment;
@@ -35,7 +35,11 @@ using namespace spine;
 
 RTTI_IMPL_NOPARENT(Attachment)
 
-Attachment::Attachment(const String &name) : _name(name), _refCount(0) {
+Attachment::Attachment(const String &name) : _name(name), _type(AttachmentType_Custom), _refCount(0) {
+	assert(_name.length() > 0);
+}
+
+Attachment::Attachment(const String &name, AttachmentType type) : _name(name), _type(type), _refCount(0) {
 	assert(_name.length() > 0);
 }
 
@@ -44,6 +44,7 @@ RTTI_IMPL(AttachmentTimeline, Timeline)
 
 AttachmentTimeline::AttachmentTimeline(size_t frameCount, int slotIndex) : Timeline(frameCount, 1),
 																		   _slotIndex(slotIndex) {
+	_type = TimelineType_Attachment;
 	PropertyId ids[] = {((PropertyId) Property_Attachment << 32) | slotIndex};
 	setPropertyIds(ids, 1);
 
@@ -0,0 +1,389 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated April 5, 2025. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2025, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/BakedAnimation.h>
+
+#include <spine/Animation.h>
+#include <spine/Bone.h>
+#include <spine/BoneData.h>
+#include <spine/CurveTimeline.h>
+#include <spine/MathUtil.h>
+#include <spine/Property.h>
+#include <spine/RotateTimeline.h>
+#include <spine/ScaleTimeline.h>
+#include <spine/ShearTimeline.h>
+#include <spine/Skeleton.h>
+#include <spine/TranslateTimeline.h>
+
+#include <float.h>
+
+using namespace spine;
+
+float &BakedAnimation::boneValue(Bone &bone, int property) {
+	switch (property) {
+		case Property_Rotate:
+			return bone._rotation;
+		case Property_X:
+			return bone._x;
+		case Property_Y:
+			return bone._y;
+		case Property_ScaleX:
+			return bone._scaleX;
+		case Property_ScaleY:
+			return bone._scaleY;
+		case Property_ShearX:
+			return bone._shearX;
+		default:
+			return bone._shearY;
+	}
+}
+
+static float setupValue(BoneData &data, int property) {
+	switch (property) {
+		case Property_Rotate:
+			return data.getRotation();
+		case Property_X:
+			return data.getX();
+		case Property_Y:
+			return data.getY();
+		case Property_ScaleX:
+			return data.getScaleX();
+		case Property_ScaleY:
+			return data.getScaleY();
+		case Property_ShearX:
+			return data.getShearX();
+		default:
+			return data.getShearY();
+	}
+}
+
+/// Returns the bone of a bone transform timeline and the properties it keys, or -1 for other timelines.
+static int boneProperties(Timeline *timeline, int &property1, int &property2) {
+	property2 = 0;
+	switch (timeline->getType()) {
+		case TimelineType_Rotate:
+			property1 = Property_Rotate;
+			return static_cast<RotateTimeline *>(timeline)->getBoneIndex();
+		case TimelineType_Translate:
+			property1 = Property_X;
+			property2 = Property_Y;
+			return static_cast<TranslateTimeline *>(timeline)->getBoneIndex();
+		case TimelineType_TranslateX:
+			property1 = Property_X;
+			return static_cast<TranslateXTimeline *>(timeline)->getBoneIndex();
+		case TimelineType_TranslateY:
+			property1 = Property_Y;
+			return static_cast<TranslateYTimeline *>(timeline)->getBoneIndex();
+		case TimelineType_Scale:
+			property1 = Property_ScaleX;
+			property2 = Property_ScaleY;
+			return static_cast<ScaleTimeline *>(timeline)->getBoneIndex();
+		case TimelineType_ScaleX:
+			property1 = Property_ScaleX;
+			return static_cast<ScaleXTimeline *>(timeline)->getBoneIndex();
+		case TimelineType_ScaleY:
+			property1 = Property_ScaleY;
+			return static_cast<ScaleYTimeline *>(timeline)->getBoneIndex();
+		case TimelineType_Shear:
+			property1 = Property_ShearX;
+			property2 = Property_ShearY;
+			return static_cast<ShearTimeline *>(timeline)->getBoneIndex();
+		case TimelineType_ShearX:
+			property1 = Property_ShearX;
+			return static_cast<ShearXTimeline *>(timeline)->getBoneIndex();
+		case TimelineType_ShearY:
+			property1 = Property_ShearY;
+			return static_cast<ShearYTimeline *>(timeline)->getBoneIndex();
+		default:
+			return -1;
+	}
+}
+
+/// Applies a timeline at the time, or at the next key if it is within epsilon of the time.
+static void applyAtKey(Timeline *timeline, Skeleton &skeleton, float time, float epsilon) {
+	Vector<float> &frames = timeline->getFrames();
+	int entries = (int) timeline->getFrameEntries();
+	int next = time < frames[0] ? 0 : Animation::search(frames, time, entries) + entries;
+	if (next < (int) frames.size() && frames[next] - time <= epsilon) time = frames[next];
+	timeline->apply(skeleton, time, time, NULL, 1, MixBlend_Setup, MixDirection_In);
+}
+
+BakedAnimation::BakedAnimation(SkeletonData &skeletonData, Animation &animation, float sampleRate,
+							   float storageTolerance, bool quantize) : _animation(animation), _sampleRate(sampleRate),
+																		_storageTolerance(storageTolerance), _error(0) {
+	float duration = animation.getDuration();
+	_sampleCount = duration > 0 && sampleRate > 0 ? (int) MathUtil::ceil(duration * sampleRate) + 1 : 1;
+	_step = _sampleCount > 1 ? duration / (_sampleCount - 1) : 0;
+	_inverseStep = _step > 0 ? 1 / _step : 0;
+
+	Vector<Timeline *> &timelines = animation.getTimelines();
+	_timelineChannels.setSize(timelines.size(), -1);
+	for (size_t i = 0; i < timelines.size(); i++) {
+		int property1, property2;
+		int bone = boneProperties(timelines[i], property1, property2);
+		if (bone == -1) continue;
+		_timelineChannels[i] = (int) _channels.size();
+		Channel channel = {(int) i, bone, property1, Storage_Float, 0, -1, 0, 0, timelines[i]->getFrames()[0]};
+		_channels.add(channel);
+		if (property2 == 0) continue;
+		channel.property = property2;
+		_channels.add(channel);
+	}
+	int channelCount = (int) _channels.size();
+	if (channelCount == 0) return;
+
+	/* Keys this close to a sample are treated as at the sample, so a stepped key there is sampled after the step. */
+	float epsilon = _step * 0.001f;
+
+	/* Bones that need a skin are active so they are keyed. */
+	Skeleton skeleton(&skeletonData);
+	Vector<Bone *> &bones = skeleton.getBones();
+	for (size_t i = 0; i < bones.size(); i++)
+		bones[i]->_active = true;
+
+	Vector<float> samples;
+	samples.setSize(channelCount * _sampleCount, 0);
+	for (int frame = 0; frame < _sampleCount; frame++) {
+		float time = frame == _sampleCount - 1 ? duration : frame * _step;
+		for (size_t i = 0; i < timelines.size(); i++)
+			if (_timelineChannels[i] != -1) applyAtKey(timelines[i], skeleton, time, epsilon);
+		for (int i = 0; i < channelCount; i++)
+			samples[i * _sampleCount + frame] = boneValue(*bones[_channels[i].bone], _channels[i].property);
+	}
+
+	for (int i = 0; i < channelCount; i++) {
+		Channel &channel = _channels[i];
+		float *values = samples.buffer() + i * _sampleCount;
+		float min = values[0], max = values[0];
+		for (int frame = 1; frame < _sampleCount; frame++) {
+			min = MathUtil::min(min, values[frame]);
+			max = MathUtil::max(max, values[frame]);
+		}
+		float range = max - min;
+		if (range <= storageTolerance * 2) {
+			channel.storage = Storage_Constant;
+			channel.base = (min + max) * 0.5f;
+		} else if (quantize && range / 65535 * 0.5f <= storageTolerance) {
+			channel.storage = Storage_Quantized;
+			channel.offset = (int) _quantized.size();
+			channel.base = min;
+			channel.scale = range / 65535;
+			float inverseScale = 65535 / range;
+			for (int frame = 0; frame < _sampleCount; frame++)
+				_quantized.add((unsigned short) MathUtil::clamp((values[frame] - min) * inverseScale + 0.5f, 0.0f, 65535.0f));
+		} else {
+			channel.offset = (int) _values.size();
+			for (int frame = 0; frame < _sampleCount; frame++)
+				_values.add(values[frame]);
+		}
+		if (channel.storage == Storage_Constant || _sampleCount < 2) continue;
+
+		/* Interpolating across a stepped key, or from the setup pose to a first key after the start, would blend the values
+		 * before and after it. */
+		CurveTimeline *timeline = static_cast<CurveTimeline *>(timelines[channel.timeline]);
+		Vector<float> &frames = timeline->getFrames();
+		size_t entries = timeline->getFrameEntries();
+		if (channel.first > 0) addStep(channel, channel.first);
+		for (size_t frame = 0, n = timeline->getFrameCount() - 1; frame < n; frame++)
+			if (timeline->_curves[frame] == CurveTimeline::STEPPED) addStep(channel, frames[(frame + 1) * entries]);
+	}
+
+	/* Measure the error at and halfway between samples, where the timelines key the properties. */
+	for (int half = 0, n = _sampleCount * 2 - 1; half < n; half++) {
+		float time = MathUtil::min(half * _step * 0.5f, duration);
+		for (size_t i = 0; i < timelines.size(); i++)
+			if (_timelineChannels[i] != -1) applyAtKey(timelines[i], skeleton, time, epsilon);
+		for (int i = 0; i < channelCount; i++) {
+			Channel &channel = _channels[i];
+			if (time < channel.first) continue;
+			float error = MathUtil::abs(sample(channel, time) - boneValue(*bones[channel.bone], channel.property));
+			_error = MathUtil::max(_error, error);
+		}
+	}
+}
+
+BakedAnimation::~BakedAnimation() {
+}
+
+Animation &BakedAnimation::getAnimation() {
+	return _animation;
+}
+
+float BakedAnimation::getSampleRate() {
+	return _sampleRate;
+}
+
+float BakedAnimation::getStorageTolerance() {
+	return _storageTolerance;
+}
+
+int BakedAnimation::getSampleCount() {
+	return _sampleCount;
+}
+
+int BakedAnimation::getChannelCount() {
+	return (int) _channels.size();
+}
+
+int BakedAnimation::getQuantizedCount() {
+	int count = 0;
+	for (size_t i = 0; i < _channels.size(); i++)
+		if (_channels[i].storage == Storage_Quantized) count++;
+	return count;
+}
+
+int BakedAnimation::getConstantCount() {
+	int count = 0;
+	for (size_t i = 0; i < _channels.size(); i++)
+		if (_channels[i].storage == Storage_Constant) count++;
+	return count;
+}
+
+float BakedAnimation::getError() {
+	return _error;
+}
+
+size_t BakedAnimation::getSize() {
+	return sizeof(BakedAnimation) + _channels.getCapacity() * sizeof(Channel) +
+		   _timelineChannels.getCapacity() * sizeof(int) + _values.getCapacity() * sizeof(float) +
+		   _quantized.getCapacity() * sizeof(unsigned short) + _steps.getCapacity() * sizeof(float);
+}
+
+void BakedAnimation::addStep(Channel &channel, float time) {
+	if (channel.steps == -1) {
+		channel.steps = (int) _steps.size();
+		for (int i = 1; i < _sampleCount; i++)
+			_steps.add(FLT_MAX);
+	}
+	float position = time * _inverseStep;
+	int interval = (int) position, nearest = (int) (position + 0.5f);
+	if (MathUtil::abs(position - nearest) < 0.001f) {
+		/* A step at a sample holds the previous sample for the interval before it. */
+		if (nearest == 0) return;
+		interval = nearest - 1;
+	}
+	interval = MathUtil::min(interval, _sampleCount - 2);
+	float &step = _steps[channel.steps + interval];
+	step = MathUtil::min(step, time);
+}
+
+float BakedAnimation::sample(const Channel &channel, float time) {
+	if (channel.storage == Storage_Constant) return channel.base;
+	float position = time * _inverseStep;
+	int frame = (int) position;
+	float t;
+	if (position <= 0) {
+		frame = 0;
+		t = 0;
+	} else if (frame >= _sampleCount - 1) {
+		frame = _sampleCount - 1;
+		t = 0;
+	} else {
+		t = position - frame;
+		if (channel.steps != -1) {
+			float step = _steps[channel.steps + frame];
+			if (step != FLT_MAX) t = time < step ? 0 : 1;
+		}
+	}
+	if (channel.storage == Storage_Float) {
+		const float *values = _values.buffer() + channel.offset + frame;
+		return t == 0 ? values[0] : values[0] + (values[1] - values[0]) * t;
+	}
+	const unsigned short *values = _quantized.buffer() + channel.offset + frame;
+	float value = t == 0 ? values[0] : values[0] + ((float) values[1] - values[0]) * t;
+	return channel.base + value * channel.scale;
+}
+
+float BakedAnimation::getValue(size_t timelineIndex, float time) {
+	return sample(_channels[_timelineChannels[timelineIndex]], time);
+}
+
+void BakedAnimation::apply(size_t timelineIndex, Skeleton &skeleton, float time, float alpha, MixBlend blend,
+						   MixDirection direction) {
+	SP_UNUSED(direction);
+
+	Vector<Bone *> &bones = skeleton.getBones();
+	for (size_t i = _timelineChannels[timelineIndex], n = _channels.size(); i < n; i++) {
+		Channel &channel = _channels[i];
+		if (channel.timeline != (int) timelineIndex) break;
+		Bone *bone = bones[channel.bone];
+		if (!bone->_active) continue;
+
+		float &current = boneValue(*bone, channel.property);
+		float setup = setupValue(bone->_data, channel.property);
+		if (time < channel.first) {
+			switch (blend) {
+				case MixBlend_Setup:
+					current = setup;
+					break;
+				case MixBlend_First:
+					current += (setup - current) * alpha;
+				default:
+					break;
+			}
+			continue;
+		}
+
+		float value = sample(channel, time);
+		if (alpha == 1 && blend != MixBlend_Add) {
+			current = value;
+			continue;
+		}
+		switch (blend) {
+			case MixBlend_Setup:
+				current = setup + (value - setup) * alpha;
+				break;
+			case MixBlend_First:
+			case MixBlend_Replace:
+				current += (value - current) * alpha;
+				break;
+			case MixBlend_Add:
+				current += (value - setup) * alpha;
+		}
+	}
+}
+
+void BakedAnimation::apply(Skeleton &skeleton, float lastTime, float time, bool loop, Vector<Event *> *pEvents,
+						   float alpha, MixBlend blend, MixDirection direction) {
+	float duration = _animation.getDuration();
+	if (loop && duration != 0) {
+		time = MathUtil::fmod(time, duration);
+		if (lastTime > 0) {
+			lastTime = MathUtil::fmod(lastTime, duration);
+		}
+	}
+
+	Vector<Timeline *> &timelines = _animation.getTimelines();
+	for (size_t i = 0, n = timelines.size(); i < n; ++i) {
+		if (_timelineChannels[i] != -1)
+			apply(i, skeleton, time, alpha, blend, direction);
+		else
+			timelines[i]->apply(skeleton, lastTime, time, pEvents, alpha, blend, direction);
+	}
+}
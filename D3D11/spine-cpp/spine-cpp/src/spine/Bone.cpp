@@ -72,6 +72,8 @@ Bone::Bone(BoneData &data, Skeleton &skeleton, Bone *parent) : Updatable(),
 															   _worldY(0),
 															   _sorted(false),
 															   _active(false),
+															   _dirty(true),
+															   _updated(false),
 															   _inherit(Inherit_Normal) {
 	setToSetupPose();
 }
@@ -88,6 +90,9 @@ void Bone::updateWorldTransform(float x, float y, float rotation, float scaleX,
 	float pa, pb, pc, pd;
 	Bone *parent = _parent;
 
+	_skeleton._boneMatrices.invalidate();
+	_dirty = false;
+	_updated = true;
 	_ax = x;
 	_ay = y;
 	_arotation = rotation;
@@ -100,12 +105,13 @@ void Bone::updateWorldTransform(float x, float y, float rotation, float scaleX,
 		Skeleton &skeleton = this->_skeleton;
 		float sx = skeleton.getScaleX();
 		float sy = skeleton.getScaleY();
-		float rx = (rotation + shearX) * MathUtil::Deg_Rad;
-		float ry = (rotation + 90 + shearY) * MathUtil::Deg_Rad;
-		_a = MathUtil::cos(rx) * scaleX * sx;
-		_b = MathUtil::cos(ry) * scaleY * sx;
-		_c = MathUtil::sin(rx) * scaleX * sy;
-		_d = MathUtil::sin(ry) * scaleY * sy;
+		float sinX, cosX, sinY, cosY;
+		MathUtil::sinCos((rotation + shearX) * MathUtil::Deg_Rad, sinX, cosX);
+		MathUtil::sinCos((rotation + 90 + shearY) * MathUtil::Deg_Rad, sinY, cosY);
+		_a = cosX * scaleX * sx;
+		_b = cosY * scaleY * sx;
+		_c = sinX * scaleX * sy;
+		_d = sinY * scaleY * sy;
 		_worldX = x * sx + _skeleton.getX();
 		_worldY = y * sy + _skeleton.getY();
 		return;
@@ -121,12 +127,13 @@ void Bone::updateWorldTransform(float x, float y, float rotation, float scaleX,
 
 	switch (_inherit) {
 		case Inherit_Normal: {
-			float rx = (rotation + shearX) * MathUtil::Deg_Rad;
-			float ry = (rotation + 90 + shearY) * MathUtil::Deg_Rad;
-			float la = MathUtil::cos(rx) * scaleX;
-			float lb = MathUtil::cos(ry) * scaleY;
-			float lc = MathUtil::sin(rx) * scaleX;
-			float ld = MathUtil::sin(ry) * scaleY;
+			float sinX, cosX, sinY, cosY;
+			MathUtil::sinCos((rotation + shearX) * MathUtil::Deg_Rad, sinX, cosX);
+			MathUtil::sinCos((rotation + 90 + shearY) * MathUtil::Deg_Rad, sinY, cosY);
+			float la = cosX * scaleX;
+			float lb = cosY * scaleY;
+			float lc = sinX * scaleX;
+			float ld = sinY * scaleY;
 			_a = pa * la + pb * lc;
 			_b = pa * lb + pb * ld;
 			_c = pc * la + pd * lc;
@@ -134,12 +141,13 @@ void Bone::updateWorldTransform(float x, float y, float rotation, float scaleX,
 			return;
 		}
 		case Inherit_OnlyTranslation: {
-			float rx = (rotation + shearX) * MathUtil::Deg_Rad;
-			float ry = (rotation + 90 + shearY) * MathUtil::Deg_Rad;
-			_a = MathUtil::cos(rx) * scaleX;
-			_b = MathUtil::cos(ry) * scaleY;
-			_c = MathUtil::sin(rx) * scaleX;
-			_d = MathUtil::sin(ry) * scaleY;
+			float sinX, cosX, sinY, cosY;
+			MathUtil::sinCos((rotation + shearX) * MathUtil::Deg_Rad, sinX, cosX);
+			MathUtil::sinCos((rotation + 90 + shearY) * MathUtil::Deg_Rad, sinY, cosY);
+			_a = cosX * scaleX;
+			_b = cosY * scaleY;
+			_c = sinX * scaleX;
+			_d = sinY * scaleY;
 			break;
 		}
 		case Inherit_NoRotationOrReflection: {
@@ -157,12 +165,13 @@ void Bone::updateWorldTransform(float x, float y, float rotation, float scaleX,
 				pc = 0;
 				prx = 90 - MathUtil::atan2Deg(pd, pb);
 			}
-			float rx = (rotation + shearX - prx) * MathUtil::Deg_Rad;
-			float ry = (rotation + shearY - prx + 90) * MathUtil::Deg_Rad;
-			float la = MathUtil::cos(rx) * scaleX;
-			float lb = MathUtil::cos(ry) * scaleY;
-			float lc = MathUtil::sin(rx) * scaleX;
-			float ld = MathUtil::sin(ry) * scaleY;
+			float sinX, cosX, sinY, cosY;
+			MathUtil::sinCos((rotation + shearX - prx) * MathUtil::Deg_Rad, sinX, cosX);
+			MathUtil::sinCos((rotation + shearY - prx + 90) * MathUtil::Deg_Rad, sinY, cosY);
+			float la = cosX * scaleX;
+			float lb = cosY * scaleY;
+			float lc = sinX * scaleX;
+			float ld = sinY * scaleY;
 			_a = pa * la - pb * lc;
 			_b = pa * lb - pb * ld;
 			_c = pc * la + pd * lc;
@@ -172,8 +181,8 @@ void Bone::updateWorldTransform(float x, float y, float rotation, float scaleX,
 		case Inherit_NoScale:
 		case Inherit_NoScaleOrReflection: {
 			rotation *= MathUtil::Deg_Rad;
-			float cosine = MathUtil::cos(rotation);
-			float sine = MathUtil::sin(rotation);
+			float sine, cosine;
+			MathUtil::sinCos(rotation, sine, cosine);
 			float za = (pa * cosine + pb * sine) / _skeleton.getScaleX();
 			float zc = (pc * cosine + pd * sine) / _skeleton.getScaleY();
 			float s = MathUtil::sqrt(za * za + zc * zc);
@@ -185,14 +194,16 @@ void Bone::updateWorldTransform(float x, float y, float rotation, float scaleX,
 				(pa * pd - pb * pc < 0) != (_skeleton.getScaleX() < 0 != _skeleton.getScaleY() < 0))
 				s = -s;
 			rotation = MathUtil::Pi / 2 + MathUtil::atan2(zc, za);
-			float zb = MathUtil::cos(rotation) * s;
-			float zd = MathUtil::sin(rotation) * s;
-			shearX *= MathUtil::Deg_Rad;
-			shearY = (90 + shearY) * MathUtil::Deg_Rad;
-			float la = MathUtil::cos(shearX) * scaleX;
-			float lb = MathUtil::cos(shearY) * scaleY;
-			float lc = MathUtil::sin(shearX) * scaleX;
-			float ld = MathUtil::sin(shearY) * scaleY;
+			MathUtil::sinCos(rotation, sine, cosine);
+			float zb = cosine * s;
+			float zd = sine * s;
+			float sinX, cosX, sinY, cosY;
+			MathUtil::sinCos(shearX * MathUtil::Deg_Rad, sinX, cosX);
+			MathUtil::sinCos((90 + shearY) * MathUtil::Deg_Rad, sinY, cosY);
+			float la = cosX * scaleX;
+			float lb = cosY * scaleY;
+			float lc = sinX * scaleX;
+			float ld = sinY * scaleY;
 			_a = za * la + zb * lc;
 			_b = za * lb + zb * ld;
 			_c = zc * la + zd * lc;
@@ -214,7 +225,7 @@ void Bone::setToSetupPose() {
 	_scaleY = data.getScaleY();
 	_shearX = data.getShearX();
 	_shearY = data.getShearY();
-	_inherit = data.getInherit();
+	setInherit(data.getInherit());
 }
 
 void Bone::worldToLocal(float worldX, float worldY, float &outLocalX, float &outLocalY) {
@@ -267,8 +278,11 @@ float Bone::localToWorldRotation(float localRotation) {
 }
 
 void Bone::rotateWorld(float degrees) {
+	_skeleton._boneMatrices.invalidate();
+	_dirty = true;
 	degrees *= MathUtil::Deg_Rad;
-	float sine = MathUtil::sin(degrees), cosine = MathUtil::cos(degrees);
+	float sine, cosine;
+	MathUtil::sinCos(degrees, sine, cosine);
 	float ra = _a, rb = _b;
 	_a = cosine * ra - sine * _c;
 	_b = cosine * rb - sine * _d;
@@ -442,6 +456,8 @@ float Bone::getA() {
 
 void Bone::setA(float inValue) {
 	_a = inValue;
+	_dirty = true;
+	_skeleton._boneMatrices.invalidate();
 }
 
 float Bone::getB() {
@@ -450,6 +466,8 @@ float Bone::getB() {
 
 void Bone::setB(float inValue) {
 	_b = inValue;
+	_dirty = true;
+	_skeleton._boneMatrices.invalidate();
 }
 
 float Bone::getC() {
@@ -458,6 +476,8 @@ float Bone::getC() {
 
 void Bone::setC(float inValue) {
 	_c = inValue;
+	_dirty = true;
+	_skeleton._boneMatrices.invalidate();
 }
 
 float Bone::getD() {
@@ -466,6 +486,8 @@ float Bone::getD() {
 
 void Bone::setD(float inValue) {
 	_d = inValue;
+	_dirty = true;
+	_skeleton._boneMatrices.invalidate();
 }
 
 float Bone::getWorldX() {
@@ -474,6 +496,8 @@ float Bone::getWorldX() {
 
 void Bone::setWorldX(float inValue) {
 	_worldX = inValue;
+	_dirty = true;
+	_skeleton._boneMatrices.invalidate();
 }
 
 float Bone::getWorldY() {
@@ -482,6 +506,8 @@ float Bone::getWorldY() {
 
 void Bone::setWorldY(float inValue) {
 	_worldY = inValue;
+	_dirty = true;
+	_skeleton._boneMatrices.invalidate();
 }
 
 float Bone::getWorldRotationX() {
@@ -501,6 +527,7 @@ float Bone::getWorldScaleY() {
 }
 
 void Bone::updateAppliedTransform() {
+	_skeleton._boneMatrices.invalidate();
 	Bone *parent = _parent;
 	if (!parent) {
 		_ax = _worldX - _skeleton.getX();
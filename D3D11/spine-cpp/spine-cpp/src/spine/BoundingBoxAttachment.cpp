@@ -33,7 +33,7 @@ using namespace spine;
 
 RTTI_IMPL(BoundingBoxAttachment, VertexAttachment)
 
-BoundingBoxAttachment::BoundingBoxAttachment(const String &name) : VertexAttachment(name), _color() {
+BoundingBoxAttachment::BoundingBoxAttachment(const String &name) : VertexAttachment(name, AttachmentType_Boundingbox), _color() {
 }
 
 Color &BoundingBoxAttachment::getColor() {
@@ -35,7 +35,7 @@ using namespace spine;
 
 RTTI_IMPL(ClippingAttachment, VertexAttachment)
 
-ClippingAttachment::ClippingAttachment(const String &name) : VertexAttachment(name), _endSlot(NULL), _color() {
+ClippingAttachment::ClippingAttachment(const String &name) : VertexAttachment(name, AttachmentType_Clipping), _endSlot(NULL), _color() {
 }
 
 SlotData *ClippingAttachment::getEndSlot() {
@@ -46,6 +46,7 @@ RGBATimeline::RGBATimeline(size_t frameCount, size_t bezierCount, int slotIndex)
 																								 RGBATimeline::ENTRIES,
 																								 bezierCount),
 																				   _slotIndex(slotIndex) {
+	_type = TimelineType_RGBA;
 	PropertyId ids[] = {((PropertyId) Property_Rgb << 32) | slotIndex,
 						((PropertyId) Property_Alpha << 32) | slotIndex};
 	setPropertyIds(ids, 2);
@@ -136,6 +137,7 @@ RGBTimeline::RGBTimeline(size_t frameCount, size_t bezierCount, int slotIndex) :
 																							   RGBTimeline::ENTRIES,
 																							   bezierCount),
 																				 _slotIndex(slotIndex) {
+	_type = TimelineType_RGB;
 	PropertyId ids[] = {((PropertyId) Property_Rgb << 32) | slotIndex};
 	setPropertyIds(ids, 1);
 }
@@ -219,6 +221,7 @@ RTTI_IMPL(AlphaTimeline, CurveTimeline1)
 AlphaTimeline::AlphaTimeline(size_t frameCount, size_t bezierCount, int slotIndex) : CurveTimeline1(frameCount,
 																									bezierCount),
 																					 _slotIndex(slotIndex) {
+	_type = TimelineType_Alpha;
 	PropertyId ids[] = {((PropertyId) Property_Alpha << 32) | slotIndex};
 	setPropertyIds(ids, 1);
 }
@@ -264,6 +267,7 @@ RGBA2Timeline::RGBA2Timeline(size_t frameCount, size_t bezierCount, int slotInde
 																								   RGBA2Timeline::ENTRIES,
 																								   bezierCount),
 																					 _slotIndex(slotIndex) {
+	_type = TimelineType_RGBA2;
 	PropertyId ids[] = {((PropertyId) Property_Rgb << 32) | slotIndex,
 						((PropertyId) Property_Alpha << 32) | slotIndex,
 						((PropertyId) Property_Rgb2 << 32) | slotIndex};
@@ -385,6 +389,7 @@ RGB2Timeline::RGB2Timeline(size_t frameCount, size_t bezierCount, int slotIndex)
 																								 RGB2Timeline::ENTRIES,
 																								 bezierCount),
 																				   _slotIndex(slotIndex) {
+	_type = TimelineType_RGB2;
 	PropertyId ids[] = {((PropertyId) Property_Rgb << 32) | slotIndex,
 						((PropertyId) Property_Rgb2 << 32) | slotIndex};
 	setPropertyIds(ids, 2);
@@ -29,10 +29,31 @@
 
 #include <spine/CurveTimeline.h>
 
+#include <spine/Animation.h>
 #include <spine/MathUtil.h>
 
+#if !defined(SPINE_NO_SIMD) && (defined(_M_X64) || defined(__x86_64__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__))
+#define SPINE_CURVE_SSE2
+#include <emmintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
 using namespace spine;
 
+#ifdef SPINE_CURVE_SSE2
+static inline int firstBit(unsigned int mask) {
+#if defined(_MSC_VER)
+	unsigned long index;
+	_BitScanForward(&index, mask);
+	return (int) index;
+#else
+	return __builtin_ctz(mask);
+#endif
+}
+#endif
+
 RTTI_IMPL(CurveTimeline, Timeline)
 
 CurveTimeline::CurveTimeline(size_t frameCount, size_t frameEntries, size_t bezierCount) : Timeline(frameCount,
@@ -74,19 +95,35 @@ void CurveTimeline::setBezier(size_t bezier, size_t frame, float value, float ti
 }
 
 float CurveTimeline::getBezierValue(float time, size_t frameIndex, size_t valueOffset, size_t i) {
-	if (_curves[i] > time) {
+	const float *curves = _curves.buffer() + i;
+	if (curves[0] > time) {
 		float x = _frames[frameIndex], y = _frames[frameIndex + valueOffset];
-		return y + (time - x) / (_curves[i] - x) * (_curves[i + 1] - y);
+		return y + (time - x) / (curves[0] - x) * (curves[1] - y);
 	}
-	size_t n = i + BEZIER_SIZE;
-	for (i += 2; i < n; i += 2) {
-		if (_curves[i] >= time) {
-			float x = _curves[i - 2], y = _curves[i - 1];
-			return y + (time - x) / (_curves[i] - x) * (_curves[i + 1] - y);
+#ifdef SPINE_CURVE_SSE2
+	/* Compares the times of the other 8 samples at once. The first sample at or after the time is the first that is not
+	 * before it, or bit 8 when all are. */
+	__m128 target = _mm_set1_ps(time);
+	__m128 a = _mm_loadu_ps(curves + 2), b = _mm_loadu_ps(curves + 6);
+	__m128 c = _mm_loadu_ps(curves + 10), d = _mm_loadu_ps(curves + 14);
+	unsigned int before = (unsigned int) _mm_movemask_ps(_mm_cmplt_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)), target)) |
+						  ((unsigned int) _mm_movemask_ps(_mm_cmplt_ps(_mm_shuffle_ps(c, d, _MM_SHUFFLE(2, 0, 2, 0)), target)) << 4);
+	int sample = firstBit(~before);
+	if (sample < 8) {
+		const float *next = curves + 2 + (sample << 1);
+		float x = next[-2], y = next[-1];
+		return y + (time - x) / (next[0] - x) * (next[1] - y);
+	}
+#else
+	for (size_t ii = 2; ii < BEZIER_SIZE; ii += 2) {
+		if (curves[ii] >= time) {
+			float x = curves[ii - 2], y = curves[ii - 1];
+			return y + (time - x) / (curves[ii] - x) * (curves[ii + 1] - y);
 		}
 	}
+#endif
 	frameIndex += getFrameEntries();
-	float x = _curves[n - 2], y = _curves[n - 1];
+	float x = curves[BEZIER_SIZE - 2], y = curves[BEZIER_SIZE - 1];
 	return y + (time - x) / (_frames[frameIndex] - x) * (_frames[frameIndex + valueOffset] - y);
 }
 
@@ -111,13 +148,7 @@ void CurveTimeline1::setFrame(size_t frame, float time, float value) {
 }
 
 float CurveTimeline1::getCurveValue(float time) {
-	int i = (int) _frames.size() - 2;
-	for (int ii = 2; ii <= i; ii += 2) {
-		if (_frames[ii] > time) {
-			i = ii - 2;
-			break;
-		}
-	}
+	int i = Animation::search(_frames, time, CurveTimeline1::ENTRIES);
 
 	int curveType = (int) _curves[i >> 1];
 	switch (curveType) {
@@ -132,6 +163,15 @@ float CurveTimeline1::getCurveValue(float time) {
 	return getBezierValue(time, i, CurveTimeline1::VALUE, curveType - CurveTimeline1::BEZIER);
 }
 
+void CurveTimeline1::getCurveValues(CurveTimeline1 **timelines, size_t count, float time, float *values) {
+	for (size_t i = 0; i < count; i++) {
+#ifdef SPINE_CURVE_SSE2
+		if (i + 1 < count) _mm_prefetch((const char *) timelines[i + 1]->_frames.buffer(), _MM_HINT_T0);
+#endif
+		values[i] = timelines[i]->getCurveValue(time);
+	}
+}
+
 float CurveTimeline1::getRelativeValue(float time, float alpha, MixBlend blend, float current, float setup) {
 	if (time < _frames[0]) {
 		switch (blend) {
@@ -250,3 +290,38 @@ void CurveTimeline2::setFrame(size_t frame, float time, float value1, float valu
 	_frames[frame + CurveTimeline2::VALUE1] = value1;
 	_frames[frame + CurveTimeline2::VALUE2] = value2;
 }
+
+void CurveTimeline2::getCurveValue(float time, float &value1, float &value2) {
+	int i = Animation::search(_frames, time, CurveTimeline2::ENTRIES);
+	int curveType = (int) _curves[i / CurveTimeline2::ENTRIES];
+	switch (curveType) {
+		case CurveTimeline::LINEAR: {
+			float before = _frames[i];
+			value1 = _frames[i + CurveTimeline2::VALUE1];
+			value2 = _frames[i + CurveTimeline2::VALUE2];
+			float t = (time - before) / (_frames[i + CurveTimeline2::ENTRIES] - before);
+			value1 += (_frames[i + CurveTimeline2::ENTRIES + CurveTimeline2::VALUE1] - value1) * t;
+			value2 += (_frames[i + CurveTimeline2::ENTRIES + CurveTimeline2::VALUE2] - value2) * t;
+			break;
+		}
+		case CurveTimeline::STEPPED: {
+			value1 = _frames[i + CurveTimeline2::VALUE1];
+			value2 = _frames[i + CurveTimeline2::VALUE2];
+			break;
+		}
+		default: {
+			value1 = getBezierValue(time, i, CurveTimeline2::VALUE1, curveType - CurveTimeline::BEZIER);
+			value2 = getBezierValue(time, i, CurveTimeline2::VALUE2,
+									curveType + CurveTimeline::BEZIER_SIZE - CurveTimeline::BEZIER);
+		}
+	}
+}
+
+void CurveTimeline2::getCurveValues(CurveTimeline2 **timelines, size_t count, float time, float *values) {
+	for (size_t i = 0; i < count; i++, values += 2) {
+#ifdef SPINE_CURVE_SSE2
+		if (i + 1 < count) _mm_prefetch((const char *) timelines[i + 1]->_frames.buffer(), _MM_HINT_T0);
+#endif
+		timelines[i]->getCurveValue(time, values[0], values[1]);
+	}
+}
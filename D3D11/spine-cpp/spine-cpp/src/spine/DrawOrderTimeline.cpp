@@ -42,6 +42,7 @@ using namespace spine;
 RTTI_IMPL(DrawOrderTimeline, Timeline)
 
 DrawOrderTimeline::DrawOrderTimeline(size_t frameCount) : Timeline(frameCount, 1) {
+	_type = TimelineType_DrawOrder;
 	PropertyId ids[] = {((PropertyId) Property_DrawOrder << 32)};
 	setPropertyIds(ids, 1);
 
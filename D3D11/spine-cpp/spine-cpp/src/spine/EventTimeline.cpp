@@ -46,6 +46,7 @@ using namespace spine;
 RTTI_IMPL(EventTimeline, Timeline)
 
 EventTimeline::EventTimeline(size_t frameCount) : Timeline(frameCount, 1) {
+	_type = TimelineType_Event;
 	PropertyId ids[] = {((PropertyId) Property_Event << 32)};
 	setPropertyIds(ids, 1);
 	_events.setSize(frameCount, NULL);
@@ -28,30 +28,99 @@
  *****************************************************************************/
 
 #include <spine/Extension.h>
+#include <spine/ArenaAllocator.h>
 #include <spine/SpineString.h>
 
 #include <assert.h>
+#include <atomic>
+#include <mutex>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif !defined(__EMSCRIPTEN__)
+#define SPINE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 using namespace spine;
 
-SpineExtension *SpineExtension::_instance = NULL;
+namespace {
+	std::atomic<SpineExtension *> instance(NULL);
+	std::once_flag defaultInstanceFlag;
+}
 
 void SpineExtension::setInstance(SpineExtension *inValue) {
 	assert(inValue);
 
-	_instance = inValue;
+	instance.store(inValue, std::memory_order_release);
 }
 
 SpineExtension *SpineExtension::getInstance() {
-	if (!_instance) _instance = spine::getDefaultExtension();
-	assert(_instance);
+	SpineExtension *result = instance.load(std::memory_order_acquire);
+	if (!result) {
+		std::call_once(defaultInstanceFlag, []() {
+			SpineExtension *expected = NULL;
+			instance.compare_exchange_strong(expected, spine::getDefaultExtension());
+		});
+		result = instance.load(std::memory_order_acquire);
+	}
+	assert(result);
 
-	return _instance;
+	return result;
+}
+
+void *SpineExtension::allocate(size_t size, bool clear, const char *file, int line) {
+	ArenaScope *scope = ArenaScope::getCurrent();
+	if (scope) {
+		void *ptr = scope->getArena().allocate(size);
+		if (ptr && clear) memset(ptr, 0, size);
+		if (ptr || size == 0) return ptr;
+	}
+	return clear ? getInstance()->_calloc(size, file, line) : getInstance()->_alloc(size, file, line);
+}
+
+void *SpineExtension::reallocate(void *ptr, size_t size, const char *file, int line) {
+	if (!ptr && ArenaScope::getCurrent()) return allocate(size, false, file, line);
+	if (ArenaAllocator::isArenaMemory(ptr)) {
+		// Grow within the owning arena while it is in scope on this thread, else move to the heap.
+		ArenaAllocator *owner = ArenaScope::findOwner(ptr);
+		void *result = owner ? owner->allocate(size) : NULL;
+		if (!result) result = getInstance()->_alloc(size, file, line);
+		size_t oldSize = ArenaAllocator::getSize(ptr);
+		if (result) memcpy(result, ptr, oldSize < size ? oldSize : size);
+		return result;
+	}
+	return getInstance()->_realloc(ptr, size, file, line);
+}
+
+void SpineExtension::deallocate(void *ptr, const char *file, int line) {
+	if (ArenaAllocator::isArenaMemory(ptr)) return;
+	getInstance()->_free(ptr, file, line);
 }
 
 SpineExtension::~SpineExtension() {
 }
 
+const char *SpineExtension::_mapFile(const String &path, int *length) {
+	SP_UNUSED(path);
+	*length = 0;
+	return NULL;
+}
+
+void SpineExtension::_unmapFile(const char *data, int length) {
+	SP_UNUSED(data);
+	SP_UNUSED(length);
+}
+
 SpineExtension::SpineExtension() {
 }
 
@@ -123,5 +192,56 @@ char *DefaultSpineExtension::_readFile(const String &path, int *length) {
 #endif
 }
 
+const char *DefaultSpineExtension::_mapFile(const String &path, int *length) {
+	*length = 0;
+#if defined(_WIN32)
+	HANDLE file = CreateFileA(path.buffer(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+	if (file == INVALID_HANDLE_VALUE) return NULL;
+	LARGE_INTEGER size;
+	const char *data = NULL;
+	if (GetFileSizeEx(file, &size) && size.QuadPart > 0 && size.QuadPart <= 0x7fffffff) {
+		HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+		if (mapping) {
+			// The view keeps the mapping alive after its handle is closed.
+			data = (const char *) MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+			CloseHandle(mapping);
+			if (data) *length = (int) size.QuadPart;
+		}
+	}
+	CloseHandle(file);
+	return data;
+#elif defined(SPINE_MMAP)
+	int fd = open(path.buffer(), O_RDONLY);
+	if (fd < 0) return NULL;
+	struct stat info;
+	const char *data = NULL;
+	if (fstat(fd, &info) == 0 && info.st_size > 0 && info.st_size <= 0x7fffffff) {
+		void *mapped = mmap(NULL, (size_t) info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (mapped != MAP_FAILED) {
+			posix_madvise(mapped, (size_t) info.st_size, POSIX_MADV_SEQUENTIAL);
+			data = (const char *) mapped;
+			*length = (int) info.st_size;
+		}
+	}
+	close(fd);
+	return data;
+#else
+	SP_UNUSED(path);
+	return NULL;
+#endif
+}
+
+void DefaultSpineExtension::_unmapFile(const char *data, int length) {
+	if (!data) return;
+#if defined(_WIN32)
+	SP_UNUSED(length);
+	UnmapViewOfFile(data);
+#elif defined(SPINE_MMAP)
+	munmap((void *) data, (size_t) length);
+#else
+	SP_UNUSED(length);
+#endif
+}
+
 DefaultSpineExtension::DefaultSpineExtension() : SpineExtension() {
 }
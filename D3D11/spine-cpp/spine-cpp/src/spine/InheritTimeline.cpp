@@ -43,6 +43,7 @@ RTTI_IMPL(InheritTimeline, Timeline)
 
 InheritTimeline::InheritTimeline(size_t frameCount, int boneIndex) : Timeline(frameCount, ENTRIES),
 																	 _boneIndex(boneIndex) {
+	_type = TimelineType_Inherit;
 	PropertyId ids[] = {((PropertyId) Property_Inherit << 32) | boneIndex};
 	setPropertyIds(ids, 1);
 }
@@ -73,9 +74,9 @@ void InheritTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vect
 	}
 
 	if (time < _frames[0]) {
-		if (blend == MixBlend_Setup || blend == MixBlend_First) bone->_inherit = bone->_data.getInherit();
+		if (blend == MixBlend_Setup || blend == MixBlend_First) bone->setInherit(bone->_data.getInherit());
 		return;
 	}
 	int idx = Animation::search(_frames, time, ENTRIES) + INHERIT;
-	bone->_inherit = static_cast<Inherit>(_frames[idx]);
+	bone->setInherit(static_cast<Inherit>(_frames[idx]));
 }
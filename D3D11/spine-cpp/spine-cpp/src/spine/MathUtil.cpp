@@ -32,6 +32,11 @@
 #include <stdlib.h>
 #include <cmath>
 
+#if !defined(SPINE_NO_SIMD) && (defined(_M_X64) || defined(__x86_64__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__))
+#define SPINE_TRIG_SSE2
+#include <emmintrin.h>
+#endif
+
 // Required for division by 0 in _isNaN on MSVC
 #ifdef _MSC_VER
 #pragma warning(disable : 4723)
@@ -45,6 +50,38 @@ const float MathUtil::InvPi_2 = 1 / MathUtil::Pi_2;
 const float MathUtil::Deg_Rad = (3.1415926535897932385f / 180.0f);
 const float MathUtil::Rad_Deg = (180.0f / 3.1415926535897932385f);
 
+#ifdef SPINE_FAST_TRIG
+bool MathUtil::_fastTrig = true;
+#else
+bool MathUtil::_fastTrig = false;
+#endif
+
+/* Fast trig: the angle is reduced by k quarter turns to r in [-pi/4, pi/4], then sin(r) and cos(r) are evaluated with minimax
+ * polynomials (Cephes sinf/cosf coefficients). Pi/2 is split in 3 parts so k times the first two is exact for |k| < 2^13. */
+static const float TrigLimit = 8192;
+static const float TwoOverPi = 0.636619772f;
+static const float HalfPiA = 1.5703125f;
+static const float HalfPiB = 4.83989715576171875e-4f;
+static const float HalfPiC = -1.62920684942946540e-7f;
+static const float SinP0 = -1.9515295891e-4f, SinP1 = 8.3321608736e-3f, SinP2 = -1.6666654611e-1f;
+static const float CosP0 = 2.443315711809948e-5f, CosP1 = -1.388731625493765e-3f, CosP2 = 4.166664568298827e-2f;
+
+static inline void fastSinCos(float x, float &sine, float &cosine) {
+	// Adding and subtracting 1.5 * 2^23 rounds to the nearest integer without a branch.
+	float fk = (x * TwoOverPi + 12582912.0f) - 12582912.0f;
+	int k = (int) fk;
+	float r = ((x - fk * HalfPiA) - fk * HalfPiB) - fk * HalfPiC;
+	float r2 = r * r;
+	float s = r + r * r2 * (SinP2 + r2 * (SinP1 + r2 * SinP0));
+	float c = 1 - 0.5f * r2 + r2 * r2 * (CosP2 + r2 * (CosP1 + r2 * CosP0));
+	// Odd quadrants swap sine and cosine, the sine is negated in quadrants 2 and 3, the cosine in 1 and 2.
+	bool swap = (k & 1) != 0;
+	sine = swap ? c : s;
+	cosine = swap ? s : c;
+	if (k & 2) sine = -sine;
+	if ((k + 1) & 2) cosine = -cosine;
+}
+
 float MathUtil::abs(float v) {
 	return ((v) < 0 ? -(v) : (v));
 }
@@ -72,16 +109,81 @@ float MathUtil::atan2Deg(float y, float x) {
 	return MathUtil::atan2(y, x) * MathUtil::Rad_Deg;
 }
 
-/// Returns the cosine in radians from a lookup table.
 float MathUtil::cos(float radians) {
+	if (_fastTrig && abs(radians) <= TrigLimit) {
+		float sine, cosine;
+		fastSinCos(radians, sine, cosine);
+		return cosine;
+	}
 	return (float) ::cos(radians);
 }
 
-/// Returns the sine in radians from a lookup table.
 float MathUtil::sin(float radians) {
+	if (_fastTrig && abs(radians) <= TrigLimit) {
+		float sine, cosine;
+		fastSinCos(radians, sine, cosine);
+		return sine;
+	}
 	return (float) ::sin(radians);
 }
 
+void MathUtil::sinCos(float radians, float &sine, float &cosine) {
+	if (_fastTrig && abs(radians) <= TrigLimit) {
+		fastSinCos(radians, sine, cosine);
+		return;
+	}
+	sine = (float) ::sin(radians);
+	cosine = (float) ::cos(radians);
+}
+
+void MathUtil::sinCos(const float *radians, float *sines, float *cosines, size_t count) {
+	size_t i = 0;
+#ifdef SPINE_TRIG_SSE2
+	if (_fastTrig) {
+		const __m128 limit = _mm_set1_ps(TrigLimit), signMask = _mm_set1_ps(-0.0f), one = _mm_set1_ps(1), half = _mm_set1_ps(0.5f);
+		for (; i + 4 <= count; i += 4) {
+			__m128 x = _mm_loadu_ps(radians + i);
+			// NaN and angles beyond the limit take the scalar path.
+			if (_mm_movemask_ps(_mm_cmple_ps(_mm_andnot_ps(signMask, x), limit)) != 0xf) {
+				for (size_t ii = i; ii < i + 4; ii++)
+					sinCos(radians[ii], sines[ii], cosines[ii]);
+				continue;
+			}
+			__m128i k = _mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(TwoOverPi)));
+			__m128 fk = _mm_cvtepi32_ps(k);
+			__m128 r = _mm_sub_ps(x, _mm_mul_ps(fk, _mm_set1_ps(HalfPiA)));
+			r = _mm_sub_ps(r, _mm_mul_ps(fk, _mm_set1_ps(HalfPiB)));
+			r = _mm_sub_ps(r, _mm_mul_ps(fk, _mm_set1_ps(HalfPiC)));
+			__m128 r2 = _mm_mul_ps(r, r);
+			__m128 s = _mm_add_ps(_mm_mul_ps(r2, _mm_set1_ps(SinP0)), _mm_set1_ps(SinP1));
+			s = _mm_add_ps(_mm_mul_ps(s, r2), _mm_set1_ps(SinP2));
+			s = _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(r, r2), s));
+			__m128 c = _mm_add_ps(_mm_mul_ps(r2, _mm_set1_ps(CosP0)), _mm_set1_ps(CosP1));
+			c = _mm_add_ps(_mm_mul_ps(c, r2), _mm_set1_ps(CosP2));
+			c = _mm_add_ps(_mm_sub_ps(one, _mm_mul_ps(half, r2)), _mm_mul_ps(_mm_mul_ps(r2, r2), c));
+			// Odd quadrants swap sine and cosine, the sine is negated in quadrants 2 and 3, the cosine in 1 and 2.
+			__m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(k, _mm_set1_epi32(1)), _mm_set1_epi32(1)));
+			__m128 sinSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(k, _mm_set1_epi32(2)), 30));
+			__m128 cosSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(k, _mm_set1_epi32(1)), _mm_set1_epi32(2)), 30));
+			__m128 sine = _mm_or_ps(_mm_and_ps(swap, c), _mm_andnot_ps(swap, s));
+			__m128 cosine = _mm_or_ps(_mm_and_ps(swap, s), _mm_andnot_ps(swap, c));
+			_mm_storeu_ps(sines + i, _mm_xor_ps(sine, sinSign));
+			_mm_storeu_ps(cosines + i, _mm_xor_ps(cosine, cosSign));
+		}
+	}
+#endif
+	for (; i < count; i++)
+		sinCos(radians[i], sines[i], cosines[i]);
+}
+
+void MathUtil::setFastTrig(bool fastTrig) {
+	_fastTrig = fastTrig;
+}
+
+bool MathUtil::isFastTrig() {
+	return _fastTrig;
+}
+
 float MathUtil::sqrt(float v) {
 	return (float) ::sqrt(v);
 }
@@ -90,14 +192,12 @@ float MathUtil::acos(float v) {
 	return (float) ::acos(v);
 }
 
-/// Returns the sine in radians from a lookup table.
 float MathUtil::sinDeg(float degrees) {
-	return (float) ::sin(degrees * MathUtil::Deg_Rad);
+	return sin(degrees * MathUtil::Deg_Rad);
 }
 
-/// Returns the cosine in radians from a lookup table.
 float MathUtil::cosDeg(float degrees) {
-	return (float) ::cos(degrees * MathUtil::Deg_Rad);
+	return cos(degrees * MathUtil::Deg_Rad);
 }
 
 bool MathUtil::isNan(float v) {
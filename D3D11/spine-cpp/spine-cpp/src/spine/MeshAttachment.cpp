@@ -33,7 +33,7 @@ using namespace spine;
 
 RTTI_IMPL(MeshAttachment, VertexAttachment)
 
-MeshAttachment::MeshAttachment(const String &name) : VertexAttachment(name),
+MeshAttachment::MeshAttachment(const String &name) : VertexAttachment(name, AttachmentType_Mesh),
 													 _parentMesh(NULL),
 													 _path(),
 													 _color(1, 1, 1, 1),
@@ -33,7 +33,7 @@ using namespace spine;
 
 RTTI_IMPL(PathAttachment, VertexAttachment)
 
-PathAttachment::PathAttachment(const String &name) : VertexAttachment(name), _closed(false), _constantSpeed(false),
+PathAttachment::PathAttachment(const String &name) : VertexAttachment(name, AttachmentType_Path), _closed(false), _constantSpeed(false),
 													 _color() {
 }
 
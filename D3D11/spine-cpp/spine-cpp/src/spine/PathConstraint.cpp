@@ -64,6 +64,16 @@ PathConstraint::PathConstraint(PathConstraintData &data, Skeleton &skeleton) : U
 	}
 
 	_segments.setSize(10, 0);
+	reserve(0);
+}
+
+void PathConstraint::reserve(size_t worldVerticesLength) {
+	size_t boneCount = _bones.size();
+	_spaces.ensureCapacity(boneCount + 1);
+	_lengths.ensureCapacity(boneCount);
+	_positions.ensureCapacity((boneCount + 1) * 3 + 2);
+	_world.ensureCapacity(MathUtil::max((size_t) 8, worldVerticesLength + 2));
+	_curves.ensureCapacity(worldVerticesLength / 6);
 }
 
 void PathConstraint::update(Physics) {
@@ -191,8 +201,7 @@ void PathConstraint::update(Physics) {
 			r -= MathUtil::atan2(c, a);
 
 			if (tip) {
-				cos = MathUtil::cos(r);
-				sin = MathUtil::sin(r);
+				MathUtil::sinCos(r, sin, cos);
 				float length = bone._data.getLength();
 				boneX += (length * (cos * a - sin * c) - dx) * mixRotate;
 				boneY += (length * (sin * a + cos * c) - dy) * mixRotate;
@@ -205,8 +214,7 @@ void PathConstraint::update(Physics) {
 				r += MathUtil::Pi_2;
 
 			r *= mixRotate;
-			cos = MathUtil::cos(r);
-			sin = MathUtil::sin(r);
+			MathUtil::sinCos(r, sin, cos);
 			bone._a = cos * a - sin * c;
 			bone._b = cos * b - sin * d;
 			bone._c = sin * a + cos * c;
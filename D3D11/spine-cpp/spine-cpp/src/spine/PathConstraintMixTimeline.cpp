@@ -46,6 +46,7 @@ RTTI_IMPL(PathConstraintMixTimeline, CurveTimeline)
 PathConstraintMixTimeline::PathConstraintMixTimeline(size_t frameCount, size_t bezierCount, int pathConstraintIndex)
 	: CurveTimeline(frameCount, PathConstraintMixTimeline::ENTRIES, bezierCount),
 	  _constraintIndex(pathConstraintIndex) {
+	_type = TimelineType_PathConstraintMix;
 	PropertyId ids[] = {((PropertyId) Property_PathConstraintMix << 32) | pathConstraintIndex};
 	setPropertyIds(ids, 1);
 }
@@ -48,6 +48,7 @@ PathConstraintPositionTimeline::PathConstraintPositionTimeline(size_t frameCount
 																										 bezierCount),
 																						  _constraintIndex(
 																								  pathConstraintIndex) {
+	_type = TimelineType_PathConstraintPosition;
 	PropertyId ids[] = {((PropertyId) Property_PathConstraintPosition << 32) | pathConstraintIndex};
 	setPropertyIds(ids, 1);
 }
@@ -48,6 +48,7 @@ PathConstraintSpacingTimeline::PathConstraintSpacingTimeline(size_t frameCount,
 																									   bezierCount),
 																						_pathConstraintIndex(
 																								pathConstraintIndex) {
+	_type = TimelineType_PathConstraintSpacing;
 	PropertyId ids[] = {((PropertyId) Property_PathConstraintSpacing << 32) | pathConstraintIndex};
 	setPropertyIds(ids, 1);
 }
@@ -68,6 +68,9 @@ PhysicsConstraint::PhysicsConstraint(PhysicsConstraintData &data, Skeleton &skel
 	_active = false;
 	_remaining = 0;
 	_lastTime = 0;
+	_powDamping = _damping;
+	_powStep = data._step;
+	_dampingPower = MathUtil::pow(_damping, 60 * data._step);
 }
 
 PhysicsConstraintData &PhysicsConstraint::getData() {
@@ -305,6 +308,17 @@ void PhysicsConstraint::setToSetupPose() {
 	_gravity = _data.getGravity();
 	_mix = _data.getMix();
 }
+
+float PhysicsConstraint::getDampingPower(float step) {
+	// Damping only changes when set or keyed, so pow is not needed for every constraint every frame.
+	if (_damping != _powDamping || step != _powStep) {
+		_powDamping = _damping;
+		_powStep = step;
+		_dampingPower = MathUtil::pow(_damping, 60 * step);
+	}
+	return _dampingPower;
+}
+
 void PhysicsConstraint::update(Physics physics) {
 	float mix = _mix;
 	if (mix == 0) return;
@@ -327,6 +341,14 @@ void PhysicsConstraint::update(Physics physics) {
 			float delta = MathUtil::max(_skeleton.getTime() - _lastTime, 0.0f);
 			_remaining += delta;
 			_lastTime = _skeleton.getTime();
+			int maxSteps = _skeleton._physicsMaxSteps;
+			if (maxSteps > 0) {
+				float limit = maxSteps * _data._step;
+				if (_remaining > limit) {
+					_skeleton._physicsTimeDropped = MathUtil::max(_skeleton._physicsTimeDropped, _remaining - limit);
+					_remaining = limit;
+				}
+			}
 
 			float bx = bone->_worldX, by = bone->_worldY;
 			if (_reset) {
@@ -335,6 +357,14 @@ void PhysicsConstraint::update(Physics physics) {
 				_uy = by;
 			} else {
 				float a = _remaining, i = _inertia, t = _data._step, f = _skeleton.getData()->getReferenceScale();
+				// The substeps are counted once, both loops below take exactly these.
+				int steps = 0;
+				if (x || y || rotateOrShearX || scaleX) {
+					while (a >= t) {
+						a -= t;
+						steps++;
+					}
+				}
 				float qx = _data._limit * delta, qy = qx * MathUtil::abs(_skeleton.getScaleX());
 				qx *= MathUtil::abs(_skeleton.getScaleY());
 				if (x || y) {
@@ -350,10 +380,10 @@ void PhysicsConstraint::update(Physics physics) {
 														  : u;
 						_uy = by;
 					}
-					if (a >= t) {
-						float d = MathUtil::pow(_damping, 60 * t);
+					if (steps > 0) {
+						float d = getDampingPower(t);
 						float m = _massInverse * t, e = _strength, w = _wind * f * _skeleton.getScaleX(), g = _gravity * f * _skeleton.getScaleY();
-						do {
+						for (int n = 0; n < steps; n++) {
 							if (x) {
 								_xVelocity += (w - _xOffset * e) * m;
 								_xOffset += _xVelocity * t;
@@ -364,8 +394,7 @@ void PhysicsConstraint::update(Physics physics) {
 								_yOffset += _yVelocity * t;
 								_yVelocity *= d;
 							}
-							a -= t;
-						} while (a >= t);
+						}
 					}
 					if (x) bone->_worldX += _xOffset * mix * _data._x;
 					if (y) bone->_worldY += _yOffset * mix * _data._y;
@@ -387,24 +416,20 @@ void PhysicsConstraint::update(Physics physics) {
 						float r = MathUtil::atan2(dy + _ty, dx + _tx) - ca - _rotateOffset * mr;
 						_rotateOffset += (r - MathUtil::ceil(r * MathUtil::InvPi_2 - 0.5f) * MathUtil::Pi_2) * i;
 						r = _rotateOffset * mr + ca;
-						c = MathUtil::cos(r);
-						s = MathUtil::sin(r);
+						MathUtil::sinCos(r, s, c);
 						if (scaleX) {
 							r = l * bone->getWorldScaleX();
 							if (r > 0) _scaleOffset += (dx * c + dy * s) * i / r;
 						}
 					} else {
-						c = MathUtil::cos(ca);
-						s = MathUtil::sin(ca);
+						MathUtil::sinCos(ca, s, c);
 						float r = l * bone->getWorldScaleX();
 						if (r > 0) _scaleOffset += (dx * c + dy * s) * i / r;
 					}
-					a = _remaining;
-					if (a >= t) {
+					if (steps > 0) {
 						float m = _massInverse * t, e = _strength, w = _wind, g = _gravity * (Bone::yDown ? -1 : 1), h = l / f;
-						float d = MathUtil::pow(_damping, 60 * t);
-						while (true) {
-							a -= t;
+						float d = getDampingPower(t);
+						for (int n = steps; n > 0; n--) {
 							if (scaleX) {
 								_scaleVelocity += (w * c - g * s - _scaleOffset * e) * m;
 								_scaleOffset += _scaleVelocity * t;
@@ -414,16 +439,13 @@ void PhysicsConstraint::update(Physics physics) {
 								_rotateVelocity -= ((w * s + g * c) * h + _rotateOffset * e) * m;
 								_rotateOffset += _rotateVelocity * t;
 								_rotateVelocity *= d;
-								if (a < t) break;
-								float r = _rotateOffset * mr + ca;
-								c = MathUtil::cos(r);
-								s = MathUtil::sin(r);
-							} else if (a < t)//
-								break;
+								if (n > 1) MathUtil::sinCos(_rotateOffset * mr + ca, s, c);
+							}
 						}
 					}
 				}
 				_remaining = a;
+				_skeleton._physicsSteps += steps;
 			}
 
 			_cx = bone->_worldX;
@@ -443,22 +465,19 @@ void PhysicsConstraint::update(Physics physics) {
 			float r = 0;
 			if (_data._rotate > 0) {
 				r = o * _data._rotate;
-				s = MathUtil::sin(r);
-				c = MathUtil::cos(r);
+				MathUtil::sinCos(r, s, c);
 				a = bone->_b;
 				bone->_b = c * a - s * bone->_d;
 				bone->_d = s * a + c * bone->_d;
 			}
 			r += o * _data._shearX;
-			s = MathUtil::sin(r);
-			c = MathUtil::cos(r);
+			MathUtil::sinCos(r, s, c);
 			a = bone->_a;
 			bone->_a = c * a - s * bone->_c;
 			bone->_c = s * a + c * bone->_c;
 		} else {
 			o *= _data._rotate;
-			s = MathUtil::sin(o);
-			c = MathUtil::cos(o);
+			MathUtil::sinCos(o, s, c);
 			a = bone->_a;
 			bone->_a = c * a - s * bone->_c;
 			bone->_c = s * a + c * bone->_c;
@@ -54,6 +54,7 @@ RTTI_IMPL(PhysicsConstraintResetTimeline, Timeline)
 PhysicsConstraintTimeline::PhysicsConstraintTimeline(size_t frameCount, size_t bezierCount,
 													 int constraintIndex, Property property) : CurveTimeline1(frameCount, bezierCount),
 																							   _constraintIndex(constraintIndex) {
+	_type = TimelineType_PhysicsConstraint;
 	PropertyId ids[] = {((PropertyId) property << 32) | constraintIndex};
 	setPropertyIds(ids, 1);
 }
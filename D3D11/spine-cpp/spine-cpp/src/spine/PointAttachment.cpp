@@ -37,7 +37,7 @@ using namespace spine;
 
 RTTI_IMPL(PointAttachment, Attachment)
 
-PointAttachment::PointAttachment(const String &name) : Attachment(name), _x(0), _y(0), _rotation(0), _color() {
+PointAttachment::PointAttachment(const String &name) : Attachment(name, AttachmentType_Point), _x(0), _y(0), _rotation(0), _color() {
 }
 
 void PointAttachment::computeWorldPosition(Bone &bone, float &ox, float &oy) {
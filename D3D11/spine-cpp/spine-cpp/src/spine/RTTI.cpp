@@ -28,7 +28,8 @@
  *****************************************************************************/
 
 #include <spine/RTTI.h>
-#include <spine/SpineString.h>
+
+#include <stddef.h>
 
 using namespace spine;
 
@@ -41,16 +42,3 @@ RTTI::RTTI(const char *className, const RTTI &baseRTTI) : _className(className),
 const char *RTTI::getClassName() const {
 	return _className;
 }
-
-bool RTTI::isExactly(const RTTI &rtti) const {
-	return !strcmp(this->_className, rtti._className);
-}
-
-bool RTTI::instanceOf(const RTTI &rtti) const {
-	const RTTI *pCompare = this;
-	while (pCompare) {
-		if (!strcmp(pCompare->_className, rtti._className)) return true;
-		pCompare = pCompare->_pBaseRTTI;
-	}
-	return false;
-}
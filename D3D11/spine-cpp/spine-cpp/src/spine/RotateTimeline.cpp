@@ -44,6 +44,7 @@ RTTI_IMPL(RotateTimeline, CurveTimeline1)
 RotateTimeline::RotateTimeline(size_t frameCount, size_t bezierCount, int boneIndex) : CurveTimeline1(frameCount,
 																									  bezierCount),
 																					   _boneIndex(boneIndex) {
+	_type = TimelineType_Rotate;
 	PropertyId ids[] = {((PropertyId) Property_Rotate << 32) | boneIndex};
 	setPropertyIds(ids, 1);
 }
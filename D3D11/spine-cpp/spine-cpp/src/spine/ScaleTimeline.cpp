@@ -44,6 +44,7 @@ RTTI_IMPL(ScaleTimeline, CurveTimeline2)
 ScaleTimeline::ScaleTimeline(size_t frameCount, size_t bezierCount, int boneIndex) : CurveTimeline2(frameCount,
 																									bezierCount),
 																					 _boneIndex(boneIndex) {
+	_type = TimelineType_Scale;
 	PropertyId ids[] = {((PropertyId) Property_ScaleX << 32) | boneIndex,
 						((PropertyId) Property_ScaleY << 32) | boneIndex};
 	setPropertyIds(ids, 2);
@@ -158,6 +159,7 @@ RTTI_IMPL(ScaleXTimeline, CurveTimeline1)
 ScaleXTimeline::ScaleXTimeline(size_t frameCount, size_t bezierCount, int boneIndex) : CurveTimeline1(frameCount,
 																									  bezierCount),
 																					   _boneIndex(boneIndex) {
+	_type = TimelineType_ScaleX;
 	PropertyId ids[] = {((PropertyId) Property_ScaleX << 32) | boneIndex};
 	setPropertyIds(ids, 1);
 }
@@ -178,6 +180,7 @@ RTTI_IMPL(ScaleYTimeline, CurveTimeline1)
 ScaleYTimeline::ScaleYTimeline(size_t frameCount, size_t bezierCount, int boneIndex) : CurveTimeline1(frameCount,
 																									  bezierCount),
 																					   _boneIndex(boneIndex) {
+	_type = TimelineType_ScaleY;
 	PropertyId ids[] = {((PropertyId) Property_ScaleY << 32) | boneIndex};
 	setPropertyIds(ids, 1);
 }
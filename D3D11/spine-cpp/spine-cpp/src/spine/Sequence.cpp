@@ -63,7 +63,7 @@ void Sequence::apply(Slot *slot, Attachment *attachment) {
 	if (index >= (int) _regions.size()) index = (int) _regions.size() - 1;
 	TextureRegion *region = _regions[index];
 
-	if (attachment->getRTTI().isExactly(RegionAttachment::rtti)) {
+	if (attachment->getType() == AttachmentType_Region) {
 		RegionAttachment *regionAttachment = static_cast<RegionAttachment *>(attachment);
 		if (regionAttachment->getRegion() != region) {
 			regionAttachment->setRegion(region);
@@ -71,7 +71,7 @@ void Sequence::apply(Slot *slot, Attachment *attachment) {
 		}
 	}
 
-	if (attachment->getRTTI().isExactly(MeshAttachment::rtti)) {
+	if (attachment->getType() == AttachmentType_Mesh) {
 		MeshAttachment *meshAttachment = static_cast<MeshAttachment *>(attachment);
 		if (meshAttachment->getRegion() != region) {
 			meshAttachment->setRegion(region);
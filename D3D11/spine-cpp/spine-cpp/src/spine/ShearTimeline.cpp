@@ -44,6 +44,7 @@ RTTI_IMPL(ShearTimeline, CurveTimeline2)
 ShearTimeline::ShearTimeline(size_t frameCount, size_t bezierCount, int boneIndex) : CurveTimeline2(frameCount,
 																									bezierCount),
 																					 _boneIndex(boneIndex) {
+	_type = TimelineType_Shear;
 	PropertyId ids[] = {((PropertyId) Property_ShearX << 32) | boneIndex,
 						((PropertyId) Property_ShearY << 32) | boneIndex};
 	setPropertyIds(ids, 2);
@@ -122,6 +123,7 @@ RTTI_IMPL(ShearXTimeline, CurveTimeline1)
 ShearXTimeline::ShearXTimeline(size_t frameCount, size_t bezierCount, int boneIndex) : CurveTimeline1(frameCount,
 																									  bezierCount),
 																					   _boneIndex(boneIndex) {
+	_type = TimelineType_ShearX;
 	PropertyId ids[] = {((PropertyId) Property_ShearX << 32) | boneIndex};
 	setPropertyIds(ids, 1);
 }
@@ -144,6 +146,7 @@ RTTI_IMPL(ShearYTimeline, CurveTimeline1)
 ShearYTimeline::ShearYTimeline(size_t frameCount, size_t bezierCount, int boneIndex) : CurveTimeline1(frameCount,
 																									  bezierCount),
 																					   _boneIndex(boneIndex) {
+	_type = TimelineType_ShearY;
 	PropertyId ids[] = {((PropertyId) Property_ShearX << 32) | boneIndex};
 	setPropertyIds(ids, 1);
 }
@@ -41,7 +41,9 @@
 
 #include <spine/BoneData.h>
 #include <spine/IkConstraintData.h>
+#include <spine/Animation.h>
 #include <spine/ClippingAttachment.h>
+#include <spine/DeformTimeline.h>
 #include <spine/MeshAttachment.h>
 #include <spine/PathAttachment.h>
 #include <spine/PathConstraintData.h>
@@ -52,26 +54,41 @@
 #include <spine/SkeletonClipping.h>
 
 #include <spine/ContainerUtil.h>
+#include <spine/Extension.h>
 
 #include <float.h>
 
 using namespace spine;
 
 Skeleton::Skeleton(SkeletonData *skeletonData)
-	: _data(skeletonData), _skin(NULL), _color(1, 1, 1, 1), _scaleX(1),
-	  _scaleY(1), _x(0), _y(0), _time(0) {
-	_bones.ensureCapacity(_data->getBones().size());
-	for (size_t i = 0; i < _data->getBones().size(); ++i) {
+	: _data(skeletonData), _compactBones(NULL), _skin(NULL), _color(1, 1, 1, 1), _scaleX(1),
+	  _scaleY(1), _x(0), _y(0), _time(0), _appliedX(0), _appliedY(0), _appliedScaleX(1), _appliedScaleY(1),
+	  _updatedBoneCount(0), _physicsMaxSteps(0), _physicsSteps(0), _physicsTimeDropped(0) {
+	init(false);
+}
+
+Skeleton::Skeleton(SkeletonData *skeletonData, bool compactPose)
+	: _data(skeletonData), _compactBones(NULL), _skin(NULL), _color(1, 1, 1, 1), _scaleX(1),
+	  _scaleY(1), _x(0), _y(0), _time(0), _appliedX(0), _appliedY(0), _appliedScaleX(1), _appliedScaleY(1),
+	  _updatedBoneCount(0), _physicsMaxSteps(0), _physicsSteps(0), _physicsTimeDropped(0) {
+	init(compactPose);
+}
+
+void Skeleton::init(bool compactPose) {
+	size_t boneCount = _data->getBones().size();
+	_bones.ensureCapacity(boneCount);
+	// Bone data is sorted parent first, so the compact block is too.
+	if (compactPose && boneCount > 0) _compactBones = SpineExtension::alloc<Bone>(boneCount, __FILE__, __LINE__);
+	for (size_t i = 0; i < boneCount; ++i) {
 		BoneData *data = _data->getBones()[i];
 
+		Bone *parent = data->getParent() == NULL ? NULL : _bones[data->getParent()->getIndex()];
 		Bone *bone;
-		if (data->getParent() == NULL) {
-			bone = new (__FILE__, __LINE__) Bone(*data, *this, NULL);
-		} else {
-			Bone *parent = _bones[data->getParent()->getIndex()];
+		if (_compactBones)
+			bone = new (_compactBones + i) Bone(*data, *this, parent);
+		else
 			bone = new (__FILE__, __LINE__) Bone(*data, *this, parent);
-			parent->getChildren().add(bone);
-		}
+		if (parent) parent->getChildren().add(bone);
 
 		_bones.add(bone);
 	}
@@ -132,7 +149,13 @@ Skeleton::Skeleton(SkeletonData *skeletonData)
 }
 
 Skeleton::~Skeleton() {
-	ContainerUtil::cleanUpVectorOfPointers(_bones);
+	if (_compactBones) {
+		for (size_t i = 0, n = _bones.size(); i < n; i++)
+			_bones[i]->~Bone();
+		SpineExtension::free(_compactBones, __FILE__, __LINE__);
+		_bones.clear();
+	} else
+		ContainerUtil::cleanUpVectorOfPointers(_bones);
 	ContainerUtil::cleanUpVectorOfPointers(_slots);
 	ContainerUtil::cleanUpVectorOfPointers(_ikConstraints);
 	ContainerUtil::cleanUpVectorOfPointers(_transformConstraints);
@@ -211,6 +234,44 @@ continue_outer:
 	for (i = 0; i < n; ++i) {
 		sortBone(_bones[i]);
 	}
+
+	updateCacheBones();
+}
+
+void Skeleton::updateCacheBones() {
+	size_t n = _updateCache.size();
+	_updateCacheBones.setSize(n, NULL);
+	for (size_t i = 0; i < n; i++) {
+		Updatable *updatable = _updateCache[i];
+		_updateCacheBones[i] = updatable->getRTTI().isExactly(Bone::rtti) ? static_cast<Bone *>(updatable) : NULL;
+	}
+	// Bones may have been activated or reparented in the cache, so none of the world transforms can be reused.
+	for (size_t i = 0, nn = _bones.size(); i < nn; i++)
+		_bones[i]->_dirty = true;
+}
+
+void Skeleton::invalidateConstrainedBones(Updatable *constraint) {
+	const RTTI &rtti = constraint->getRTTI();
+	Vector<Bone *> *bones;
+	if (rtti.isExactly(IkConstraint::rtti))
+		bones = &static_cast<IkConstraint *>(constraint)->getBones();
+	else if (rtti.isExactly(TransformConstraint::rtti))
+		bones = &static_cast<TransformConstraint *>(constraint)->getBones();
+	else if (rtti.isExactly(PathConstraint::rtti))
+		bones = &static_cast<PathConstraint *>(constraint)->getBones();
+	else {
+		if (rtti.isExactly(PhysicsConstraint::rtti)) {
+			Bone *bone = static_cast<PhysicsConstraint *>(constraint)->getBone();
+			bone->_dirty = true;
+			bone->_updated = true;
+		}
+		return;
+	}
+	for (size_t i = 0, n = bones->size(); i < n; i++) {
+		Bone *bone = (*bones)[i];
+		bone->_dirty = true;
+		bone->_updated = true;
+	}
 }
 
 void Skeleton::printUpdateCache() {
@@ -235,8 +296,25 @@ void Skeleton::printUpdateCache() {
 }
 
 void Skeleton::updateWorldTransform(Physics physics) {
+	_physicsSteps = 0;
+	_physicsTimeDropped = 0;
+
+	// Root and scale dependent world transforms change with the skeleton transform.
+	bool all = _x != _appliedX || _y != _appliedY || _scaleX != _appliedScaleX || _scaleY != _appliedScaleY;
+	_appliedX = _x;
+	_appliedY = _y;
+	_appliedScaleX = _scaleX;
+	_appliedScaleY = _scaleY;
+
+	// A bone is dirty if its local transform differs from the applied transform its world transform was computed from. This
+	// catches every writer of the local transform (timelines, setters, setToSetupPose) without each having to flag the bone.
 	for (size_t i = 0, n = _bones.size(); i < n; i++) {
 		Bone *bone = _bones[i];
+		if (all || bone->_ax != bone->_x || bone->_ay != bone->_y || bone->_arotation != bone->_rotation ||
+			bone->_ascaleX != bone->_scaleX || bone->_ascaleY != bone->_scaleY || bone->_ashearX != bone->_shearX ||
+			bone->_ashearY != bone->_shearY)
+			bone->_dirty = true;
+		bone->_updated = false;
 		bone->_ax = bone->_x;
 		bone->_ay = bone->_y;
 		bone->_arotation = bone->_rotation;
@@ -246,30 +324,48 @@ void Skeleton::updateWorldTransform(Physics physics) {
 		bone->_ashearY = bone->_shearY;
 	}
 
+	// Bones in the update cache are updated directly instead of through Updatable::update. The cache is parent first, so a
+	// clean bone whose parent was not updated keeps its world transform. Constraints modify world transforms directly, so
+	// their bones are recomputed on the next call and their children on this one.
+	size_t updated = 0;
 	for (size_t i = 0, n = _updateCache.size(); i < n; ++i) {
-		Updatable *updatable = _updateCache[i];
-		updatable->update(physics);
+		Bone *bone = _updateCacheBones[i];
+		if (bone) {
+			if (!bone->_dirty && !(bone->_parent && bone->_parent->_updated)) continue;
+			bone->updateWorldTransform(bone->_ax, bone->_ay, bone->_arotation, bone->_ascaleX, bone->_ascaleY, bone->_ashearX, bone->_ashearY);
+			updated++;
+		} else {
+			_updateCache[i]->update(physics);
+			invalidateConstrainedBones(_updateCache[i]);
+		}
 	}
+	_updatedBoneCount = updated;
+	_boneMatrices.invalidate();
 }
 
 void Skeleton::updateWorldTransform(Physics physics, Bone *parent) {
 	// Apply the parent bone transform to the root bone. The root bone always
 	// inherits scale, rotation and reflection.
+	_boneMatrices.invalidate();
+	_physicsSteps = 0;
+	_physicsTimeDropped = 0;
 	Bone *rootBone = getRootBone();
 	float pa = parent->_a, pb = parent->_b, pc = parent->_c, pd = parent->_d;
 	rootBone->_worldX = pa * _x + pb * _y + parent->_worldX;
 	rootBone->_worldY = pc * _x + pd * _y + parent->_worldY;
 
-	float rx = (rootBone->_rotation + rootBone->_shearX) * MathUtil::Deg_Rad;
-	float ry = (rootBone->_rotation + 90 + rootBone->_shearY) * MathUtil::Deg_Rad;
-	float la = MathUtil::cos(rx) * rootBone->_scaleX;
-	float lb = MathUtil::cos(ry) * rootBone->_scaleY;
-	float lc = MathUtil::sin(rx) * rootBone->_scaleX;
-	float ld = MathUtil::sin(ry) * rootBone->_scaleY;
+	float sinX, cosX, sinY, cosY;
+	MathUtil::sinCos((rootBone->_rotation + rootBone->_shearX) * MathUtil::Deg_Rad, sinX, cosX);
+	MathUtil::sinCos((rootBone->_rotation + 90 + rootBone->_shearY) * MathUtil::Deg_Rad, sinY, cosY);
+	float la = cosX * rootBone->_scaleX;
+	float lb = cosY * rootBone->_scaleY;
+	float lc = sinX * rootBone->_scaleX;
+	float ld = sinY * rootBone->_scaleY;
 	rootBone->_a = (pa * la + pb * lc) * _scaleX;
 	rootBone->_b = (pa * lb + pb * ld) * _scaleX;
 	rootBone->_c = (pc * la + pd * lc) * _scaleY;
 	rootBone->_d = (pc * lb + pd * ld) * _scaleY;
+	rootBone->_dirty = true;
 
 	// Update everything except root bone.
 	Bone *rb = getRootBone();
@@ -280,11 +376,36 @@ void Skeleton::updateWorldTransform(Physics physics, Bone *parent) {
 	}
 }
 
+void Skeleton::updateBoneMatrices() {
+	_boneMatrices.update(_bones);
+}
+
+BoneMatrices &Skeleton::getBoneMatrices() {
+	return _boneMatrices;
+}
+
+size_t Skeleton::getUpdatedBoneCount() {
+	return _updatedBoneCount;
+}
+
 void Skeleton::setToSetupPose() {
 	setBonesToSetupPose();
 	setSlotsToSetupPose();
 }
 
+void Skeleton::reserveDeform() {
+	Vector<Animation *> &animations = _data->getAnimations();
+	for (size_t i = 0; i < animations.size(); ++i) {
+		Vector<Timeline *> &timelines = animations[i]->getTimelines();
+		for (size_t ii = 0; ii < timelines.size(); ++ii) {
+			if (!timelines[ii]->getRTTI().isExactly(DeformTimeline::rtti)) continue;
+			DeformTimeline *timeline = static_cast<DeformTimeline *>(timelines[ii]);
+			if (timeline->getVertices().size() == 0) continue;
+			_slots[timeline->getSlotIndex()]->getDeform().ensureCapacity(timeline->getVertices()[0].size());
+		}
+	}
+}
+
 void Skeleton::setBonesToSetupPose() {
 	for (size_t i = 0, n = _bones.size(); i < n; ++i) {
 		_bones[i]->setToSetupPose();
@@ -319,11 +440,13 @@ void Skeleton::setSlotsToSetupPose() {
 }
 
 Bone *Skeleton::findBone(const String &boneName) {
-	return ContainerUtil::findWithDataName(_bones, boneName);
+	int index = _data->findBoneIndex(boneName);
+	return index == -1 ? NULL : _bones[index];
 }
 
 Slot *Skeleton::findSlot(const String &slotName) {
-	return ContainerUtil::findWithDataName(_slots, slotName);
+	int index = _data->findSlotIndex(slotName);
+	return index == -1 ? NULL : _slots[index];
 }
 
 void Skeleton::setSkin(const String &skinName) {
@@ -405,56 +528,25 @@ void Skeleton::setAttachment(const String &slotName,
 }
 
 IkConstraint *Skeleton::findIkConstraint(const String &constraintName) {
-	assert(constraintName.length() > 0);
-
-	for (size_t i = 0, n = _ikConstraints.size(); i < n; ++i) {
-		IkConstraint *ikConstraint = _ikConstraints[i];
-		if (ikConstraint->_data.getName() == constraintName) {
-			return ikConstraint;
-		}
-	}
-	return NULL;
+	int index = _data->findIkConstraintIndex(constraintName);
+	return index == -1 ? NULL : _ikConstraints[index];
 }
 
 TransformConstraint *
 Skeleton::findTransformConstraint(const String &constraintName) {
-	assert(constraintName.length() > 0);
-
-	for (size_t i = 0, n = _transformConstraints.size(); i < n; ++i) {
-		TransformConstraint *transformConstraint = _transformConstraints[i];
-		if (transformConstraint->_data.getName() == constraintName) {
-			return transformConstraint;
-		}
-	}
-
-	return NULL;
+	int index = _data->findTransformConstraintIndex(constraintName);
+	return index == -1 ? NULL : _transformConstraints[index];
 }
 
 PathConstraint *Skeleton::findPathConstraint(const String &constraintName) {
-	assert(constraintName.length() > 0);
-
-	for (size_t i = 0, n = _pathConstraints.size(); i < n; ++i) {
-		PathConstraint *constraint = _pathConstraints[i];
-		if (constraint->_data.getName() == constraintName) {
-			return constraint;
-		}
-	}
-
-	return NULL;
+	int index = _data->findPathConstraintIndex(constraintName);
+	return index == -1 ? NULL : _pathConstraints[index];
 }
 
 PhysicsConstraint *
 Skeleton::findPhysicsConstraint(const String &constraintName) {
-	assert(constraintName.length() > 0);
-
-	for (size_t i = 0, n = _physicsConstraints.size(); i < n; ++i) {
-		PhysicsConstraint *constraint = _physicsConstraints[i];
-		if (constraint->_data.getName() == constraintName) {
-			return constraint;
-		}
-	}
-
-	return NULL;
+	int index = _data->findPhysicsConstraintIndex(constraintName);
+	return index == -1 ? NULL : _physicsConstraints[index];
 }
 
 void Skeleton::getBounds(float &outX, float &outY, float &outWidth,
@@ -543,7 +635,9 @@ SkeletonData *Skeleton::getData() { return _data; }
 
 Vector<Bone *> &Skeleton::getBones() { return _bones; }
 
-Vector<Updatable *> &Skeleton::getUpdateCacheList() { return _updateCache; }
+const Vector<Updatable *> &Skeleton::getUpdateCacheList() { return _updateCache; }
+
+bool Skeleton::isCompactPose() { return _compactBones != NULL; }
 
 Vector<Slot *> &Skeleton::getSlots() { return _slots; }
 
@@ -761,6 +855,14 @@ void Skeleton::setTime(float time) { _time = time; }
 
 void Skeleton::update(float delta) { _time += delta; }
 
+void Skeleton::setPhysicsMaxSteps(int steps) { _physicsMaxSteps = steps; }
+
+int Skeleton::getPhysicsMaxSteps() { return _physicsMaxSteps; }
+
+int Skeleton::getPhysicsSteps() { return _physicsSteps; }
+
+float Skeleton::getPhysicsTimeDropped() { return _physicsTimeDropped; }
+
 void Skeleton::physicsTranslate(float x, float y) {
 	for (int i = 0; i < (int) _physicsConstraints.size(); i++) {
 		_physicsConstraints[i]->translate(x, y);
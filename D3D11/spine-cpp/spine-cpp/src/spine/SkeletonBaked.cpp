@@ -0,0 +1,980 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated April 5, 2025. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2025, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/SkeletonBaked.h>
+
+#include <spine/Animation.h>
+#include <spine/Atlas.h>
+#include <spine/AtlasAttachmentLoader.h>
+#include <spine/AttachmentTimeline.h>
+#include <spine/BoneData.h>
+#include <spine/BoundingBoxAttachment.h>
+#include <spine/ClippingAttachment.h>
+#include <spine/ColorTimeline.h>
+#include <spine/ContainerUtil.h>
+#include <spine/CurveTimeline.h>
+#include <spine/DeformTimeline.h>
+#include <spine/DrawOrderTimeline.h>
+#include <spine/Event.h>
+#include <spine/EventData.h>
+#include <spine/EventTimeline.h>
+#include <spine/IkConstraintData.h>
+#include <spine/IkConstraintTimeline.h>
+#include <spine/InheritTimeline.h>
+#include <spine/MeshAttachment.h>
+#include <spine/PathAttachment.h>
+#include <spine/PathConstraintData.h>
+#include <spine/PathConstraintMixTimeline.h>
+#include <spine/PathConstraintPositionTimeline.h>
+#include <spine/PathConstraintSpacingTimeline.h>
+#include <spine/PhysicsConstraintData.h>
+#include <spine/PhysicsConstraintTimeline.h>
+#include <spine/PointAttachment.h>
+#include <spine/RegionAttachment.h>
+#include <spine/RotateTimeline.h>
+#include <spine/ScaleTimeline.h>
+#include <spine/Sequence.h>
+#include <spine/SequenceTimeline.h>
+#include <spine/ShearTimeline.h>
+#include <spine/SkeletonData.h>
+#include <spine/Skin.h>
+#include <spine/SlotData.h>
+#include <spine/TransformConstraintData.h>
+#include <spine/TransformConstraintTimeline.h>
+#include <spine/TranslateTimeline.h>
+#include <spine/Version.h>
+
+using namespace spine;
+
+SkeletonBaked::SkeletonBaked(Atlas *atlas) : _attachmentLoader(new (__FILE__, __LINE__) AtlasAttachmentLoader(atlas)),
+											 _error(), _ownsLoader(true) {
+}
+
+SkeletonBaked::SkeletonBaked(AttachmentLoader *attachmentLoader, bool ownsLoader) : _attachmentLoader(attachmentLoader),
+																					_error(),
+																					_ownsLoader(ownsLoader) {
+	assert(_attachmentLoader != NULL);
+}
+
+SkeletonBaked::~SkeletonBaked() {
+	if (_ownsLoader) delete _attachmentLoader;
+}
+
+bool SkeletonBaked::isBaked(const unsigned char *data, int length) {
+	int magic;
+	if (!data || length < 16) return false;
+	memcpy(&magic, data, 4);
+	return magic == MAGIC;
+}
+
+SkeletonData *SkeletonBaked::readSkeletonData(const unsigned char *data, const int length) {
+	_error = "";
+	_linkedMeshes.clear();
+
+	if (!isBaked(data, length)) {
+		setError("Not baked skeleton data.", NULL);
+		return NULL;
+	}
+
+	DataInput input;
+	input.cursor = data;
+	input.end = data + length;
+	input.overflow = false;
+
+	readInt(&input);
+	if (readInt(&input) != FORMAT_VERSION) {
+		setError("Unsupported baked format version.", NULL);
+		return NULL;
+	}
+	if (readInt(&input) != ENDIAN_MARK) {
+		setError("Baked data was written with a different byte order.", NULL);
+		return NULL;
+	}
+	int bakedLength = readInt(&input);
+	if (bakedLength < 16 || bakedLength > length) {
+		setError("Baked data is truncated.", NULL);
+		return NULL;
+	}
+	input.end = data + bakedLength;
+
+	SkeletonData *skeletonData = new (__FILE__, __LINE__) SkeletonData();
+	String string;
+	readString(&input, string);
+	skeletonData->setHash(string);
+	readString(&input, string);
+	skeletonData->setVersion(string);
+	if (!skeletonData->getVersion().startsWith(SPINE_VERSION_STRING)) {
+		char errorMsg[255];
+		snprintf(errorMsg, 255, "Skeleton version %s does not match runtime version %s", skeletonData->getVersion().buffer(), SPINE_VERSION_STRING);
+		setError(errorMsg, NULL);
+		delete skeletonData;
+		return NULL;
+	}
+	readString(&input, string);
+	skeletonData->setName(string);
+	skeletonData->setX(readFloat(&input));
+	skeletonData->setY(readFloat(&input));
+	skeletonData->setWidth(readFloat(&input));
+	skeletonData->setHeight(readFloat(&input));
+	skeletonData->setReferenceScale(readFloat(&input));
+	skeletonData->setFps(readFloat(&input));
+	readString(&input, string);
+	skeletonData->setImagesPath(string);
+	readString(&input, string);
+	skeletonData->setAudioPath(string);
+
+	/* Bones. */
+	Vector<BoneData *> &bones = skeletonData->getBones();
+	bones.setSize(readCount(&input), 0);
+	for (size_t i = 0; i < bones.size() && !input.overflow; ++i) {
+		if (!readName(&input, string)) break;
+		int parentIndex = readInt(&input);
+		if (parentIndex >= (int) i) setInvalid(&input);
+		BoneData *parent = parentIndex < 0 || input.overflow ? NULL : bones[parentIndex];
+		BoneData *data = new (__FILE__, __LINE__) BoneData((int) i, string, parent);
+		data->setRotation(readFloat(&input));
+		data->setX(readFloat(&input));
+		data->setY(readFloat(&input));
+		data->setScaleX(readFloat(&input));
+		data->setScaleY(readFloat(&input));
+		data->setShearX(readFloat(&input));
+		data->setShearY(readFloat(&input));
+		data->setLength(readFloat(&input));
+		data->setInherit((Inherit) readInt(&input));
+		data->setSkinRequired(readBoolean(&input));
+		readColor(&input, data->getColor());
+		readString(&input, string);
+		data->setIcon(string);
+		data->setVisible(readBoolean(&input));
+		bones[i] = data;
+	}
+	if (input.overflow) return readFailed(skeletonData);
+
+	/* Slots. */
+	Vector<SlotData *> &slots = skeletonData->getSlots();
+	slots.setSize(readCount(&input), 0);
+	for (size_t i = 0; i < slots.size() && !input.overflow; ++i) {
+		if (!readName(&input, string)) break;
+		BoneData *bone = readReference(&input, bones);
+		if (!bone) break;
+		SlotData *data = new (__FILE__, __LINE__) SlotData((int) i, string, *bone);
+		readColor(&input, data->getColor());
+		readColor(&input, data->getDarkColor());
+		data->setHasDarkColor(readBoolean(&input));
+		readString(&input, string);
+		data->setAttachmentName(string);
+		data->setBlendMode((BlendMode) readInt(&input));
+		data->setVisible(readBoolean(&input));
+		slots[i] = data;
+	}
+	if (input.overflow) return readFailed(skeletonData);
+
+	/* IK constraints. */
+	Vector<IkConstraintData *> &ikConstraints = skeletonData->getIkConstraints();
+	ikConstraints.setSize(readCount(&input), 0);
+	for (size_t i = 0; i < ikConstraints.size() && !input.overflow; ++i) {
+		if (!readName(&input, string)) break;
+		IkConstraintData *data = new (__FILE__, __LINE__) IkConstraintData(string);
+		data->setOrder(readInt(&input));
+		data->setSkinRequired(readBoolean(&input));
+		data->getBones().setSize(readCount(&input), 0);
+		for (size_t ii = 0; ii < data->getBones().size(); ++ii)
+			data->getBones()[ii] = readReference(&input, bones);
+		data->setTarget(readReference(&input, bones));
+		data->setBendDirection(readInt(&input));
+		data->setCompress(readBoolean(&input));
+		data->setStretch(readBoolean(&input));
+		data->setUniform(readBoolean(&input));
+		data->setMix(readFloat(&input));
+		data->setSoftness(readFloat(&input));
+		ikConstraints[i] = data;
+	}
+	if (input.overflow) return readFailed(skeletonData);
+
+	/* Transform constraints. */
+	Vector<TransformConstraintData *> &transformConstraints = skeletonData->getTransformConstraints();
+	transformConstraints.setSize(readCount(&input), 0);
+	for (size_t i = 0; i < transformConstraints.size() && !input.overflow; ++i) {
+		if (!readName(&input, string)) break;
+		TransformConstraintData *data = new (__FILE__, __LINE__) TransformConstraintData(string);
+		data->setOrder(readInt(&input));
+		data->setSkinRequired(readBoolean(&input));
+		data->getBones().setSize(readCount(&input), 0);
+		for (size_t ii = 0; ii < data->getBones().size(); ++ii)
+			data->getBones()[ii] = readReference(&input, bones);
+		data->setTarget(readReference(&input, bones));
+		data->setLocal(readBoolean(&input));
+		data->setRelative(readBoolean(&input));
+		data->setOffsetRotation(readFloat(&input));
+		data->setOffsetX(readFloat(&input));
+		data->setOffsetY(readFloat(&input));
+		data->setOffsetScaleX(readFloat(&input));
+		data->setOffsetScaleY(readFloat(&input));
+		data->setOffsetShearY(readFloat(&input));
+		data->setMixRotate(readFloat(&input));
+		data->setMixX(readFloat(&input));
+		data->setMixY(readFloat(&input));
+		data->setMixScaleX(readFloat(&input));
+		data->setMixScaleY(readFloat(&input));
+		data->setMixShearY(readFloat(&input));
+		transformConstraints[i] = data;
+	}
+	if (input.overflow) return readFailed(skeletonData);
+
+	/* Path constraints. */
+	Vector<PathConstraintData *> &pathConstraints = skeletonData->getPathConstraints();
+	pathConstraints.setSize(readCount(&input), 0);
+	for (size_t i = 0; i < pathConstraints.size() && !input.overflow; ++i) {
+		if (!readName(&input, string)) break;
+		PathConstraintData *data = new (__FILE__, __LINE__) PathConstraintData(string);
+		data->setOrder(readInt(&input));
+		data->setSkinRequired(readBoolean(&input));
+		data->getBones().setSize(readCount(&input), 0);
+		for (size_t ii = 0; ii < data->getBones().size(); ++ii)
+			data->getBones()[ii] = readReference(&input, bones);
+		data->setTarget(readReference(&input, slots));
+		data->setPositionMode((PositionMode) readInt(&input));
+		data->setSpacingMode((SpacingMode) readInt(&input));
+		data->setRotateMode((RotateMode) readInt(&input));
+		data->setOffsetRotation(readFloat(&input));
+		data->setPosition(readFloat(&input));
+		data->setSpacing(readFloat(&input));
+		data->setMixRotate(readFloat(&input));
+		data->setMixX(readFloat(&input));
+		data->setMixY(readFloat(&input));
+		pathConstraints[i] = data;
+	}
+	if (input.overflow) return readFailed(skeletonData);
+
+	/* Physics constraints. */
+	Vector<PhysicsConstraintData *> &physicsConstraints = skeletonData->getPhysicsConstraints();
+	physicsConstraints.setSize(readCount(&input), 0);
+	for (size_t i = 0; i < physicsConstraints.size() && !input.overflow; ++i) {
+		if (!readName(&input, string)) break;
+		PhysicsConstraintData *data = new (__FILE__, __LINE__) PhysicsConstraintData(string);
+		data->setOrder(readInt(&input));
+		data->setSkinRequired(readBoolean(&input));
+		data->setBone(readReference(&input, bones));
+		data->setX(readFloat(&input));
+		data->setY(readFloat(&input));
+		data->setRotate(readFloat(&input));
+		data->setScaleX(readFloat(&input));
+		data->setShearX(readFloat(&input));
+		data->setLimit(readFloat(&input));
+		data->setStep(readFloat(&input));
+		data->setInertia(readFloat(&input));
+		data->setStrength(readFloat(&input));
+		data->setDamping(readFloat(&input));
+		data->setMassInverse(readFloat(&input));
+		data->setWind(readFloat(&input));
+		data->setGravity(readFloat(&input));
+		data->setMix(readFloat(&input));
+		data->setInertiaGlobal(readBoolean(&input));
+		data->setStrengthGlobal(readBoolean(&input));
+		data->setDampingGlobal(readBoolean(&input));
+		data->setMassGlobal(readBoolean(&input));
+		data->setWindGlobal(readBoolean(&input));
+		data->setGravityGlobal(readBoolean(&input));
+		data->setMixGlobal(readBoolean(&input));
+		physicsConstraints[i] = data;
+	}
+	if (input.overflow) return readFailed(skeletonData);
+
+	/* Skins. */
+	int skinsCount = readCount(&input);
+	int defaultSkinIndex = readInt(&input);
+	for (int i = 0; i < skinsCount && !input.overflow; ++i) {
+		Skin *skin = readSkin(&input, skeletonData);
+		if (!skin) return readFailed(skeletonData);
+		skeletonData->getSkins().add(skin);
+	}
+	if (input.overflow) return readFailed(skeletonData);
+	if (defaultSkinIndex >= 0 && defaultSkinIndex < (int) skeletonData->getSkins().size())
+		skeletonData->setDefaultSkin(skeletonData->getSkins()[defaultSkinIndex]);
+
+	/* Linked meshes. */
+	for (size_t i = 0; i < _linkedMeshes.size(); ++i) {
+		LinkedMeshRef &linkedMesh = _linkedMeshes[i];
+		if (linkedMesh.skinIndex < 0 || linkedMesh.skinIndex >= (int) skeletonData->getSkins().size()) {
+			setInvalid(&input);
+			return readFailed(skeletonData);
+		}
+		Skin *skin = skeletonData->getSkins()[linkedMesh.skinIndex];
+		Attachment *parent = skin->getAttachment(linkedMesh.slotIndex, linkedMesh.parent);
+		if (parent == NULL) {
+			setError("Parent mesh not found: ", linkedMesh.parent.buffer());
+			return readFailed(skeletonData);
+		}
+		MeshAttachment *mesh = linkedMesh.mesh;
+		mesh->setTimelineAttachment(linkedMesh.inheritTimeline ? parent : mesh);
+		mesh->setParentMesh(static_cast<MeshAttachment *>(parent));
+		if (mesh->getRegion()) mesh->updateRegion();
+		_attachmentLoader->configureAttachment(mesh);
+	}
+	_linkedMeshes.clear();
+
+	/* Events. */
+	Vector<EventData *> &events = skeletonData->getEvents();
+	events.setSize(readCount(&input), 0);
+	for (size_t i = 0; i < events.size() && !input.overflow; ++i) {
+		if (!readName(&input, string)) break;
+		EventData *data = new (__FILE__, __LINE__) EventData(string);
+		data->setIntValue(readInt(&input));
+		data->setFloatValue(readFloat(&input));
+		readString(&input, string);
+		data->setStringValue(string);
+		readString(&input, string);
+		data->setAudioPath(string);
+		data->setVolume(readFloat(&input));
+		data->setBalance(readFloat(&input));
+		events[i] = data;
+	}
+	if (input.overflow) return readFailed(skeletonData);
+
+	/* Animations. */
+	Vector<Animation *> &animations = skeletonData->getAnimations();
+	animations.setSize(readCount(&input), 0);
+	for (size_t i = 0; i < animations.size(); ++i) {
+		Animation *animation = input.overflow ? NULL : readAnimation(&input, skeletonData);
+		if (!animation) return readFailed(skeletonData);
+		animations[i] = animation;
+	}
+	if (input.overflow) return readFailed(skeletonData);
+
+	skeletonData->buildNameIndex();
+	skeletonData->buildSkinningLayouts();
+	return skeletonData;
+}
+
+SkeletonData *SkeletonBaked::readSkeletonDataFile(const String &path) {
+	int length;
+	SkeletonData *skeletonData;
+	const char *data = SpineExtension::mapFile(path, &length);
+	bool mapped = data != NULL;
+	if (!mapped) data = SpineExtension::readFile(path.buffer(), &length);
+	if (length == 0 || !data) {
+		if (data) SpineExtension::free(data, __FILE__, __LINE__);
+		setError("Unable to read skeleton file: ", path.buffer());
+		return NULL;
+	}
+	skeletonData = readSkeletonData((const unsigned char *) data, length);
+	if (mapped)
+		SpineExtension::unmapFile(data, length);
+	else
+		SpineExtension::free(data, __FILE__, __LINE__);
+	return skeletonData;
+}
+
+void SkeletonBaked::setError(const char *value1, const char *value2) {
+	_error = String(value1);
+	if (value2) _error.append(value2);
+}
+
+void SkeletonBaked::setInvalid(DataInput *input) {
+	if (!input->overflow) setError("Invalid baked data.", NULL);
+	input->overflow = true;
+}
+
+SkeletonData *SkeletonBaked::readFailed(SkeletonData *skeletonData) {
+	if (_error.isEmpty()) setError("Baked data is truncated.", NULL);
+	_linkedMeshes.clear();
+	delete skeletonData;
+	return NULL;
+}
+
+const unsigned char *SkeletonBaked::readBlock(DataInput *input, size_t count, size_t size) {
+	if (input->overflow || count > (size_t) (input->end - input->cursor) / size) {
+		input->overflow = true;
+		return NULL;
+	}
+	const unsigned char *block = input->cursor;
+	input->cursor += count * size;
+	return block;
+}
+
+int SkeletonBaked::readInt(DataInput *input) {
+	const unsigned char *block = readBlock(input, 1, 4);
+	int value = 0;
+	if (block) memcpy(&value, block, 4);
+	return value;
+}
+
+float SkeletonBaked::readFloat(DataInput *input) {
+	const unsigned char *block = readBlock(input, 1, 4);
+	float value = 0;
+	if (block) memcpy(&value, block, 4);
+	return value;
+}
+
+int SkeletonBaked::readCount(DataInput *input) {
+	// Every counted item takes at least 4 bytes, so a larger count is corrupt and must not reach an allocation.
+	int count = readInt(input);
+	if (count < 0 || (size_t) count > (size_t) (input->end - input->cursor) / 4) {
+		setInvalid(input);
+		return 0;
+	}
+	return count;
+}
+
+int SkeletonBaked::readIndex(DataInput *input, size_t count) {
+	int index = readInt(input);
+	if (index < 0 || (size_t) index >= count) {
+		setInvalid(input);
+		return 0;
+	}
+	return index;
+}
+
+bool SkeletonBaked::readBoolean(DataInput *input) {
+	return readInt(input) != 0;
+}
+
+void SkeletonBaked::readString(DataInput *input, String &string) {
+	int length = readInt(input);
+	if (length < 0) setInvalid(input);
+	const unsigned char *block = readBlock(input, ((size_t) length + 3) & ~(size_t) 3, 1);
+	if (length <= 0 || !block) {
+		string = "";
+		return;
+	}
+	char *chars = SpineExtension::alloc<char>(length + 1, __FILE__, __LINE__);
+	memcpy(chars, block, length);
+	chars[length] = '\0';
+	string.own(chars);
+}
+
+bool SkeletonBaked::readName(DataInput *input, String &string) {
+	readString(input, string);
+	if (string.isEmpty()) setInvalid(input);
+	return !input->overflow;
+}
+
+void SkeletonBaked::readColor(DataInput *input, Color &color) {
+	color.r = readFloat(input);
+	color.g = readFloat(input);
+	color.b = readFloat(input);
+	color.a = readFloat(input);
+}
+
+void SkeletonBaked::readFloats(DataInput *input, Vector<float> &array) {
+	int count = readInt(input);
+	if (count < 0) setInvalid(input);
+	const unsigned char *block = readBlock(input, (size_t) (count < 0 ? 0 : count), sizeof(float));
+	if (!block) count = 0;
+	array.setSize(count, 0);
+	if (count) memcpy(array.buffer(), block, count * sizeof(float));
+}
+
+void SkeletonBaked::readInts(DataInput *input, Vector<int> &array) {
+	int count = readInt(input);
+	if (count < 0) setInvalid(input);
+	const unsigned char *block = readBlock(input, (size_t) (count < 0 ? 0 : count), sizeof(int));
+	if (!block) count = 0;
+	array.setSize(count, 0);
+	if (count) memcpy(array.buffer(), block, count * sizeof(int));
+}
+
+void SkeletonBaked::readShorts(DataInput *input, Vector<unsigned short> &array) {
+	int count = readInt(input);
+	if (count < 0) setInvalid(input);
+	const unsigned char *block = readBlock(input, count < 0 ? 0 : ((size_t) count + 1) & ~(size_t) 1, sizeof(unsigned short));
+	if (!block) count = 0;
+	array.setSize(count, 0);
+	if (count) memcpy(array.buffer(), block, count * sizeof(unsigned short));
+}
+
+Sequence *SkeletonBaked::readSequence(DataInput *input) {
+	if (!readBoolean(input)) return NULL;
+	// Regions are not stored, so the count is only bounded by the remaining input to keep the allocation in proportion.
+	int count = readInt(input);
+	if (count < 0 || (size_t) count > (size_t) (input->end - input->cursor)) {
+		setInvalid(input);
+		return NULL;
+	}
+	Sequence *sequence = new (__FILE__, __LINE__) Sequence(count);
+	sequence->setStart(readInt(input));
+	sequence->setDigits(readInt(input));
+	sequence->setSetupIndex(readInt(input));
+	return sequence;
+}
+
+Skin *SkeletonBaked::readSkin(DataInput *input, SkeletonData *skeletonData) {
+	String name;
+	if (!readName(input, name)) return NULL;
+	Skin *skin = new (__FILE__, __LINE__) Skin(name);
+	readColor(input, skin->getColor());
+
+	for (int i = 0, n = readCount(input); i < n && !input->overflow; ++i) {
+		BoneData *bone = readReference(input, skeletonData->getBones());
+		if (bone) skin->getBones().add(bone);
+	}
+
+	for (int i = 0, n = readCount(input); i < n && !input->overflow; ++i) {
+		ConstraintData *constraint;
+		switch (readInt(input)) {
+			case CONSTRAINT_IK:
+				constraint = readReference(input, skeletonData->getIkConstraints());
+				break;
+			case CONSTRAINT_TRANSFORM:
+				constraint = readReference(input, skeletonData->getTransformConstraints());
+				break;
+			case CONSTRAINT_PATH:
+				constraint = readReference(input, skeletonData->getPathConstraints());
+				break;
+			default:
+				constraint = readReference(input, skeletonData->getPhysicsConstraints());
+		}
+		if (constraint) skin->getConstraints().add(constraint);
+	}
+
+	for (int i = 0, n = readCount(input); i < n && !input->overflow; ++i) {
+		int slotIndex = readInt(input);
+		if (slotIndex < 0 || slotIndex >= (int) skeletonData->getSlots().size()) {
+			setInvalid(input);
+			break;
+		}
+		readString(input, name);
+		Attachment *attachment = readAttachment(input, skin, slotIndex, name, skeletonData);
+		if (!attachment) {
+			delete skin;
+			return NULL;
+		}
+		skin->setAttachment(slotIndex, name, attachment);
+	}
+	return skin;
+}
+
+Attachment *SkeletonBaked::readAttachment(DataInput *input, Skin *skin, int slotIndex, const String &attachmentName,
+										  SkeletonData *skeletonData) {
+	SP_UNUSED(attachmentName);
+	String name, path;
+	if (!readName(input, name)) return NULL;
+	AttachmentType type = (AttachmentType) readInt(input);
+	switch (type) {
+		case AttachmentType_Region: {
+			readString(input, path);
+			Color color;
+			readColor(input, color);
+			Sequence *sequence = readSequence(input);
+			RegionAttachment *region = _attachmentLoader->newRegionAttachment(*skin, name, path, sequence);
+			if (!region) {
+				delete sequence;
+				setError("Error reading attachment: ", name.buffer());
+				return NULL;
+			}
+			region->setPath(path);
+			region->getColor().set(color);
+			region->setSequence(sequence);
+			region->setRotation(readFloat(input));
+			region->setX(readFloat(input));
+			region->setY(readFloat(input));
+			region->setScaleX(readFloat(input));
+			region->setScaleY(readFloat(input));
+			region->setWidth(readFloat(input));
+			region->setHeight(readFloat(input));
+			if (sequence == NULL) region->updateRegion();
+			_attachmentLoader->configureAttachment(region);
+			return region;
+		}
+		case AttachmentType_Mesh:
+		case AttachmentType_Linkedmesh: {
+			readString(input, path);
+			Color color;
+			readColor(input, color);
+			Sequence *sequence = readSequence(input);
+			MeshAttachment *mesh = _attachmentLoader->newMeshAttachment(*skin, name, path, sequence);
+			if (!mesh) {
+				delete sequence;
+				setError("Error reading attachment: ", name.buffer());
+				return NULL;
+			}
+			mesh->setPath(path);
+			mesh->getColor().set(color);
+			mesh->setSequence(sequence);
+			mesh->setWidth(readFloat(input));
+			mesh->setHeight(readFloat(input));
+			if (type == AttachmentType_Linkedmesh) {
+				LinkedMeshRef linkedMesh;
+				linkedMesh.mesh = mesh;
+				linkedMesh.inheritTimeline = readBoolean(input);
+				linkedMesh.skinIndex = readInt(input);
+				linkedMesh.slotIndex = readInt(input);
+				readString(input, linkedMesh.parent);
+				_linkedMeshes.add(linkedMesh);
+				return mesh;
+			}
+			mesh->setHullLength(readCount(input));
+			mesh->setWorldVerticesLength(readCount(input));
+			readInts(input, mesh->getBones());
+			readFloats(input, mesh->getVertices());
+			readFloats(input, mesh->getRegionUVs());
+			readShorts(input, mesh->getTriangles());
+			readShorts(input, mesh->getEdges());
+			validateVertices(input, mesh, skeletonData);
+			size_t worldVerticesLength = mesh->getWorldVerticesLength();
+			Vector<unsigned short> &triangles = mesh->getTriangles();
+			bool valid = mesh->getRegionUVs().size() == worldVerticesLength && mesh->getHullLength() <= (int) worldVerticesLength;
+			for (size_t i = 0; i < triangles.size() && valid; ++i)
+				valid = (size_t) triangles[i] < worldVerticesLength >> 1;
+			if (!valid) setInvalid(input);
+			if (sequence == NULL) mesh->updateRegion();
+			_attachmentLoader->configureAttachment(mesh);
+			return mesh;
+		}
+		case AttachmentType_Boundingbox: {
+			BoundingBoxAttachment *box = _attachmentLoader->newBoundingBoxAttachment(*skin, name);
+			if (!box) {
+				setError("Error reading attachment: ", name.buffer());
+				return NULL;
+			}
+			box->setWorldVerticesLength(readCount(input));
+			readInts(input, box->getBones());
+			readFloats(input, box->getVertices());
+			validateVertices(input, box, skeletonData);
+			readColor(input, box->getColor());
+			_attachmentLoader->configureAttachment(box);
+			return box;
+		}
+		case AttachmentType_Path: {
+			PathAttachment *pathAttachment = _attachmentLoader->newPathAttachment(*skin, name);
+			if (!pathAttachment) {
+				setError("Error reading attachment: ", name.buffer());
+				return NULL;
+			}
+			pathAttachment->setClosed(readBoolean(input));
+			pathAttachment->setConstantSpeed(readBoolean(input));
+			pathAttachment->setWorldVerticesLength(readCount(input));
+			readInts(input, pathAttachment->getBones());
+			readFloats(input, pathAttachment->getVertices());
+			readFloats(input, pathAttachment->getLengths());
+			validateVertices(input, pathAttachment, skeletonData);
+			if (pathAttachment->getLengths().size() != pathAttachment->getWorldVerticesLength() / 6) setInvalid(input);
+			readColor(input, pathAttachment->getColor());
+			_attachmentLoader->configureAttachment(pathAttachment);
+			return pathAttachment;
+		}
+		case AttachmentType_Point: {
+			PointAttachment *point = _attachmentLoader->newPointAttachment(*skin, name);
+			if (!point) {
+				setError("Error reading attachment: ", name.buffer());
+				return NULL;
+			}
+			point->setRotation(readFloat(input));
+			point->setX(readFloat(input));
+			point->setY(readFloat(input));
+			readColor(input, point->getColor());
+			_attachmentLoader->configureAttachment(point);
+			return point;
+		}
+		case AttachmentType_Clipping: {
+			ClippingAttachment *clip = _attachmentLoader->newClippingAttachment(*skin, name);
+			if (!clip) {
+				setError("Error reading attachment: ", name.buffer());
+				return NULL;
+			}
+			int endSlotIndex = readInt(input);
+			clip->setEndSlot(endSlotIndex < 0 ? NULL : readReference(input, skeletonData->getSlots(), endSlotIndex));
+			clip->setWorldVerticesLength(readCount(input));
+			readInts(input, clip->getBones());
+			readFloats(input, clip->getVertices());
+			validateVertices(input, clip, skeletonData);
+			readColor(input, clip->getColor());
+			_attachmentLoader->configureAttachment(clip);
+			return clip;
+		}
+		default:
+			break;
+	}
+	SP_UNUSED(slotIndex);
+	setError("Invalid attachment type: ", name.buffer());
+	return NULL;
+}
+
+void SkeletonBaked::validateVertices(DataInput *input, VertexAttachment *attachment, SkeletonData *skeletonData) {
+	// Bones hold the bone count then the bone indices of each vertex, vertices hold x, y and weight per bone.
+	Vector<int> &bones = attachment->getBones();
+	int boneCount = (int) skeletonData->getBones().size();
+	size_t vertexCount = 0, weightCount = 0;
+	for (size_t i = 0; i < bones.size(); ++vertexCount) {
+		int count = bones[i++];
+		if (count < 0 || (size_t) count > bones.size() - i) {
+			setInvalid(input);
+			return;
+		}
+		for (size_t n = i + count; i < n; ++i) {
+			if (bones[i] < 0 || bones[i] >= boneCount) {
+				setInvalid(input);
+				return;
+			}
+		}
+		weightCount += count;
+	}
+	size_t worldVerticesLength = attachment->getWorldVerticesLength();
+	bool valid = bones.size() == 0 ? attachment->getVertices().size() == worldVerticesLength
+								   : attachment->getVertices().size() == weightCount * 3 && worldVerticesLength == vertexCount * 2;
+	if (!valid) setInvalid(input);
+}
+
+Attachment *SkeletonBaked::readAttachmentRef(DataInput *input, SkeletonData *skeletonData) {
+	int skinIndex = readInt(input);
+	int slotIndex = readInt(input);
+	String name;
+	readString(input, name);
+	if (skinIndex < 0 || skinIndex >= (int) skeletonData->getSkins().size()) {
+		setError("Attachment not found: ", name.buffer());
+		return NULL;
+	}
+	Attachment *attachment = skeletonData->getSkins()[skinIndex]->getAttachment(slotIndex, name);
+	if (!attachment) setError("Attachment not found: ", name.buffer());
+	return attachment;
+}
+
+Animation *SkeletonBaked::readAnimation(DataInput *input, SkeletonData *skeletonData) {
+	String name;
+	if (!readName(input, name)) return NULL;
+	float duration = readFloat(input);
+	Vector<Timeline *> timelines;
+	int timelinesCount = readCount(input);
+	timelines.ensureCapacity(timelinesCount);
+	for (int i = 0; i < timelinesCount; ++i) {
+		Timeline *timeline = input->overflow ? NULL : readTimeline(input, skeletonData);
+		if (!timeline) {
+			ContainerUtil::cleanUpVectorOfPointers(timelines);
+			return NULL;
+		}
+		timelines.add(timeline);
+	}
+	return new (__FILE__, __LINE__) Animation(name, timelines, duration);
+}
+
+Timeline *SkeletonBaked::readTimeline(DataInput *input, SkeletonData *skeletonData) {
+	int type = readInt(input);
+	int frameCount = readCount(input);
+	int bezierCount = readCount(input);
+	if (frameCount <= 0 || input->overflow) {
+		setError("Invalid timeline in baked data.", NULL);
+		return NULL;
+	}
+
+	Timeline *timeline = NULL;
+	switch (type) {
+		case TimelineType_Rotate:
+			timeline = new (__FILE__, __LINE__) RotateTimeline(frameCount, bezierCount, readIndex(input, skeletonData->getBones().size()));
+			break;
+		case TimelineType_Translate:
+			timeline = new (__FILE__, __LINE__) TranslateTimeline(frameCount, bezierCount, readIndex(input, skeletonData->getBones().size()));
+			break;
+		case TimelineType_TranslateX:
+			timeline = new (__FILE__, __LINE__) TranslateXTimeline(frameCount, bezierCount, readIndex(input, skeletonData->getBones().size()));
+			break;
+		case TimelineType_TranslateY:
+			timeline = new (__FILE__, __LINE__) TranslateYTimeline(frameCount, bezierCount, readIndex(input, skeletonData->getBones().size()));
+			break;
+		case TimelineType_Scale:
+			timeline = new (__FILE__, __LINE__) ScaleTimeline(frameCount, bezierCount, readIndex(input, skeletonData->getBones().size()));
+			break;
+		case TimelineType_ScaleX:
+			timeline = new (__FILE__, __LINE__) ScaleXTimeline(frameCount, bezierCount, readIndex(input, skeletonData->getBones().size()));
+			break;
+		case TimelineType_ScaleY:
+			timeline = new (__FILE__, __LINE__) ScaleYTimeline(frameCount, bezierCount, readIndex(input, skeletonData->getBones().size()));
+			break;
+		case TimelineType_Shear:
+			timeline = new (__FILE__, __LINE__) ShearTimeline(frameCount, bezierCount, readIndex(input, skeletonData->getBones().size()));
+			break;
+		case TimelineType_ShearX:
+			timeline = new (__FILE__, __LINE__) ShearXTimeline(frameCount, bezierCount, readIndex(input, skeletonData->getBones().size()));
+			break;
+		case TimelineType_ShearY:
+			timeline = new (__FILE__, __LINE__) ShearYTimeline(frameCount, bezierCount, readIndex(input, skeletonData->getBones().size()));
+			break;
+		case TimelineType_Inherit:
+			timeline = new (__FILE__, __LINE__) InheritTimeline(frameCount, readIndex(input, skeletonData->getBones().size()));
+			break;
+		case TimelineType_RGBA:
+			timeline = new (__FILE__, __LINE__) RGBATimeline(frameCount, bezierCount, readIndex(input, skeletonData->getSlots().size()));
+			break;
+		case TimelineType_RGB:
+			timeline = new (__FILE__, __LINE__) RGBTimeline(frameCount, bezierCount, readIndex(input, skeletonData->getSlots().size()));
+			break;
+		case TimelineType_Alpha:
+			timeline = new (__FILE__, __LINE__) AlphaTimeline(frameCount, bezierCount, readIndex(input, skeletonData->getSlots().size()));
+			break;
+		case TimelineType_RGBA2:
+			timeline = new (__FILE__, __LINE__) RGBA2Timeline(frameCount, bezierCount, readIndex(input, skeletonData->getSlots().size()));
+			break;
+		case TimelineType_RGB2:
+			timeline = new (__FILE__, __LINE__) RGB2Timeline(frameCount, bezierCount, readIndex(input, skeletonData->getSlots().size()));
+			break;
+		case TimelineType_Attachment: {
+			AttachmentTimeline *attachmentTimeline = new (__FILE__, __LINE__) AttachmentTimeline(frameCount, readIndex(input, skeletonData->getSlots().size()));
+			Vector<String> &names = attachmentTimeline->getAttachmentNames();
+			for (int i = 0; i < frameCount; ++i)
+				readString(input, names[i]);
+			timeline = attachmentTimeline;
+			break;
+		}
+		case TimelineType_Deform: {
+			int slotIndex = readIndex(input, skeletonData->getSlots().size());
+			Attachment *attachment = readAttachmentRef(input, skeletonData);
+			if (!attachment) return NULL;
+			if (!attachment->getRTTI().instanceOf(VertexAttachment::rtti)) {
+				setError("Invalid timeline in baked data.", NULL);
+				return NULL;
+			}
+			VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(attachment);
+			DeformTimeline *deformTimeline = new (__FILE__, __LINE__) DeformTimeline(frameCount, bezierCount, slotIndex, vertexAttachment);
+			Vector<Vector<float> > &vertices = deformTimeline->getVertices();
+			size_t setupVertices = vertexAttachment->getVertices().size();
+			size_t deformLength = vertexAttachment->getBones().size() ? setupVertices / 3 * 2 : setupVertices;
+			for (int i = 0; i < frameCount; ++i) {
+				readFloats(input, vertices[i]);
+				if (vertices[i].size() != deformLength) setInvalid(input);
+			}
+			timeline = deformTimeline;
+			break;
+		}
+		case TimelineType_Sequence: {
+			int slotIndex = readIndex(input, skeletonData->getSlots().size());
+			Attachment *attachment = readAttachmentRef(input, skeletonData);
+			if (!attachment) return NULL;
+			timeline = new (__FILE__, __LINE__) SequenceTimeline(frameCount, slotIndex, attachment);
+			break;
+		}
+		case TimelineType_Event: {
+			EventTimeline *eventTimeline = new (__FILE__, __LINE__) EventTimeline(frameCount);
+			for (int i = 0; i < frameCount; ++i) {
+				EventData *eventData = readReference(input, skeletonData->getEvents());
+				if (!eventData) {
+					delete eventTimeline;
+					return NULL;
+				}
+				Event *event = new (__FILE__, __LINE__) Event(readFloat(input), *eventData);
+				event->setIntValue(readInt(input));
+				event->setFloatValue(readFloat(input));
+				String stringValue;
+				readString(input, stringValue);
+				event->setStringValue(stringValue);
+				event->setVolume(readFloat(input));
+				event->setBalance(readFloat(input));
+				eventTimeline->setFrame(i, event);
+			}
+			timeline = eventTimeline;
+			break;
+		}
+		case TimelineType_DrawOrder: {
+			DrawOrderTimeline *drawOrderTimeline = new (__FILE__, __LINE__) DrawOrderTimeline(frameCount);
+			Vector<Vector<int> > &drawOrders = drawOrderTimeline->getDrawOrders();
+			int slotCount = (int) skeletonData->getSlots().size();
+			for (int i = 0; i < frameCount; ++i) {
+				Vector<int> &drawOrder = drawOrders[i];
+				readInts(input, drawOrder);
+				if (drawOrder.size() != 0 && drawOrder.size() != (size_t) slotCount) setInvalid(input);
+				for (size_t ii = 0; ii < drawOrder.size(); ++ii)
+					if (drawOrder[ii] < 0 || drawOrder[ii] >= slotCount) setInvalid(input);
+			}
+			timeline = drawOrderTimeline;
+			break;
+		}
+		case TimelineType_IkConstraint:
+			timeline = new (__FILE__, __LINE__) IkConstraintTimeline(frameCount, bezierCount, readIndex(input, skeletonData->getIkConstraints().size()));
+			break;
+		case TimelineType_TransformConstraint:
+			timeline = new (__FILE__, __LINE__) TransformConstraintTimeline(frameCount, bezierCount, readIndex(input, skeletonData->getTransformConstraints().size()));
+			break;
+		case TimelineType_PathConstraintPosition:
+			timeline = new (__FILE__, __LINE__) PathConstraintPositionTimeline(frameCount, bezierCount, readIndex(input, skeletonData->getPathConstraints().size()));
+			break;
+		case TimelineType_PathConstraintSpacing:
+			timeline = new (__FILE__, __LINE__) PathConstraintSpacingTimeline(frameCount, bezierCount, readIndex(input, skeletonData->getPathConstraints().size()));
+			break;
+		case TimelineType_PathConstraintMix:
+			timeline = new (__FILE__, __LINE__) PathConstraintMixTimeline(frameCount, bezierCount, readIndex(input, skeletonData->getPathConstraints().size()));
+			break;
+		case TimelineType_PhysicsConstraint: {
+			int property = readInt(input);
+			int index = readInt(input);
+			if (index < -1 || index >= (int) skeletonData->getPhysicsConstraints().size()) setInvalid(input);
+			switch (property) {
+				case PHYSICS_INERTIA:
+					timeline = new (__FILE__, __LINE__) PhysicsConstraintInertiaTimeline(frameCount, bezierCount, index);
+					break;
+				case PHYSICS_STRENGTH:
+					timeline = new (__FILE__, __LINE__) PhysicsConstraintStrengthTimeline(frameCount, bezierCount, index);
+					break;
+				case PHYSICS_DAMPING:
+					timeline = new (__FILE__, __LINE__) PhysicsConstraintDampingTimeline(frameCount, bezierCount, index);
+					break;
+				case PHYSICS_MASS:
+					timeline = new (__FILE__, __LINE__) PhysicsConstraintMassTimeline(frameCount, bezierCount, index);
+					break;
+				case PHYSICS_WIND:
+					timeline = new (__FILE__, __LINE__) PhysicsConstraintWindTimeline(frameCount, bezierCount, index);
+					break;
+				case PHYSICS_GRAVITY:
+					timeline = new (__FILE__, __LINE__) PhysicsConstraintGravityTimeline(frameCount, bezierCount, index);
+					break;
+				default:
+					timeline = new (__FILE__, __LINE__) PhysicsConstraintMixTimeline(frameCount, bezierCount, index);
+			}
+			break;
+		}
+		case TimelineType_PhysicsConstraintReset: {
+			int index = readInt(input);
+			if (index < -1 || index >= (int) skeletonData->getPhysicsConstraints().size()) setInvalid(input);
+			timeline = new (__FILE__, __LINE__) PhysicsConstraintResetTimeline(frameCount, index);
+			break;
+		}
+		default:
+			setError("Invalid timeline type in baked data.", NULL);
+			return NULL;
+	}
+
+	if (input->overflow) {
+		delete timeline;
+		return NULL;
+	}
+
+	// Frames and expanded curves are stored exactly as the timeline holds them, so they are copied in bulk.
+	size_t framesSize = timeline->getFrames().size();
+	readFloats(input, timeline->getFrames());
+	bool valid = timeline->getFrames().size() == framesSize;
+	if (timeline->getRTTI().instanceOf(CurveTimeline::rtti)) {
+		Vector<float> &curves = static_cast<CurveTimeline *>(timeline)->getCurves();
+		size_t curvesSize = curves.size();
+		readFloats(input, curves);
+		valid = valid && curves.size() == curvesSize;
+	}
+	if (!valid) {
+		delete timeline;
+		setError("Invalid timeline in baked data.", NULL);
+		return NULL;
+	}
+	return timeline;
+}
@@ -0,0 +1,668 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated April 5, 2025. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2025, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/SkeletonBaker.h>
+
+#include <spine/SkeletonBaked.h>
+
+#include <spine/Animation.h>
+#include <spine/AttachmentTimeline.h>
+#include <spine/BoneData.h>
+#include <spine/BoundingBoxAttachment.h>
+#include <spine/ClippingAttachment.h>
+#include <spine/ColorTimeline.h>
+#include <spine/CurveTimeline.h>
+#include <spine/DeformTimeline.h>
+#include <spine/DrawOrderTimeline.h>
+#include <spine/Event.h>
+#include <spine/EventData.h>
+#include <spine/EventTimeline.h>
+#include <spine/IkConstraintData.h>
+#include <spine/IkConstraintTimeline.h>
+#include <spine/InheritTimeline.h>
+#include <spine/MeshAttachment.h>
+#include <spine/PathAttachment.h>
+#include <spine/PathConstraintData.h>
+#include <spine/PathConstraintMixTimeline.h>
+#include <spine/PathConstraintPositionTimeline.h>
+#include <spine/PathConstraintSpacingTimeline.h>
+#include <spine/PhysicsConstraintData.h>
+#include <spine/PhysicsConstraintTimeline.h>
+#include <spine/PointAttachment.h>
+#include <spine/RegionAttachment.h>
+#include <spine/RotateTimeline.h>
+#include <spine/ScaleTimeline.h>
+#include <spine/Sequence.h>
+#include <spine/SequenceTimeline.h>
+#include <spine/ShearTimeline.h>
+#include <spine/SkeletonData.h>
+#include <spine/Skin.h>
+#include <spine/SlotData.h>
+#include <spine/TransformConstraintData.h>
+#include <spine/TransformConstraintTimeline.h>
+#include <spine/TranslateTimeline.h>
+
+#include <stdio.h>
+
+using namespace spine;
+
+SkeletonBaker::SkeletonBaker() : _output(NULL), _skeletonData(NULL), _error() {
+}
+
+bool SkeletonBaker::write(SkeletonData &skeletonData, Vector<unsigned char> &output) {
+	_output = &output;
+	_skeletonData = &skeletonData;
+	_error = "";
+	output.clear();
+
+	writeInt(SkeletonBaked::MAGIC);
+	writeInt(SkeletonBaked::FORMAT_VERSION);
+	writeInt(SkeletonBaked::ENDIAN_MARK);
+	writeInt(0); // Total length, patched below.
+
+	writeString(skeletonData.getHash());
+	writeString(skeletonData.getVersion());
+	writeString(skeletonData.getName());
+	writeFloat(skeletonData.getX());
+	writeFloat(skeletonData.getY());
+	writeFloat(skeletonData.getWidth());
+	writeFloat(skeletonData.getHeight());
+	writeFloat(skeletonData.getReferenceScale());
+	writeFloat(skeletonData.getFps());
+	writeString(skeletonData.getImagesPath());
+	writeString(skeletonData.getAudioPath());
+
+	/* Bones. */
+	Vector<BoneData *> &bones = skeletonData.getBones();
+	writeInt((int) bones.size());
+	for (size_t i = 0; i < bones.size(); ++i) {
+		BoneData *data = bones[i];
+		writeString(data->getName());
+		writeInt(data->getParent() ? data->getParent()->getIndex() : -1);
+		writeFloat(data->getRotation());
+		writeFloat(data->getX());
+		writeFloat(data->getY());
+		writeFloat(data->getScaleX());
+		writeFloat(data->getScaleY());
+		writeFloat(data->getShearX());
+		writeFloat(data->getShearY());
+		writeFloat(data->getLength());
+		writeInt((int) data->getInherit());
+		writeBoolean(data->isSkinRequired());
+		writeColor(data->getColor());
+		writeString(data->getIcon());
+		writeBoolean(data->isVisible());
+	}
+
+	/* Slots. */
+	Vector<SlotData *> &slots = skeletonData.getSlots();
+	writeInt((int) slots.size());
+	for (size_t i = 0; i < slots.size(); ++i) {
+		SlotData *data = slots[i];
+		writeString(data->getName());
+		writeInt(data->getBoneData().getIndex());
+		writeColor(data->getColor());
+		writeColor(data->getDarkColor());
+		writeBoolean(data->hasDarkColor());
+		writeString(data->getAttachmentName());
+		writeInt((int) data->getBlendMode());
+		writeBoolean(data->isVisible());
+	}
+
+	/* IK constraints. */
+	Vector<IkConstraintData *> &ikConstraints = skeletonData.getIkConstraints();
+	writeInt((int) ikConstraints.size());
+	for (size_t i = 0; i < ikConstraints.size(); ++i) {
+		IkConstraintData *data = ikConstraints[i];
+		writeString(data->getName());
+		writeInt((int) data->getOrder());
+		writeBoolean(data->isSkinRequired());
+		writeInt((int) data->getBones().size());
+		for (size_t ii = 0; ii < data->getBones().size(); ++ii)
+			writeInt(data->getBones()[ii]->getIndex());
+		writeInt(data->getTarget()->getIndex());
+		writeInt(data->getBendDirection());
+		writeBoolean(data->getCompress());
+		writeBoolean(data->getStretch());
+		writeBoolean(data->getUniform());
+		writeFloat(data->getMix());
+		writeFloat(data->getSoftness());
+	}
+
+	/* Transform constraints. */
+	Vector<TransformConstraintData *> &transformConstraints = skeletonData.getTransformConstraints();
+	writeInt((int) transformConstraints.size());
+	for (size_t i = 0; i < transformConstraints.size(); ++i) {
+		TransformConstraintData *data = transformConstraints[i];
+		writeString(data->getName());
+		writeInt((int) data->getOrder());
+		writeBoolean(data->isSkinRequired());
+		writeInt((int) data->getBones().size());
+		for (size_t ii = 0; ii < data->getBones().size(); ++ii)
+			writeInt(data->getBones()[ii]->getIndex());
+		writeInt(data->getTarget()->getIndex());
+		writeBoolean(data->isLocal());
+		writeBoolean(data->isRelative());
+		writeFloat(data->getOffsetRotation());
+		writeFloat(data->getOffsetX());
+		writeFloat(data->getOffsetY());
+		writeFloat(data->getOffsetScaleX());
+		writeFloat(data->getOffsetScaleY());
+		writeFloat(data->getOffsetShearY());
+		writeFloat(data->getMixRotate());
+		writeFloat(data->getMixX());
+		writeFloat(data->getMixY());
+		writeFloat(data->getMixScaleX());
+		writeFloat(data->getMixScaleY());
+		writeFloat(data->getMixShearY());
+	}
+
+	/* Path constraints. */
+	Vector<PathConstraintData *> &pathConstraints = skeletonData.getPathConstraints();
+	writeInt((int) pathConstraints.size());
+	for (size_t i = 0; i < pathConstraints.size(); ++i) {
+		PathConstraintData *data = pathConstraints[i];
+		writeString(data->getName());
+		writeInt((int) data->getOrder());
+		writeBoolean(data->isSkinRequired());
+		writeInt((int) data->getBones().size());
+		for (size_t ii = 0; ii < data->getBones().size(); ++ii)
+			writeInt(data->getBones()[ii]->getIndex());
+		writeInt(data->getTarget()->getIndex());
+		writeInt((int) data->getPositionMode());
+		writeInt((int) data->getSpacingMode());
+		writeInt((int) data->getRotateMode());
+		writeFloat(data->getOffsetRotation());
+		writeFloat(data->getPosition());
+		writeFloat(data->getSpacing());
+		writeFloat(data->getMixRotate());
+		writeFloat(data->getMixX());
+		writeFloat(data->getMixY());
+	}
+
+	/* Physics constraints. */
+	Vector<PhysicsConstraintData *> &physicsConstraints = skeletonData.getPhysicsConstraints();
+	writeInt((int) physicsConstraints.size());
+	for (size_t i = 0; i < physicsConstraints.size(); ++i) {
+		PhysicsConstraintData *data = physicsConstraints[i];
+		writeString(data->getName());
+		writeInt((int) data->getOrder());
+		writeBoolean(data->isSkinRequired());
+		writeInt(data->getBone()->getIndex());
+		writeFloat(data->getX());
+		writeFloat(data->getY());
+		writeFloat(data->getRotate());
+		writeFloat(data->getScaleX());
+		writeFloat(data->getShearX());
+		writeFloat(data->getLimit());
+		writeFloat(data->getStep());
+		writeFloat(data->getInertia());
+		writeFloat(data->getStrength());
+		writeFloat(data->getDamping());
+		writeFloat(data->getMassInverse());
+		writeFloat(data->getWind());
+		writeFloat(data->getGravity());
+		writeFloat(data->getMix());
+		writeBoolean(data->isInertiaGlobal());
+		writeBoolean(data->isStrengthGlobal());
+		writeBoolean(data->isDampingGlobal());
+		writeBoolean(data->isMassGlobal());
+		writeBoolean(data->isWindGlobal());
+		writeBoolean(data->isGravityGlobal());
+		writeBoolean(data->isMixGlobal());
+	}
+
+	/* Skins. */
+	Vector<Skin *> &skins = skeletonData.getSkins();
+	writeInt((int) skins.size());
+	writeInt(skins.indexOf(skeletonData.getDefaultSkin()));
+	for (size_t i = 0; i < skins.size(); ++i) {
+		if (!writeSkin(skins[i])) return false;
+	}
+
+	/* Events. */
+	Vector<EventData *> &events = skeletonData.getEvents();
+	writeInt((int) events.size());
+	for (size_t i = 0; i < events.size(); ++i) {
+		EventData *data = events[i];
+		writeString(data->getName());
+		writeInt(data->getIntValue());
+		writeFloat(data->getFloatValue());
+		writeString(data->getStringValue());
+		writeString(data->getAudioPath());
+		writeFloat(data->getVolume());
+		writeFloat(data->getBalance());
+	}
+
+	/* Animations. */
+	Vector<Animation *> &animations = skeletonData.getAnimations();
+	writeInt((int) animations.size());
+	for (size_t i = 0; i < animations.size(); ++i) {
+		if (!writeAnimation(animations[i])) return false;
+	}
+
+	int length = (int) output.size();
+	memcpy(output.buffer() + 12, &length, 4);
+	return true;
+}
+
+bool SkeletonBaker::writeFile(SkeletonData &skeletonData, const String &path) {
+	Vector<unsigned char> output;
+	if (!write(skeletonData, output)) return false;
+	FILE *file = fopen(path.buffer(), "wb");
+	if (!file) {
+		setError("Unable to write baked file: ", path.buffer());
+		return false;
+	}
+	bool written = fwrite(output.buffer(), 1, output.size(), file) == output.size();
+	if (fclose(file) != 0) written = false;
+	if (!written) setError("Unable to write baked file: ", path.buffer());
+	return written;
+}
+
+void SkeletonBaker::setError(const char *value1, const char *value2) {
+	_error = String(value1);
+	if (value2) _error.append(value2);
+}
+
+void SkeletonBaker::writeBytes(const void *bytes, size_t length) {
+	if (length == 0) return;
+	size_t size = _output->size();
+	_output->setSize(size + length, 0);
+	memcpy(_output->buffer() + size, bytes, length);
+}
+
+void SkeletonBaker::align() {
+	while (_output->size() & 3)
+		_output->add(0);
+}
+
+void SkeletonBaker::writeInt(int value) {
+	writeBytes(&value, 4);
+}
+
+void SkeletonBaker::writeFloat(float value) {
+	writeBytes(&value, 4);
+}
+
+void SkeletonBaker::writeBoolean(bool value) {
+	writeInt(value ? 1 : 0);
+}
+
+void SkeletonBaker::writeString(const String &string) {
+	writeInt((int) string.length());
+	writeBytes(string.buffer(), string.length());
+	align();
+}
+
+void SkeletonBaker::writeColor(Color &color) {
+	writeFloat(color.r);
+	writeFloat(color.g);
+	writeFloat(color.b);
+	writeFloat(color.a);
+}
+
+void SkeletonBaker::writeFloats(Vector<float> &array) {
+	writeInt((int) array.size());
+	writeBytes(array.buffer(), array.size() * sizeof(float));
+}
+
+void SkeletonBaker::writeInts(Vector<int> &array) {
+	writeInt((int) array.size());
+	writeBytes(array.buffer(), array.size() * sizeof(int));
+}
+
+void SkeletonBaker::writeShorts(Vector<unsigned short> &array) {
+	writeInt((int) array.size());
+	writeBytes(array.buffer(), array.size() * sizeof(unsigned short));
+	align();
+}
+
+void SkeletonBaker::writeSequence(Sequence *sequence) {
+	writeBoolean(sequence != NULL);
+	if (!sequence) return;
+	writeInt((int) sequence->getRegions().size());
+	writeInt(sequence->getStart());
+	writeInt(sequence->getDigits());
+	writeInt(sequence->getSetupIndex());
+}
+
+bool SkeletonBaker::writeSkin(Skin *skin) {
+	writeString(skin->getName());
+	writeColor(skin->getColor());
+
+	Vector<BoneData *> &bones = skin->getBones();
+	writeInt((int) bones.size());
+	for (size_t i = 0; i < bones.size(); ++i)
+		writeInt(bones[i]->getIndex());
+
+	Vector<ConstraintData *> &constraints = skin->getConstraints();
+	writeInt((int) constraints.size());
+	for (size_t i = 0; i < constraints.size(); ++i) {
+		ConstraintData *constraint = constraints[i];
+		const RTTI &rtti = constraint->getRTTI();
+		if (rtti.isExactly(IkConstraintData::rtti)) {
+			writeInt(SkeletonBaked::CONSTRAINT_IK);
+			writeInt(_skeletonData->getIkConstraints().indexOf((IkConstraintData *) constraint));
+		} else if (rtti.isExactly(TransformConstraintData::rtti)) {
+			writeInt(SkeletonBaked::CONSTRAINT_TRANSFORM);
+			writeInt(_skeletonData->getTransformConstraints().indexOf((TransformConstraintData *) constraint));
+		} else if (rtti.isExactly(PathConstraintData::rtti)) {
+			writeInt(SkeletonBaked::CONSTRAINT_PATH);
+			writeInt(_skeletonData->getPathConstraints().indexOf((PathConstraintData *) constraint));
+		} else {
+			writeInt(SkeletonBaked::CONSTRAINT_PHYSICS);
+			writeInt(_skeletonData->getPhysicsConstraints().indexOf((PhysicsConstraintData *) constraint));
+		}
+	}
+
+	int count = 0;
+	Skin::AttachmentMap::Entries counter = skin->getAttachments();
+	while (counter.hasNext()) {
+		counter.next();
+		count++;
+	}
+	writeInt(count);
+	Skin::AttachmentMap::Entries entries = skin->getAttachments();
+	while (entries.hasNext()) {
+		Skin::AttachmentMap::Entry &entry = entries.next();
+		writeInt((int) entry._slotIndex);
+		writeString(entry._name);
+		if (!writeAttachment(entry._attachment)) return false;
+	}
+	return true;
+}
+
+bool SkeletonBaker::writeAttachment(Attachment *attachment) {
+	writeString(attachment->getName());
+	switch (attachment->getType()) {
+		case AttachmentType_Region: {
+			RegionAttachment *region = static_cast<RegionAttachment *>(attachment);
+			writeInt(AttachmentType_Region);
+			writeString(region->getPath());
+			writeColor(region->getColor());
+			writeSequence(region->getSequence());
+			writeFloat(region->getRotation());
+			writeFloat(region->getX());
+			writeFloat(region->getY());
+			writeFloat(region->getScaleX());
+			writeFloat(region->getScaleY());
+			writeFloat(region->getWidth());
+			writeFloat(region->getHeight());
+			return true;
+		}
+		case AttachmentType_Mesh:
+		case AttachmentType_Linkedmesh: {
+			MeshAttachment *mesh = static_cast<MeshAttachment *>(attachment);
+			MeshAttachment *parent = mesh->getParentMesh();
+			writeInt(parent ? AttachmentType_Linkedmesh : AttachmentType_Mesh);
+			writeString(mesh->getPath());
+			writeColor(mesh->getColor());
+			writeSequence(mesh->getSequence());
+			writeFloat(mesh->getWidth());
+			writeFloat(mesh->getHeight());
+			if (parent) {
+				writeBoolean(mesh->getTimelineAttachment() == parent);
+				return writeAttachmentRef(parent);
+			}
+			writeInt(mesh->getHullLength());
+			writeInt((int) mesh->getWorldVerticesLength());
+			writeInts(mesh->getBones());
+			writeFloats(mesh->getVertices());
+			writeFloats(mesh->getRegionUVs());
+			writeShorts(mesh->getTriangles());
+			writeShorts(mesh->getEdges());
+			return true;
+		}
+		case AttachmentType_Boundingbox: {
+			BoundingBoxAttachment *box = static_cast<BoundingBoxAttachment *>(attachment);
+			writeInt(AttachmentType_Boundingbox);
+			writeInt((int) box->getWorldVerticesLength());
+			writeInts(box->getBones());
+			writeFloats(box->getVertices());
+			writeColor(box->getColor());
+			return true;
+		}
+		case AttachmentType_Path: {
+			PathAttachment *path = static_cast<PathAttachment *>(attachment);
+			writeInt(AttachmentType_Path);
+			writeBoolean(path->isClosed());
+			writeBoolean(path->isConstantSpeed());
+			writeInt((int) path->getWorldVerticesLength());
+			writeInts(path->getBones());
+			writeFloats(path->getVertices());
+			writeFloats(path->getLengths());
+			writeColor(path->getColor());
+			return true;
+		}
+		case AttachmentType_Point: {
+			PointAttachment *point = static_cast<PointAttachment *>(attachment);
+			writeInt(AttachmentType_Point);
+			writeFloat(point->getRotation());
+			writeFloat(point->getX());
+			writeFloat(point->getY());
+			writeColor(point->getColor());
+			return true;
+		}
+		case AttachmentType_Clipping: {
+			ClippingAttachment *clip = static_cast<ClippingAttachment *>(attachment);
+			writeInt(AttachmentType_Clipping);
+			writeInt(clip->getEndSlot() ? clip->getEndSlot()->getIndex() : -1);
+			writeInt((int) clip->getWorldVerticesLength());
+			writeInts(clip->getBones());
+			writeFloats(clip->getVertices());
+			writeColor(clip->getColor());
+			return true;
+		}
+		default:
+			break;
+	}
+	setError("Unsupported attachment type: ", attachment->getName().buffer());
+	return false;
+}
+
+bool SkeletonBaker::writeAttachmentRef(Attachment *attachment) {
+	Vector<Skin *> &skins = _skeletonData->getSkins();
+	for (size_t i = 0; i < skins.size(); ++i) {
+		Skin::AttachmentMap::Entries entries = skins[i]->getAttachments();
+		while (entries.hasNext()) {
+			Skin::AttachmentMap::Entry &entry = entries.next();
+			if (entry._attachment != attachment) continue;
+			writeInt((int) i);
+			writeInt((int) entry._slotIndex);
+			writeString(entry._name);
+			return true;
+		}
+	}
+	setError("Attachment not found in any skin: ", attachment->getName().buffer());
+	return false;
+}
+
+bool SkeletonBaker::writeAnimation(Animation *animation) {
+	writeString(animation->getName());
+	writeFloat(animation->getDuration());
+	Vector<Timeline *> &timelines = animation->getTimelines();
+	writeInt((int) timelines.size());
+	for (size_t i = 0; i < timelines.size(); ++i) {
+		if (!writeTimeline(timelines[i])) return false;
+	}
+	return true;
+}
+
+bool SkeletonBaker::writeTimeline(Timeline *timeline) {
+	TimelineType type = timeline->getType();
+	writeInt(type);
+	int frameCount = (int) timeline->getFrameCount();
+	int bezierCount = 0;
+	if (timeline->getRTTI().instanceOf(CurveTimeline::rtti))
+		bezierCount = ((int) static_cast<CurveTimeline *>(timeline)->getCurves().size() - frameCount) / 18; // BEZIER_SIZE
+	writeInt(frameCount);
+	writeInt(bezierCount);
+
+	switch (type) {
+		case TimelineType_Rotate:
+			writeInt(static_cast<RotateTimeline *>(timeline)->getBoneIndex());
+			break;
+		case TimelineType_Translate:
+			writeInt(static_cast<TranslateTimeline *>(timeline)->getBoneIndex());
+			break;
+		case TimelineType_TranslateX:
+			writeInt(static_cast<TranslateXTimeline *>(timeline)->getBoneIndex());
+			break;
+		case TimelineType_TranslateY:
+			writeInt(static_cast<TranslateYTimeline *>(timeline)->getBoneIndex());
+			break;
+		case TimelineType_Scale:
+			writeInt(static_cast<ScaleTimeline *>(timeline)->getBoneIndex());
+			break;
+		case TimelineType_ScaleX:
+			writeInt(static_cast<ScaleXTimeline *>(timeline)->getBoneIndex());
+			break;
+		case TimelineType_ScaleY:
+			writeInt(static_cast<ScaleYTimeline *>(timeline)->getBoneIndex());
+			break;
+		case TimelineType_Shear:
+			writeInt(static_cast<ShearTimeline *>(timeline)->getBoneIndex());
+			break;
+		case TimelineType_ShearX:
+			writeInt(static_cast<ShearXTimeline *>(timeline)->getBoneIndex());
+			break;
+		case TimelineType_ShearY:
+			writeInt(static_cast<ShearYTimeline *>(timeline)->getBoneIndex());
+			break;
+		case TimelineType_Inherit:
+			writeInt(static_cast<InheritTimeline *>(timeline)->getBoneIndex());
+			break;
+		case TimelineType_RGBA:
+			writeInt(static_cast<RGBATimeline *>(timeline)->getSlotIndex());
+			break;
+		case TimelineType_RGB:
+			writeInt(static_cast<RGBTimeline *>(timeline)->getSlotIndex());
+			break;
+		case TimelineType_Alpha:
+			writeInt(static_cast<AlphaTimeline *>(timeline)->getSlotIndex());
+			break;
+		case TimelineType_RGBA2:
+			writeInt(static_cast<RGBA2Timeline *>(timeline)->getSlotIndex());
+			break;
+		case TimelineType_RGB2:
+			writeInt(static_cast<RGB2Timeline *>(timeline)->getSlotIndex());
+			break;
+		case TimelineType_Attachment: {
+			AttachmentTimeline *attachmentTimeline = static_cast<AttachmentTimeline *>(timeline);
+			writeInt(attachmentTimeline->getSlotIndex());
+			Vector<String> &names = attachmentTimeline->getAttachmentNames();
+			for (size_t i = 0; i < names.size(); ++i)
+				writeString(names[i]);
+			break;
+		}
+		case TimelineType_Deform: {
+			DeformTimeline *deformTimeline = static_cast<DeformTimeline *>(timeline);
+			writeInt(deformTimeline->getSlotIndex());
+			if (!writeAttachmentRef(deformTimeline->getAttachment())) return false;
+			Vector<Vector<float> > &vertices = deformTimeline->getVertices();
+			for (size_t i = 0; i < vertices.size(); ++i)
+				writeFloats(vertices[i]);
+			break;
+		}
+		case TimelineType_Sequence: {
+			SequenceTimeline *sequenceTimeline = static_cast<SequenceTimeline *>(timeline);
+			writeInt(sequenceTimeline->getSlotIndex());
+			if (!writeAttachmentRef(sequenceTimeline->getAttachment())) return false;
+			break;
+		}
+		case TimelineType_Event: {
+			Vector<Event *> &events = static_cast<EventTimeline *>(timeline)->getEvents();
+			for (size_t i = 0; i < events.size(); ++i) {
+				Event *event = events[i];
+				writeInt(_skeletonData->getEvents().indexOf(const_cast<EventData *>(&event->getData())));
+				writeFloat(event->getTime());
+				writeInt(event->getIntValue());
+				writeFloat(event->getFloatValue());
+				writeString(event->getStringValue());
+				writeFloat(event->getVolume());
+				writeFloat(event->getBalance());
+			}
+			break;
+		}
+		case TimelineType_DrawOrder: {
+			Vector<Vector<int> > &drawOrders = static_cast<DrawOrderTimeline *>(timeline)->getDrawOrders();
+			for (size_t i = 0; i < drawOrders.size(); ++i)
+				writeInts(drawOrders[i]);
+			break;
+		}
+		case TimelineType_IkConstraint:
+			writeInt(static_cast<IkConstraintTimeline *>(timeline)->getIkConstraintIndex());
+			break;
+		case TimelineType_TransformConstraint:
+			writeInt(static_cast<TransformConstraintTimeline *>(timeline)->getTransformConstraintIndex());
+			break;
+		case TimelineType_PathConstraintPosition:
+			writeInt(static_cast<PathConstraintPositionTimeline *>(timeline)->getPathConstraintIndex());
+			break;
+		case TimelineType_PathConstraintSpacing:
+			writeInt(static_cast<PathConstraintSpacingTimeline *>(timeline)->getPathConstraintIndex());
+			break;
+		case TimelineType_PathConstraintMix:
+			writeInt(static_cast<PathConstraintMixTimeline *>(timeline)->getPathConstraintIndex());
+			break;
+		case TimelineType_PhysicsConstraint: {
+			const RTTI &rtti = timeline->getRTTI();
+			int property;
+			if (rtti.isExactly(PhysicsConstraintInertiaTimeline::rtti))
+				property = SkeletonBaked::PHYSICS_INERTIA;
+			else if (rtti.isExactly(PhysicsConstraintStrengthTimeline::rtti))
+				property = SkeletonBaked::PHYSICS_STRENGTH;
+			else if (rtti.isExactly(PhysicsConstraintDampingTimeline::rtti))
+				property = SkeletonBaked::PHYSICS_DAMPING;
+			else if (rtti.isExactly(PhysicsConstraintMassTimeline::rtti))
+				property = SkeletonBaked::PHYSICS_MASS;
+			else if (rtti.isExactly(PhysicsConstraintWindTimeline::rtti))
+				property = SkeletonBaked::PHYSICS_WIND;
+			else if (rtti.isExactly(PhysicsConstraintGravityTimeline::rtti))
+				property = SkeletonBaked::PHYSICS_GRAVITY;
+			else
+				property = SkeletonBaked::PHYSICS_MIX;
+			writeInt(property);
+			writeInt(static_cast<PhysicsConstraintTimeline *>(timeline)->getPhysicsConstraintIndex());
+			break;
+		}
+		case TimelineType_PhysicsConstraintReset:
+			writeInt(static_cast<PhysicsConstraintResetTimeline *>(timeline)->getPhysicsConstraintIndex());
+			break;
+		default:
+			setError("Unsupported timeline type in animation", NULL);
+			return false;
+	}
+
+	writeFloats(timeline->getFrames());
+	if (timeline->getRTTI().instanceOf(CurveTimeline::rtti))
+		writeFloats(static_cast<CurveTimeline *>(timeline)->getCurves());
+	return true;
+}
@@ -0,0 +1,235 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated April 5, 2025. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2025, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/SkeletonBatch.h>
+
+#include <spine/AnimationState.h>
+#include <spine/MeshAttachment.h>
+#include <spine/RegionAttachment.h>
+#include <spine/Skeleton.h>
+#include <spine/SkeletonData.h>
+#include <spine/SkeletonRenderer.h>
+#include <spine/Skin.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <new>
+#include <thread>
+
+using namespace spine;
+
+namespace {
+	bool hasSequences(SkeletonData &data) {
+		Vector<Skin *> &skins = data.getSkins();
+		for (size_t i = 0, n = skins.size(); i < n; i++) {
+			Skin::AttachmentMap::Entries entries = skins[i]->getAttachments();
+			while (entries.hasNext()) {
+				Attachment *attachment = entries.next()._attachment;
+				if (attachment->getType() == AttachmentType_Region) {
+					if (static_cast<RegionAttachment *>(attachment)->getSequence()) return true;
+				} else if (attachment->getType() == AttachmentType_Mesh) {
+					if (static_cast<MeshAttachment *>(attachment)->getSequence()) return true;
+				}
+			}
+		}
+		return false;
+	}
+}
+
+/// Each thread owns a range of instances and steals from the other ranges once its own is exhausted. All memory comes from
+/// the SpineExtension, only the threads' start up state is allocated by the standard library.
+struct SkeletonBatch::Pool : public SpineObject {
+	/// Padded so the counters of different threads are never on the same cache line.
+	struct Range {
+		std::atomic<size_t> next;
+		size_t end;
+		char padding[64 - sizeof(std::atomic<size_t>) - sizeof(size_t)];
+	};
+
+	explicit Pool(int threadCount) : threadCount(threadCount), ranges(NULL), renderers(), threads(NULL), threadsStarted(0),
+									 generation(0), pending(0), quit(false) {
+		ranges = SpineExtension::alloc<Range>(threadCount, __FILE__, __LINE__);
+		for (int i = 0; i < threadCount; i++) {
+			new (ranges + i) Range();
+			renderers.add(new (__FILE__, __LINE__) SkeletonRenderer());
+		}
+		threads = SpineExtension::alloc<std::thread>(threadCount, __FILE__, __LINE__);
+	}
+
+	~Pool() {
+		for (int i = 0; i < threadsStarted; i++)
+			threads[i].~thread();
+		SpineExtension::free(threads, __FILE__, __LINE__);
+		for (int i = 0; i < threadCount; i++) {
+			ranges[i].~Range();
+			delete renderers[i];
+		}
+		SpineExtension::free(ranges, __FILE__, __LINE__);
+	}
+
+	int threadCount;
+	Range *ranges;
+	Vector<SkeletonRenderer *> renderers;
+	std::thread *threads;
+	int threadsStarted;
+	std::mutex mutex;
+	std::condition_variable start;
+	std::condition_variable done;
+	size_t generation;
+	int pending;
+	bool quit;
+	std::mutex sequenceMutex;
+};
+
+SkeletonBatch::SkeletonBatch(int threadCount) : _listener(NULL), _delta(0), _physics(Physics_Update), _pool(NULL) {
+	if (threadCount <= 0) threadCount = (int) std::thread::hardware_concurrency();
+	if (threadCount <= 0) threadCount = 1;
+	_pool = new (__FILE__, __LINE__) Pool(threadCount);
+	for (int thread = 1; thread < threadCount; thread++) {
+		new (_pool->threads + _pool->threadsStarted++) std::thread([this, thread]() {
+			Pool &pool = *_pool;
+			size_t generation = 0;
+			while (true) {
+				{
+					std::unique_lock<std::mutex> lock(pool.mutex);
+					pool.start.wait(lock, [&pool, generation]() { return pool.quit || pool.generation != generation; });
+					if (pool.quit) return;
+					generation = pool.generation;
+				}
+				work(thread);
+				std::lock_guard<std::mutex> lock(pool.mutex);
+				if (--pool.pending == 0) pool.done.notify_one();
+			}
+		});
+	}
+}
+
+SkeletonBatch::~SkeletonBatch() {
+	{
+		std::lock_guard<std::mutex> lock(_pool->mutex);
+		_pool->quit = true;
+	}
+	_pool->start.notify_all();
+	for (int i = 0; i < _pool->threadsStarted; i++)
+		_pool->threads[i].join();
+	delete _pool;
+}
+
+size_t SkeletonBatch::add(Skeleton *skeleton, AnimationState *state) {
+	_skeletons.add(skeleton);
+	_states.add(state);
+	_sequenced.add(hasSequences(*skeleton->getData()));
+	return _skeletons.size() - 1;
+}
+
+void SkeletonBatch::clear() {
+	_skeletons.clear();
+	_states.clear();
+	_sequenced.clear();
+}
+
+size_t SkeletonBatch::size() {
+	return _skeletons.size();
+}
+
+Skeleton *SkeletonBatch::getSkeleton(size_t index) {
+	return _skeletons[index];
+}
+
+AnimationState *SkeletonBatch::getState(size_t index) {
+	return _states[index];
+}
+
+void SkeletonBatch::setListener(SkeletonBatchListener *listener) {
+	_listener = listener;
+}
+
+int SkeletonBatch::getThreadCount() {
+	return _pool->threadCount;
+}
+
+void SkeletonBatch::update(float delta, Physics physics) {
+	size_t n = _skeletons.size();
+	if (n == 0) return;
+	_delta = delta;
+	_physics = physics;
+
+	Pool &pool = *_pool;
+	int threadCount = pool.threadCount;
+	for (int i = 0; i < threadCount; i++) {
+		pool.ranges[i].next.store(n * i / threadCount, std::memory_order_relaxed);
+		pool.ranges[i].end = n * (i + 1) / threadCount;
+	}
+	if (threadCount == 1) {
+		work(0);
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(pool.mutex);
+		pool.pending = threadCount - 1;
+		pool.generation++;
+	}
+	pool.start.notify_all();
+	work(0);
+	std::unique_lock<std::mutex> lock(pool.mutex);
+	pool.done.wait(lock, [&pool]() { return pool.pending == 0; });
+}
+
+void SkeletonBatch::work(int thread) {
+	Pool::Range *ranges = _pool->ranges;
+	int threadCount = _pool->threadCount;
+	for (int i = 0; i < threadCount; i++) {
+		Pool::Range &range = ranges[(thread + i) % threadCount];
+		for (size_t index; (index = range.next.fetch_add(1, std::memory_order_relaxed)) < range.end;)
+			updateInstance(index, thread);
+	}
+}
+
+void SkeletonBatch::updateInstance(size_t index, int thread) {
+	Skeleton &skeleton = *_skeletons[index];
+	AnimationState *state = _states[index];
+	if (state) {
+		state->update(_delta);
+		state->apply(skeleton);
+	}
+	skeleton.update(_delta);
+	skeleton.updateWorldTransform(_physics);
+
+	if (!_listener) return;
+	SkeletonRenderer &renderer = *_pool->renderers[thread];
+	RenderCommand *commands;
+	if (_sequenced[index]) {
+		std::lock_guard<std::mutex> lock(_pool->sequenceMutex);
+		commands = renderer.render(skeleton);
+	} else
+		commands = renderer.render(skeleton);
+	_listener->rendered(*this, index, commands, thread);
+}
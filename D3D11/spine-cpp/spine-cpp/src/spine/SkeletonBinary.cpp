@@ -396,19 +396,28 @@ SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, cons
 	}
 
 	delete input;
+	skeletonData->buildNameIndex();
+	skeletonData->buildSkinningLayouts();
 	return skeletonData;
 }
 
 SkeletonData *SkeletonBinary::readSkeletonDataFile(const String &path) {
 	int length;
 	SkeletonData *skeletonData;
-	const char *binary = SpineExtension::readFile(path.buffer(), &length);
+	// Parse straight from a mapping of the file when the extension supports it, else from a copy.
+	const char *binary = SpineExtension::mapFile(path, &length);
+	bool mapped = binary != NULL;
+	if (!mapped) binary = SpineExtension::readFile(path.buffer(), &length);
 	if (length == 0 || !binary) {
+		if (binary) SpineExtension::free(binary, __FILE__, __LINE__);
 		setError("Unable to read skeleton file: ", path.buffer());
 		return NULL;
 	}
 	skeletonData = readSkeletonData((unsigned char *) binary, length);
-	SpineExtension::free(binary, __FILE__, __LINE__);
+	if (mapped)
+		SpineExtension::unmapFile(binary, length);
+	else
+		SpineExtension::free(binary, __FILE__, __LINE__);
 	return skeletonData;
 }
 
@@ -749,6 +758,8 @@ Attachment *SkeletonBinary::readAttachment(DataInput *input, Skin *skin, int slo
 			_attachmentLoader->configureAttachment(clip);
 			return clip;
 		}
+		default:
+			break;
 	}
 	return NULL;
 }
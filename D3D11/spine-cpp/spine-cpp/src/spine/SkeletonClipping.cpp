@@ -41,6 +41,17 @@ SkeletonClipping::SkeletonClipping() : _clipAttachment(NULL) {
 	_clippedUVs.ensureCapacity(128);
 }
 
+void SkeletonClipping::reserve(size_t vertexCount, size_t indexCount, size_t clipVertexCount) {
+	_clippingPolygon.ensureCapacity(clipVertexCount << 1);
+	_triangulator.reserve(clipVertexCount);
+	// A triangle clipped by a convex polygon has at most a vertex per edge of both, plus the closing vertex.
+	_clipOutput.ensureCapacity((clipVertexCount + 4) << 1);
+	_scratch.ensureCapacity((clipVertexCount + 4) << 1);
+	_clippedVertices.ensureCapacity(vertexCount << 1);
+	_clippedUVs.ensureCapacity(vertexCount << 1);
+	_clippedTriangles.ensureCapacity(indexCount);
+}
+
 size_t SkeletonClipping::clipStart(Slot &slot, ClippingAttachment *clip) {
 	if (_clipAttachment != NULL) {
 		return 0;
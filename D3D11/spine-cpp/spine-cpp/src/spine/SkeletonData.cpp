@@ -38,6 +38,7 @@
 #include <spine/Skin.h>
 #include <spine/SlotData.h>
 #include <spine/TransformConstraintData.h>
+#include <spine/VertexAttachment.h>
 
 #include <spine/ContainerUtil.h>
 
@@ -74,40 +75,102 @@ SkeletonData::~SkeletonData() {
 	}
 }
 
+namespace {
+	template<typename T>
+	int findIndex(NameIndex &index, Vector<T *> &items, const String &name) {
+		assert(name.length() > 0);
+		if (index.isValid(items.size())) return index.find(name);
+		return ContainerUtil::findIndexWithName(items, name);
+	}
+
+	template<typename T>
+	T *find(NameIndex &index, Vector<T *> &items, const String &name) {
+		int i = findIndex(index, items, name);
+		return i == -1 ? NULL : items[i];
+	}
+}
+
 BoneData *SkeletonData::findBone(const String &boneName) {
-	return ContainerUtil::findWithName(_bones, boneName);
+	return find(_boneIndex, _bones, boneName);
 }
 
 SlotData *SkeletonData::findSlot(const String &slotName) {
-	return ContainerUtil::findWithName(_slots, slotName);
+	return find(_slotIndex, _slots, slotName);
 }
 
 Skin *SkeletonData::findSkin(const String &skinName) {
-	return ContainerUtil::findWithName(_skins, skinName);
+	return find(_skinIndex, _skins, skinName);
 }
 
 spine::EventData *SkeletonData::findEvent(const String &eventDataName) {
-	return ContainerUtil::findWithName(_events, eventDataName);
+	return find(_eventIndex, _events, eventDataName);
 }
 
 Animation *SkeletonData::findAnimation(const String &animationName) {
-	return ContainerUtil::findWithName(_animations, animationName);
+	return find(_animationIndex, _animations, animationName);
 }
 
 IkConstraintData *SkeletonData::findIkConstraint(const String &constraintName) {
-	return ContainerUtil::findWithName(_ikConstraints, constraintName);
+	return find(_ikConstraintIndex, _ikConstraints, constraintName);
 }
 
 TransformConstraintData *SkeletonData::findTransformConstraint(const String &constraintName) {
-	return ContainerUtil::findWithName(_transformConstraints, constraintName);
+	return find(_transformConstraintIndex, _transformConstraints, constraintName);
 }
 
 PathConstraintData *SkeletonData::findPathConstraint(const String &constraintName) {
-	return ContainerUtil::findWithName(_pathConstraints, constraintName);
+	return find(_pathConstraintIndex, _pathConstraints, constraintName);
 }
 
 PhysicsConstraintData *SkeletonData::findPhysicsConstraint(const String &constraintName) {
-	return ContainerUtil::findWithName(_physicsConstraints, constraintName);
+	return find(_physicsConstraintIndex, _physicsConstraints, constraintName);
+}
+
+int SkeletonData::findBoneIndex(const String &boneName) {
+	return findIndex(_boneIndex, _bones, boneName);
+}
+
+int SkeletonData::findSlotIndex(const String &slotName) {
+	return findIndex(_slotIndex, _slots, slotName);
+}
+
+int SkeletonData::findIkConstraintIndex(const String &constraintName) {
+	return findIndex(_ikConstraintIndex, _ikConstraints, constraintName);
+}
+
+int SkeletonData::findTransformConstraintIndex(const String &constraintName) {
+	return findIndex(_transformConstraintIndex, _transformConstraints, constraintName);
+}
+
+int SkeletonData::findPathConstraintIndex(const String &constraintName) {
+	return findIndex(_pathConstraintIndex, _pathConstraints, constraintName);
+}
+
+int SkeletonData::findPhysicsConstraintIndex(const String &constraintName) {
+	return findIndex(_physicsConstraintIndex, _physicsConstraints, constraintName);
+}
+
+void SkeletonData::buildNameIndex() {
+	_boneIndex.build(_bones);
+	_slotIndex.build(_slots);
+	_skinIndex.build(_skins);
+	_eventIndex.build(_events);
+	_animationIndex.build(_animations);
+	_ikConstraintIndex.build(_ikConstraints);
+	_transformConstraintIndex.build(_transformConstraints);
+	_pathConstraintIndex.build(_pathConstraints);
+	_physicsConstraintIndex.build(_physicsConstraints);
+}
+
+void SkeletonData::buildSkinningLayouts() {
+	for (size_t i = 0, n = _skins.size(); i < n; i++) {
+		Skin::AttachmentMap::Entries entries = _skins[i]->getAttachments();
+		while (entries.hasNext()) {
+			Attachment *attachment = entries.next()._attachment;
+			if (attachment->getRTTI().instanceOf(VertexAttachment::rtti))
+				static_cast<VertexAttachment *>(attachment)->updateSkinningLayout();
+		}
+	}
 }
 
 const String &SkeletonData::getName() {
@@ -0,0 +1,470 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated April 5, 2025. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2025, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/SkeletonDataCache.h>
+
+#include <spine/Animation.h>
+#include <spine/AsyncLoader.h>
+#include <spine/Atlas.h>
+#include <spine/AttachmentTimeline.h>
+#include <spine/BoneData.h>
+#include <spine/BoundingBoxAttachment.h>
+#include <spine/ClippingAttachment.h>
+#include <spine/CurveTimeline.h>
+#include <spine/DeformTimeline.h>
+#include <spine/DrawOrderTimeline.h>
+#include <spine/EventData.h>
+#include <spine/IkConstraintData.h>
+#include <spine/MeshAttachment.h>
+#include <spine/PathAttachment.h>
+#include <spine/PathConstraintData.h>
+#include <spine/PhysicsConstraintData.h>
+#include <spine/PointAttachment.h>
+#include <spine/RegionAttachment.h>
+#include <spine/SkeletonData.h>
+#include <spine/Skin.h>
+#include <spine/SlotData.h>
+#include <spine/TransformConstraintData.h>
+
+using namespace spine;
+
+struct SkeletonDataCache::AtlasEntry : public SpineObject {
+	String key;
+	Atlas *atlas;
+	int references;
+	size_t size;
+};
+
+namespace {
+	/// Appends the path with '/' separators and without empty or "." segments. ".." removes the previous segment if there is one.
+	void appendNormalized(String &out, const String &path) {
+		const char *chars = path.buffer();
+		size_t length = path.length();
+		Vector<size_t> starts, lengths;
+		for (size_t i = 0; i < length;) {
+			size_t start = i;
+			while (i < length && chars[i] != '/' && chars[i] != '\\') i++;
+			size_t segment = i - start;
+			i++;
+			if (segment == 0 || (segment == 1 && chars[start] == '.')) continue;
+			if (segment == 2 && chars[start] == '.' && chars[start + 1] == '.' && starts.size() > 0 &&
+				!(lengths[lengths.size() - 1] == 2 && !strncmp(chars + starts[starts.size() - 1], "..", 2))) {
+				starts.removeAt(starts.size() - 1);
+				lengths.removeAt(lengths.size() - 1);
+				continue;
+			}
+			starts.add(start);
+			lengths.add(segment);
+		}
+
+		size_t used = length > 0 && (chars[0] == '/' || chars[0] == '\\') ? 1 : 0;
+		for (size_t i = 0; i < lengths.size(); i++)
+			used += lengths[i] + 1;
+		char *normalized = SpineExtension::alloc<char>(used + 1, __FILE__, __LINE__);
+		char *cursor = normalized;
+		if (length > 0 && (chars[0] == '/' || chars[0] == '\\')) *cursor++ = '/';
+		for (size_t i = 0; i < starts.size(); i++) {
+			if (i > 0) *cursor++ = '/';
+			for (size_t ii = 0; ii < lengths[i]; ii++) {
+				char c = chars[starts[i] + ii];
+#ifdef _WIN32
+				if (c >= 'A' && c <= 'Z') c += 'a' - 'A';
+#endif
+				*cursor++ = c;
+			}
+		}
+		*cursor = 0;
+		out.append(normalized);
+		SpineExtension::free(normalized, __FILE__, __LINE__);
+	}
+
+	void appendKey(String &key, const String &atlasPath, const String &skeletonPath, float scale) {
+		appendNormalized(key, skeletonPath);
+		key.append("\n");
+		appendNormalized(key, atlasPath);
+		key.append("\n");
+		key.append(scale);
+	}
+
+	template<typename T>
+	size_t vectorSize(Vector<T> &vector) {
+		return vector.getCapacity() * sizeof(T);
+	}
+
+	size_t attachmentSize(Attachment *attachment) {
+		switch (attachment->getType()) {
+			case AttachmentType_Region: {
+				RegionAttachment *region = static_cast<RegionAttachment *>(attachment);
+				return sizeof(RegionAttachment) + vectorSize(region->getOffset()) + vectorSize(region->getUVs());
+			}
+			case AttachmentType_Mesh:
+			case AttachmentType_Linkedmesh: {
+				MeshAttachment *mesh = static_cast<MeshAttachment *>(attachment);
+				return sizeof(MeshAttachment) + vectorSize(mesh->getBones()) + vectorSize(mesh->getVertices()) +
+					   vectorSize(mesh->getRegionUVs()) + vectorSize(mesh->getUVs()) + vectorSize(mesh->getTriangles()) +
+					   vectorSize(mesh->getEdges());
+			}
+			case AttachmentType_Boundingbox: {
+				BoundingBoxAttachment *box = static_cast<BoundingBoxAttachment *>(attachment);
+				return sizeof(BoundingBoxAttachment) + vectorSize(box->getBones()) + vectorSize(box->getVertices());
+			}
+			case AttachmentType_Clipping: {
+				ClippingAttachment *clip = static_cast<ClippingAttachment *>(attachment);
+				return sizeof(ClippingAttachment) + vectorSize(clip->getBones()) + vectorSize(clip->getVertices());
+			}
+			case AttachmentType_Path: {
+				PathAttachment *path = static_cast<PathAttachment *>(attachment);
+				return sizeof(PathAttachment) + vectorSize(path->getBones()) + vectorSize(path->getVertices()) +
+					   vectorSize(path->getLengths());
+			}
+			case AttachmentType_Point:
+				return sizeof(PointAttachment);
+			default:
+				break;
+		}
+		return 0;
+	}
+
+	size_t timelineSize(Timeline *timeline) {
+		size_t size = sizeof(CurveTimeline2) + vectorSize(timeline->getFrames());
+		const RTTI &rtti = timeline->getRTTI();
+		if (rtti.instanceOf(CurveTimeline::rtti)) size += vectorSize(static_cast<CurveTimeline *>(timeline)->getCurves());
+		if (rtti.isExactly(DeformTimeline::rtti)) {
+			Vector<Vector<float> > &vertices = static_cast<DeformTimeline *>(timeline)->getVertices();
+			size += vectorSize(vertices);
+			for (size_t i = 0; i < vertices.size(); i++)
+				size += vectorSize(vertices[i]);
+		} else if (rtti.isExactly(DrawOrderTimeline::rtti)) {
+			Vector<Vector<int> > &drawOrders = static_cast<DrawOrderTimeline *>(timeline)->getDrawOrders();
+			size += vectorSize(drawOrders);
+			for (size_t i = 0; i < drawOrders.size(); i++)
+				size += vectorSize(drawOrders[i]);
+		} else if (rtti.isExactly(AttachmentTimeline::rtti)) {
+			Vector<String> &names = static_cast<AttachmentTimeline *>(timeline)->getAttachmentNames();
+			size += vectorSize(names);
+			for (size_t i = 0; i < names.size(); i++)
+				size += names[i].length();
+		}
+		return size;
+	}
+}
+
+SkeletonDataCache::Entry::Entry(const String &key, AtlasEntry *atlas, SkeletonData *skeletonData, float scale) : _key(key),
+																												 _atlas(atlas),
+																												 _skeletonData(skeletonData),
+																												 _scale(scale),
+																												 _references(0),
+																												 _size(0),
+																												 _lastUse(0) {
+}
+
+SkeletonDataCache::Entry::~Entry() {
+	delete _skeletonData;
+}
+
+SkeletonData *SkeletonDataCache::Entry::getSkeletonData() {
+	return _skeletonData;
+}
+
+Atlas *SkeletonDataCache::Entry::getAtlas() {
+	return _atlas->atlas;
+}
+
+float SkeletonDataCache::Entry::getScale() {
+	return _scale;
+}
+
+int SkeletonDataCache::Entry::getReferenceCount() {
+	return _references;
+}
+
+size_t SkeletonDataCache::Entry::getSize() {
+	return _size;
+}
+
+SkeletonDataCache::SkeletonDataCache(TextureLoader *textureLoader, size_t budget) : _textureLoader(textureLoader),
+																					_budget(budget),
+																					_size(0),
+																					_clock(0),
+																					_hits(0),
+																					_misses(0),
+																					_evictions(0) {
+}
+
+SkeletonDataCache::~SkeletonDataCache() {
+	HashMap<String, Entry *>::Entries entries = _entries.getEntries();
+	while (entries.hasNext()) {
+		Entry *entry = entries.next().value;
+		AtlasEntry *atlas = entry->_atlas;
+		delete entry;
+		releaseAtlas(atlas);
+	}
+}
+
+SkeletonDataCache::Entry *SkeletonDataCache::acquire(const String &atlasPath, const String &skeletonPath, float scale) {
+	String key;
+	appendKey(key, atlasPath, skeletonPath, scale);
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (_entries.containsKey(key)) {
+		_hits++;
+		return use(_entries[key]);
+	}
+	_misses++;
+	AtlasEntry *atlas = acquireAtlas(atlasPath);
+	if (!atlas) return NULL;
+	SkeletonData *skeletonData = AsyncLoader::readSkeletonDataFile(atlas->atlas, skeletonPath, scale, _error);
+	if (!skeletonData) {
+		releaseAtlas(atlas);
+		return NULL;
+	}
+	return use(add(key, atlas, skeletonData, scale));
+}
+
+SkeletonDataCache::Entry *SkeletonDataCache::acquire(AsyncLoad &load) {
+	assert(load.isDone());
+	String key;
+	appendKey(key, load._atlasPath, load._skeletonPath, load._scale);
+	Atlas *atlas = load._atlas;
+	SkeletonData *skeletonData = load._skeletonData;
+	load._atlas = NULL;
+	load._skeletonData = NULL;
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (_entries.containsKey(key)) {
+		delete skeletonData;
+		delete atlas;
+		_hits++;
+		return use(_entries[key]);
+	}
+	_misses++;
+	if (!skeletonData || !atlas) {
+		delete skeletonData;
+		delete atlas;
+		_error = load._error;
+		return NULL;
+	}
+	return use(add(key, adoptAtlas(load._atlasPath, atlas), skeletonData, load._scale));
+}
+
+void SkeletonDataCache::retain(Entry *entry) {
+	std::lock_guard<std::mutex> lock(_mutex);
+	entry->_references++;
+}
+
+void SkeletonDataCache::release(Entry *entry) {
+	std::lock_guard<std::mutex> lock(_mutex);
+	assert(entry->_references > 0);
+	entry->_references--;
+	evict(_budget);
+}
+
+void SkeletonDataCache::setBudget(size_t budget) {
+	std::lock_guard<std::mutex> lock(_mutex);
+	_budget = budget;
+	evict(_budget);
+}
+
+size_t SkeletonDataCache::getBudget() {
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _budget;
+}
+
+size_t SkeletonDataCache::getSize() {
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _size;
+}
+
+size_t SkeletonDataCache::getEntryCount() {
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _entries.size();
+}
+
+size_t SkeletonDataCache::getHits() {
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _hits;
+}
+
+size_t SkeletonDataCache::getMisses() {
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _misses;
+}
+
+size_t SkeletonDataCache::getEvictions() {
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _evictions;
+}
+
+void SkeletonDataCache::resetCounters() {
+	std::lock_guard<std::mutex> lock(_mutex);
+	_hits = 0;
+	_misses = 0;
+	_evictions = 0;
+}
+
+void SkeletonDataCache::clear() {
+	std::lock_guard<std::mutex> lock(_mutex);
+	evict(0);
+}
+
+String SkeletonDataCache::getError() {
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _error;
+}
+
+SkeletonDataCache::Entry *SkeletonDataCache::add(const String &key, AtlasEntry *atlas, SkeletonData *skeletonData, float scale) {
+	Entry *entry = new (__FILE__, __LINE__) Entry(key, atlas, skeletonData, scale);
+	entry->_size = estimateSize(*skeletonData);
+	_size += entry->_size;
+	_entries.put(key, entry);
+	return entry;
+}
+
+SkeletonDataCache::Entry *SkeletonDataCache::use(Entry *entry) {
+	entry->_references++;
+	entry->_lastUse = ++_clock;
+	evict(_budget);
+	return entry;
+}
+
+SkeletonDataCache::AtlasEntry *SkeletonDataCache::acquireAtlas(const String &path) {
+	String key;
+	appendNormalized(key, path);
+	AtlasEntry *entry;
+	if (_atlases.containsKey(key)) {
+		entry = _atlases[key];
+	} else {
+		Atlas *atlas = new (__FILE__, __LINE__) Atlas(path, _textureLoader);
+		if (atlas->getPages().size() == 0) {
+			delete atlas;
+			_error = "Unable to read atlas file: ";
+			_error.append(path);
+			return NULL;
+		}
+		entry = new (__FILE__, __LINE__) AtlasEntry();
+		entry->key = key;
+		entry->atlas = atlas;
+		entry->references = 0;
+		entry->size = estimateSize(*atlas);
+		_size += entry->size;
+		_atlases.put(key, entry);
+	}
+	entry->references++;
+	return entry;
+}
+
+// The skeleton data of a load references the regions of the loaded atlas, so that atlas is kept even if one for the same path
+// is cached already. Only the first is shared by later acquire() calls.
+SkeletonDataCache::AtlasEntry *SkeletonDataCache::adoptAtlas(const String &path, Atlas *atlas) {
+	AtlasEntry *entry = new (__FILE__, __LINE__) AtlasEntry();
+	appendNormalized(entry->key, path);
+	entry->atlas = atlas;
+	entry->references = 1;
+	entry->size = estimateSize(*atlas);
+	_size += entry->size;
+	if (!_atlases.containsKey(entry->key)) _atlases.put(entry->key, entry);
+	return entry;
+}
+
+void SkeletonDataCache::releaseAtlas(AtlasEntry *atlas) {
+	if (--atlas->references > 0) return;
+	_size -= atlas->size;
+	if (_atlases.containsKey(atlas->key) && _atlases[atlas->key] == atlas) _atlases.remove(atlas->key);
+	delete atlas->atlas;
+	delete atlas;
+}
+
+void SkeletonDataCache::evict(size_t budget) {
+	while (_size > budget) {
+		Entry *oldest = NULL;
+		HashMap<String, Entry *>::Entries entries = _entries.getEntries();
+		while (entries.hasNext()) {
+			Entry *entry = entries.next().value;
+			if (entry->_references == 0 && (!oldest || entry->_lastUse < oldest->_lastUse)) oldest = entry;
+		}
+		if (!oldest) return;
+		remove(oldest);
+		_evictions++;
+	}
+}
+
+void SkeletonDataCache::remove(Entry *entry) {
+	AtlasEntry *atlas = entry->_atlas;
+	_size -= entry->_size;
+	_entries.remove(entry->_key);
+	delete entry;
+	releaseAtlas(atlas);
+}
+
+size_t SkeletonDataCache::estimateSize(SkeletonData &skeletonData) {
+	size_t size = sizeof(SkeletonData);
+	size += skeletonData.getBones().size() * sizeof(BoneData) + vectorSize(skeletonData.getBones());
+	size += skeletonData.getSlots().size() * sizeof(SlotData) + vectorSize(skeletonData.getSlots());
+	size += skeletonData.getEvents().size() * sizeof(EventData) + vectorSize(skeletonData.getEvents());
+	Vector<IkConstraintData *> &ikConstraints = skeletonData.getIkConstraints();
+	for (size_t i = 0; i < ikConstraints.size(); i++)
+		size += sizeof(IkConstraintData) + vectorSize(ikConstraints[i]->getBones());
+	Vector<TransformConstraintData *> &transformConstraints = skeletonData.getTransformConstraints();
+	for (size_t i = 0; i < transformConstraints.size(); i++)
+		size += sizeof(TransformConstraintData) + vectorSize(transformConstraints[i]->getBones());
+	Vector<PathConstraintData *> &pathConstraints = skeletonData.getPathConstraints();
+	for (size_t i = 0; i < pathConstraints.size(); i++)
+		size += sizeof(PathConstraintData) + vectorSize(pathConstraints[i]->getBones());
+	size += skeletonData.getPhysicsConstraints().size() * sizeof(PhysicsConstraintData);
+
+	Vector<Skin *> &skins = skeletonData.getSkins();
+	for (size_t i = 0; i < skins.size(); i++) {
+		size += sizeof(Skin);
+		Skin::AttachmentMap::Entries entries = skins[i]->getAttachments();
+		while (entries.hasNext()) {
+			Skin::AttachmentMap::Entry &entry = entries.next();
+			size += sizeof(Skin::AttachmentMap::Entry) + entry._name.length() + attachmentSize(entry._attachment);
+		}
+	}
+
+	Vector<Animation *> &animations = skeletonData.getAnimations();
+	for (size_t i = 0; i < animations.size(); i++) {
+		Vector<Timeline *> &timelines = animations[i]->getTimelines();
+		size += sizeof(Animation) + vectorSize(timelines);
+		for (size_t ii = 0; ii < timelines.size(); ii++)
+			size += timelineSize(timelines[ii]);
+	}
+	return size;
+}
+
+size_t SkeletonDataCache::estimateSize(Atlas &atlas) {
+	size_t size = sizeof(Atlas);
+	Vector<AtlasPage *> &pages = atlas.getPages();
+	for (size_t i = 0; i < pages.size(); i++)
+		size += sizeof(AtlasPage) + (size_t) pages[i]->width * pages[i]->height * 4;
+	Vector<AtlasRegion *> &regions = atlas.getRegions();
+	for (size_t i = 0; i < regions.size(); i++)
+		size += sizeof(AtlasRegion) + regions[i]->name.length();
+	return size;
+}
@@ -0,0 +1,111 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated April 5, 2025. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2025, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/SkeletonGeometry.h>
+
+using namespace spine;
+
+SkeletonGeometry::SkeletonGeometry(const VertexLayout &layout) : _layout(layout), _renderer(), _vertices(), _indices(),
+																  _vertexCount(0), _indexCount(0), _drawRanges() {
+}
+
+SkeletonGeometry::~SkeletonGeometry() {
+}
+
+void SkeletonGeometry::build(Skeleton &skeleton) {
+	_drawRanges.clear();
+	// The arrays stay at their largest size so render() writes into them directly. It only fails when a frame needs more.
+	RenderCommand *command = _renderer.render(skeleton, _layout, _vertices.buffer(), _vertices.size() / _layout.stride,
+											  _indices.buffer(), _indices.size());
+	_vertexCount = _renderer.getVertexCount();
+	_indexCount = _renderer.getIndexCount();
+	if (_vertexCount * _layout.stride > _vertices.size() || _indexCount > _indices.size()) {
+		if (_vertexCount * _layout.stride > _vertices.size()) _vertices.setSize(_vertexCount * _layout.stride, 0);
+		if (_indexCount > _indices.size()) _indices.setSize(_indexCount, 0);
+		command = _renderer.render(skeleton, _layout, _vertices.buffer(), _vertexCount, _indices.buffer(), _indexCount);
+	}
+
+	// Commands are split to keep their index count below 0xffff, which does not matter for a draw. Merge adjacent commands
+	// with the same texture, blend mode and colors the layout leaves out, rebasing their indices onto the range's first
+	// vertex while they fit in 16 bits.
+	DrawRange *range = NULL;
+	for (; command; command = command->next) {
+		if (range && range->texture == command->texture && range->blendMode == command->blendMode &&
+			(_layout.color >= 0 || range->color == command->color) &&
+			(_layout.darkColor >= 0 || range->darkColor == command->darkColor) &&
+			command->vertexStart + command->numVertices - range->vertexStart <= 0x10000) {
+			uint16_t offset = (uint16_t) (command->vertexStart - range->vertexStart);
+			uint16_t *indices = command->indices;
+			for (int32_t i = 0; i < command->numIndices; i++)
+				indices[i] += offset;
+			range->vertexCount = command->vertexStart + command->numVertices - range->vertexStart;
+			range->indexCount += command->numIndices;
+			continue;
+		}
+		DrawRange next;
+		next.texture = command->texture;
+		next.blendMode = command->blendMode;
+		next.color = command->color;
+		next.darkColor = command->darkColor;
+		next.vertexStart = command->vertexStart;
+		next.vertexCount = command->numVertices;
+		next.indexStart = command->indexStart;
+		next.indexCount = command->numIndices;
+		_drawRanges.add(next);
+		range = &_drawRanges[_drawRanges.size() - 1];
+	}
+}
+
+const VertexLayout &SkeletonGeometry::getLayout() {
+	return _layout;
+}
+
+void *SkeletonGeometry::getVertices() {
+	return _vertices.buffer();
+}
+
+size_t SkeletonGeometry::getVertexCount() {
+	return _vertexCount;
+}
+
+uint16_t *SkeletonGeometry::getIndices() {
+	return _indices.buffer();
+}
+
+size_t SkeletonGeometry::getIndexCount() {
+	return _indexCount;
+}
+
+Vector<DrawRange> &SkeletonGeometry::getDrawRanges() {
+	return _drawRanges;
+}
+
+SkeletonRenderer &SkeletonGeometry::getRenderer() {
+	return _renderer;
+}
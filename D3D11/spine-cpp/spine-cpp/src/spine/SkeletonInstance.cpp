@@ -0,0 +1,583 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated April 5, 2025. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2025, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/SkeletonInstance.h>
+
+#include <spine/Animation.h>
+#include <spine/Bone.h>
+#include <spine/BoneData.h>
+#include <spine/DeformTimeline.h>
+#include <spine/IkConstraint.h>
+#include <spine/IkConstraintData.h>
+#include <spine/PathConstraint.h>
+#include <spine/PathConstraintData.h>
+#include <spine/PhysicsConstraint.h>
+#include <spine/PhysicsConstraintData.h>
+#include <spine/Skeleton.h>
+#include <spine/SkeletonData.h>
+#include <spine/Skin.h>
+#include <spine/Slot.h>
+#include <spine/SlotData.h>
+#include <spine/TransformConstraint.h>
+#include <spine/TransformConstraintData.h>
+
+#include <new>
+
+using namespace spine;
+
+/// Starts the pose allocation and holds the skeleton wide pose and the byte offsets of the other sections.
+struct SkeletonInstance::Header {
+	size_t size;
+	int boneCount, slotCount, ikCount, transformCount, pathCount, physicsCount;
+	size_t bones, slots, ikConstraints, transformConstraints, pathConstraints, physicsConstraints, deform;
+	Skin *skin;
+	Color color;
+	float x, y, scaleX, scaleY, time;
+};
+
+namespace {
+	struct BonePose {
+		float x, y, rotation, scaleX, scaleY, shearX, shearY;
+		Inherit inherit;
+	};
+
+	struct SlotPose {
+		Attachment *attachment;
+		Color color, darkColor;
+		int attachmentState, sequenceIndex;
+		/// The index of the slot at this position of the draw order.
+		int drawOrder;
+		int deformOffset, deformCapacity, deformSize;
+	};
+
+	struct IkPose {
+		float mix, softness;
+		int bendDirection;
+		bool compress, stretch;
+	};
+
+	struct TransformPose {
+		float mixRotate, mixX, mixY, mixScaleX, mixScaleY, mixShearY;
+	};
+
+	struct PathPose {
+		float position, spacing, mixRotate, mixX, mixY;
+	};
+
+	struct PhysicsPose {
+		float inertia, strength, damping, massInverse, wind, gravity, mix;
+		bool reset;
+		float ux, uy, cx, cy, tx, ty;
+		float xOffset, xVelocity, yOffset, yVelocity, rotateOffset, rotateVelocity, scaleOffset, scaleVelocity;
+		float remaining, lastTime;
+	};
+
+	inline size_t align(size_t size) {
+		return (size + 7) & ~(size_t) 7;
+	}
+
+	template<typename T>
+	inline T *section(char *pose, size_t offset) {
+		return reinterpret_cast<T *>(pose + offset);
+	}
+}
+
+SkeletonInstance::SkeletonInstance(SkeletonData *data) : _data(data), _pose(NULL) {
+	int slotCount = (int) data->getSlots().size();
+
+	/* Deform is only kept for slots that are keyed, with room for the largest keyed attachment. */
+	Vector<int> deformCapacity;
+	deformCapacity.setSize(slotCount, 0);
+	int deformCount = 0;
+	Vector<Animation *> &animations = data->getAnimations();
+	for (size_t i = 0; i < animations.size(); i++) {
+		Vector<Timeline *> &timelines = animations[i]->getTimelines();
+		for (size_t ii = 0; ii < timelines.size(); ii++) {
+			if (timelines[ii]->getType() != TimelineType_Deform) continue;
+			DeformTimeline *timeline = static_cast<DeformTimeline *>(timelines[ii]);
+			Vector<Vector<float> > &vertices = timeline->getVertices();
+			int count = vertices.size() > 0 ? (int) vertices[0].size() : 0;
+			int &capacity = deformCapacity[timeline->getSlotIndex()];
+			if (count > capacity) {
+				deformCount += count - capacity;
+				capacity = count;
+			}
+		}
+	}
+
+	Header header;
+	header.boneCount = (int) data->getBones().size();
+	header.slotCount = slotCount;
+	header.ikCount = (int) data->getIkConstraints().size();
+	header.transformCount = (int) data->getTransformConstraints().size();
+	header.pathCount = (int) data->getPathConstraints().size();
+	header.physicsCount = (int) data->getPhysicsConstraints().size();
+	size_t size = align(sizeof(Header));
+	header.bones = size;
+	size += align(header.boneCount * sizeof(BonePose));
+	header.slots = size;
+	size += align(header.slotCount * sizeof(SlotPose));
+	header.ikConstraints = size;
+	size += align(header.ikCount * sizeof(IkPose));
+	header.transformConstraints = size;
+	size += align(header.transformCount * sizeof(TransformPose));
+	header.pathConstraints = size;
+	size += align(header.pathCount * sizeof(PathPose));
+	header.physicsConstraints = size;
+	size += align(header.physicsCount * sizeof(PhysicsPose));
+	header.deform = size;
+	size += deformCount * sizeof(float);
+	header.size = size;
+	header.skin = NULL;
+	header.color.set(1, 1, 1, 1);
+	header.x = 0;
+	header.y = 0;
+	header.scaleX = 1;
+	header.scaleY = 1;
+	header.time = 0;
+
+	_pose = SpineExtension::alloc<char>(size, __FILE__, __LINE__);
+	new (_pose) Header(header);
+
+	SlotPose *slots = section<SlotPose>(_pose, header.slots);
+	for (int i = 0, offset = 0; i < slotCount; i++) {
+		SlotPose &slot = *new (slots + i) SlotPose();
+		slot.attachment = NULL;
+		slot.color.set(1, 1, 1, 1);
+		slot.darkColor.set(0, 0, 0, 0);
+		slot.attachmentState = 0;
+		slot.sequenceIndex = 0;
+		slot.deformOffset = offset;
+		slot.deformCapacity = deformCapacity[i];
+		slot.deformSize = 0;
+		offset += deformCapacity[i];
+	}
+
+	PhysicsPose *physics = section<PhysicsPose>(_pose, header.physicsConstraints);
+	for (int i = 0; i < header.physicsCount; i++) {
+		PhysicsPose &pose = physics[i];
+		pose.reset = true;
+		pose.ux = pose.uy = pose.cx = pose.cy = pose.tx = pose.ty = 0;
+		pose.xOffset = pose.xVelocity = pose.yOffset = pose.yVelocity = 0;
+		pose.rotateOffset = pose.rotateVelocity = pose.scaleOffset = pose.scaleVelocity = 0;
+		pose.remaining = 0;
+		pose.lastTime = 0;
+	}
+
+	setToSetupPose();
+}
+
+SkeletonInstance::SkeletonInstance(const SkeletonInstance &other) : SpineObject(), _data(other._data), _pose(NULL) {
+	size_t size = other.header().size;
+	_pose = SpineExtension::alloc<char>(size, __FILE__, __LINE__);
+	memcpy(_pose, other._pose, size);
+}
+
+SkeletonInstance::~SkeletonInstance() {
+	SpineExtension::free(_pose, __FILE__, __LINE__);
+}
+
+SkeletonInstance::Header &SkeletonInstance::header() const {
+	return *reinterpret_cast<Header *>(_pose);
+}
+
+SkeletonData *SkeletonInstance::getData() {
+	return _data;
+}
+
+void SkeletonInstance::store(Skeleton &skeleton) {
+	assert(skeleton._data == _data);
+	Header &header = this->header();
+	header.skin = skeleton._skin;
+	header.color.set(skeleton._color);
+	header.x = skeleton._x;
+	header.y = skeleton._y;
+	header.scaleX = skeleton._scaleX;
+	header.scaleY = skeleton._scaleY;
+	header.time = skeleton._time;
+
+	BonePose *bones = section<BonePose>(_pose, header.bones);
+	for (int i = 0; i < header.boneCount; i++) {
+		Bone &bone = *skeleton._bones[i];
+		BonePose &pose = bones[i];
+		pose.x = bone._x;
+		pose.y = bone._y;
+		pose.rotation = bone._rotation;
+		pose.scaleX = bone._scaleX;
+		pose.scaleY = bone._scaleY;
+		pose.shearX = bone._shearX;
+		pose.shearY = bone._shearY;
+		pose.inherit = bone._inherit;
+	}
+
+	SlotPose *slots = section<SlotPose>(_pose, header.slots);
+	float *deform = section<float>(_pose, header.deform);
+	for (int i = 0; i < header.slotCount; i++) {
+		Slot &slot = *skeleton._slots[i];
+		SlotPose &pose = slots[i];
+		pose.attachment = slot._attachment;
+		pose.color.set(slot._color);
+		pose.darkColor.set(slot._darkColor);
+		pose.attachmentState = slot._attachmentState;
+		pose.sequenceIndex = slot._sequenceIndex;
+		pose.drawOrder = skeleton._drawOrder[i]->_data.getIndex();
+		int size = (int) slot._deform.size();
+		pose.deformSize = size <= pose.deformCapacity ? size : 0;
+		if (pose.deformSize > 0) memcpy(deform + pose.deformOffset, slot._deform.buffer(), size * sizeof(float));
+	}
+
+	IkPose *ikConstraints = section<IkPose>(_pose, header.ikConstraints);
+	for (int i = 0; i < header.ikCount; i++) {
+		IkConstraint &constraint = *skeleton._ikConstraints[i];
+		IkPose &pose = ikConstraints[i];
+		pose.mix = constraint._mix;
+		pose.softness = constraint._softness;
+		pose.bendDirection = constraint._bendDirection;
+		pose.compress = constraint._compress;
+		pose.stretch = constraint._stretch;
+	}
+
+	TransformPose *transformConstraints = section<TransformPose>(_pose, header.transformConstraints);
+	for (int i = 0; i < header.transformCount; i++) {
+		TransformConstraint &constraint = *skeleton._transformConstraints[i];
+		TransformPose &pose = transformConstraints[i];
+		pose.mixRotate = constraint._mixRotate;
+		pose.mixX = constraint._mixX;
+		pose.mixY = constraint._mixY;
+		pose.mixScaleX = constraint._mixScaleX;
+		pose.mixScaleY = constraint._mixScaleY;
+		pose.mixShearY = constraint._mixShearY;
+	}
+
+	PathPose *pathConstraints = section<PathPose>(_pose, header.pathConstraints);
+	for (int i = 0; i < header.pathCount; i++) {
+		PathConstraint &constraint = *skeleton._pathConstraints[i];
+		PathPose &pose = pathConstraints[i];
+		pose.position = constraint._position;
+		pose.spacing = constraint._spacing;
+		pose.mixRotate = constraint._mixRotate;
+		pose.mixX = constraint._mixX;
+		pose.mixY = constraint._mixY;
+	}
+
+	PhysicsPose *physicsConstraints = section<PhysicsPose>(_pose, header.physicsConstraints);
+	for (int i = 0; i < header.physicsCount; i++) {
+		PhysicsConstraint &constraint = *skeleton._physicsConstraints[i];
+		PhysicsPose &pose = physicsConstraints[i];
+		pose.inertia = constraint._inertia;
+		pose.strength = constraint._strength;
+		pose.damping = constraint._damping;
+		pose.massInverse = constraint._massInverse;
+		pose.wind = constraint._wind;
+		pose.gravity = constraint._gravity;
+		pose.mix = constraint._mix;
+		pose.reset = constraint._reset;
+		pose.ux = constraint._ux;
+		pose.uy = constraint._uy;
+		pose.cx = constraint._cx;
+		pose.cy = constraint._cy;
+		pose.tx = constraint._tx;
+		pose.ty = constraint._ty;
+		pose.xOffset = constraint._xOffset;
+		pose.xVelocity = constraint._xVelocity;
+		pose.yOffset = constraint._yOffset;
+		pose.yVelocity = constraint._yVelocity;
+		pose.rotateOffset = constraint._rotateOffset;
+		pose.rotateVelocity = constraint._rotateVelocity;
+		pose.scaleOffset = constraint._scaleOffset;
+		pose.scaleVelocity = constraint._scaleVelocity;
+		pose.remaining = constraint._remaining;
+		pose.lastTime = constraint._lastTime;
+	}
+}
+
+void SkeletonInstance::load(Skeleton &skeleton) {
+	assert(skeleton._data == _data);
+	Header &header = this->header();
+	if (skeleton._skin != header.skin) {
+		skeleton._skin = header.skin;
+		skeleton.updateCache();
+	}
+	skeleton._color.set(header.color);
+	skeleton._x = header.x;
+	skeleton._y = header.y;
+	skeleton._scaleX = header.scaleX;
+	skeleton._scaleY = header.scaleY;
+	skeleton._time = header.time;
+
+	BonePose *bones = section<BonePose>(_pose, header.bones);
+	for (int i = 0; i < header.boneCount; i++) {
+		Bone &bone = *skeleton._bones[i];
+		BonePose &pose = bones[i];
+		bone._x = pose.x;
+		bone._y = pose.y;
+		bone._rotation = pose.rotation;
+		bone._scaleX = pose.scaleX;
+		bone._scaleY = pose.scaleY;
+		bone._shearX = pose.shearX;
+		bone._shearY = pose.shearY;
+		bone.setInherit(pose.inherit);
+	}
+
+	SlotPose *slots = section<SlotPose>(_pose, header.slots);
+	float *deform = section<float>(_pose, header.deform);
+	for (int i = 0; i < header.slotCount; i++) {
+		Slot &slot = *skeleton._slots[i];
+		SlotPose &pose = slots[i];
+		slot._attachment = pose.attachment;
+		slot._color.set(pose.color);
+		slot._darkColor.set(pose.darkColor);
+		slot._attachmentState = pose.attachmentState;
+		slot._sequenceIndex = pose.sequenceIndex;
+		skeleton._drawOrder[i] = skeleton._slots[pose.drawOrder];
+		slot._deform.setSize(pose.deformSize, 0);
+		if (pose.deformSize > 0) memcpy(slot._deform.buffer(), deform + pose.deformOffset, pose.deformSize * sizeof(float));
+	}
+
+	IkPose *ikConstraints = section<IkPose>(_pose, header.ikConstraints);
+	for (int i = 0; i < header.ikCount; i++) {
+		IkConstraint &constraint = *skeleton._ikConstraints[i];
+		IkPose &pose = ikConstraints[i];
+		constraint._mix = pose.mix;
+		constraint._softness = pose.softness;
+		constraint._bendDirection = pose.bendDirection;
+		constraint._compress = pose.compress;
+		constraint._stretch = pose.stretch;
+	}
+
+	TransformPose *transformConstraints = section<TransformPose>(_pose, header.transformConstraints);
+	for (int i = 0; i < header.transformCount; i++) {
+		TransformConstraint &constraint = *skeleton._transformConstraints[i];
+		TransformPose &pose = transformConstraints[i];
+		constraint._mixRotate = pose.mixRotate;
+		constraint._mixX = pose.mixX;
+		constraint._mixY = pose.mixY;
+		constraint._mixScaleX = pose.mixScaleX;
+		constraint._mixScaleY = pose.mixScaleY;
+		constraint._mixShearY = pose.mixShearY;
+	}
+
+	PathPose *pathConstraints = section<PathPose>(_pose, header.pathConstraints);
+	for (int i = 0; i < header.pathCount; i++) {
+		PathConstraint &constraint = *skeleton._pathConstraints[i];
+		PathPose &pose = pathConstraints[i];
+		constraint._position = pose.position;
+		constraint._spacing = pose.spacing;
+		constraint._mixRotate = pose.mixRotate;
+		constraint._mixX = pose.mixX;
+		constraint._mixY = pose.mixY;
+	}
+
+	PhysicsPose *physicsConstraints = section<PhysicsPose>(_pose, header.physicsConstraints);
+	for (int i = 0; i < header.physicsCount; i++) {
+		PhysicsConstraint &constraint = *skeleton._physicsConstraints[i];
+		PhysicsPose &pose = physicsConstraints[i];
+		constraint._inertia = pose.inertia;
+		constraint._strength = pose.strength;
+		constraint._damping = pose.damping;
+		constraint._massInverse = pose.massInverse;
+		constraint._wind = pose.wind;
+		constraint._gravity = pose.gravity;
+		constraint._mix = pose.mix;
+		constraint._reset = pose.reset;
+		constraint._ux = pose.ux;
+		constraint._uy = pose.uy;
+		constraint._cx = pose.cx;
+		constraint._cy = pose.cy;
+		constraint._tx = pose.tx;
+		constraint._ty = pose.ty;
+		constraint._xOffset = pose.xOffset;
+		constraint._xVelocity = pose.xVelocity;
+		constraint._yOffset = pose.yOffset;
+		constraint._yVelocity = pose.yVelocity;
+		constraint._rotateOffset = pose.rotateOffset;
+		constraint._rotateVelocity = pose.rotateVelocity;
+		constraint._scaleOffset = pose.scaleOffset;
+		constraint._scaleVelocity = pose.scaleVelocity;
+		constraint._remaining = pose.remaining;
+		constraint._lastTime = pose.lastTime;
+	}
+}
+
+void SkeletonInstance::setToSetupPose() {
+	Header &header = this->header();
+
+	BonePose *bones = section<BonePose>(_pose, header.bones);
+	Vector<BoneData *> &boneData = _data->getBones();
+	for (int i = 0; i < header.boneCount; i++) {
+		BoneData &data = *boneData[i];
+		BonePose &pose = bones[i];
+		pose.x = data.getX();
+		pose.y = data.getY();
+		pose.rotation = data.getRotation();
+		pose.scaleX = data.getScaleX();
+		pose.scaleY = data.getScaleY();
+		pose.shearX = data.getShearX();
+		pose.shearY = data.getShearY();
+		pose.inherit = data.getInherit();
+	}
+
+	SlotPose *slots = section<SlotPose>(_pose, header.slots);
+	Vector<SlotData *> &slotData = _data->getSlots();
+	Skin *defaultSkin = _data->getDefaultSkin();
+	for (int i = 0; i < header.slotCount; i++) {
+		SlotData &data = *slotData[i];
+		SlotPose &pose = slots[i];
+		pose.color.set(data.getColor());
+		if (data.hasDarkColor()) pose.darkColor.set(data.getDarkColor());
+		pose.drawOrder = i;
+
+		/* As Slot::setToSetupPose(), which resets the sequence index and deform whenever the setup attachment is found, even
+		 * if it is already set. */
+		const String &attachmentName = data.getAttachmentName();
+		if (attachmentName.length() > 0) {
+			Attachment *attachment = NULL;
+			if (header.skin) attachment = header.skin->getAttachment(i, attachmentName);
+			if (!attachment && defaultSkin) attachment = defaultSkin->getAttachment(i, attachmentName);
+			pose.attachment = attachment;
+			if (attachment) {
+				pose.sequenceIndex = -1;
+				pose.deformSize = 0;
+			}
+		} else if (pose.attachment) {
+			pose.attachment = NULL;
+			pose.sequenceIndex = -1;
+			pose.deformSize = 0;
+		}
+	}
+
+	IkPose *ikConstraints = section<IkPose>(_pose, header.ikConstraints);
+	for (int i = 0; i < header.ikCount; i++) {
+		IkConstraintData &data = *_data->getIkConstraints()[i];
+		IkPose &pose = ikConstraints[i];
+		pose.mix = data.getMix();
+		pose.softness = data.getSoftness();
+		pose.bendDirection = data.getBendDirection();
+		pose.compress = data.getCompress();
+		pose.stretch = data.getStretch();
+	}
+
+	TransformPose *transformConstraints = section<TransformPose>(_pose, header.transformConstraints);
+	for (int i = 0; i < header.transformCount; i++) {
+		TransformConstraintData &data = *_data->getTransformConstraints()[i];
+		TransformPose &pose = transformConstraints[i];
+		pose.mixRotate = data.getMixRotate();
+		pose.mixX = data.getMixX();
+		pose.mixY = data.getMixY();
+		pose.mixScaleX = data.getMixScaleX();
+		pose.mixScaleY = data.getMixScaleY();
+		pose.mixShearY = data.getMixShearY();
+	}
+
+	PathPose *pathConstraints = section<PathPose>(_pose, header.pathConstraints);
+	for (int i = 0; i < header.pathCount; i++) {
+		PathConstraintData &data = *_data->getPathConstraints()[i];
+		PathPose &pose = pathConstraints[i];
+		pose.position = data.getPosition();
+		pose.spacing = data.getSpacing();
+		pose.mixRotate = data.getMixRotate();
+		pose.mixX = data.getMixX();
+		pose.mixY = data.getMixY();
+	}
+
+	PhysicsPose *physicsConstraints = section<PhysicsPose>(_pose, header.physicsConstraints);
+	for (int i = 0; i < header.physicsCount; i++) {
+		PhysicsConstraintData &data = *_data->getPhysicsConstraints()[i];
+		PhysicsPose &pose = physicsConstraints[i];
+		pose.inertia = data.getInertia();
+		pose.strength = data.getStrength();
+		pose.damping = data.getDamping();
+		pose.massInverse = data.getMassInverse();
+		pose.wind = data.getWind();
+		pose.gravity = data.getGravity();
+		pose.mix = data.getMix();
+	}
+}
+
+Skin *SkeletonInstance::getSkin() {
+	return header().skin;
+}
+
+void SkeletonInstance::setSkin(Skin *skin) {
+	header().skin = skin;
+}
+
+float SkeletonInstance::getX() {
+	return header().x;
+}
+
+void SkeletonInstance::setX(float inValue) {
+	header().x = inValue;
+}
+
+float SkeletonInstance::getY() {
+	return header().y;
+}
+
+void SkeletonInstance::setY(float inValue) {
+	header().y = inValue;
+}
+
+void SkeletonInstance::setPosition(float x, float y) {
+	Header &header = this->header();
+	header.x = x;
+	header.y = y;
+}
+
+float SkeletonInstance::getScaleX() {
+	return header().scaleX;
+}
+
+void SkeletonInstance::setScaleX(float inValue) {
+	header().scaleX = inValue;
+}
+
+float SkeletonInstance::getScaleY() {
+	return header().scaleY;
+}
+
+void SkeletonInstance::setScaleY(float inValue) {
+	header().scaleY = inValue;
+}
+
+Color &SkeletonInstance::getColor() {
+	return header().color;
+}
+
+float SkeletonInstance::getTime() {
+	return header().time;
+}
+
+void SkeletonInstance::setTime(float time) {
+	header().time = time;
+}
+
+size_t SkeletonInstance::getSize() {
+	return header().size;
+}
@@ -119,20 +119,30 @@ SkeletonJson::~SkeletonJson() {
 SkeletonData *SkeletonJson::readSkeletonDataFile(const String &path) {
 	int length;
 	SkeletonData *skeletonData;
-	const char *json = SpineExtension::readFile(path, &length);
+	const char *json = SpineExtension::mapFile(path, &length);
+	bool mapped = json != NULL;
+	if (!mapped) json = SpineExtension::readFile(path, &length);
 	if (length == 0 || !json) {
+		if (json) SpineExtension::free(json, __FILE__, __LINE__);
 		setError(NULL, "Unable to read skeleton file: ", path);
 		return NULL;
 	}
 
-	skeletonData = readSkeletonData(json);
+	skeletonData = readSkeletonData(json, length);
 
-	SpineExtension::free(json, __FILE__, __LINE__);
+	if (mapped)
+		SpineExtension::unmapFile(json, length);
+	else
+		SpineExtension::free(json, __FILE__, __LINE__);
 
 	return skeletonData;
 }
 
 SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
+	return readSkeletonData(json, (int) strlen(json));
+}
+
+SkeletonData *SkeletonJson::readSkeletonData(const char *json, int length) {
 	int i, ii;
 	SkeletonData *skeletonData;
 	Json *root, *skeleton, *bones, *boneMap, *ik, *transform, *path, *physics, *slots, *skins, *animations, *events;
@@ -140,7 +150,7 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 	_error = "";
 	_linkedMeshes.clear();
 
-	root = new (__FILE__, __LINE__) Json(json);
+	root = new (__FILE__, __LINE__) Json(json, length);
 
 	if (!root) {
 		setError(NULL, "Invalid skeleton JSON: ", Json::getError());
@@ -774,6 +784,8 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 								_attachmentLoader->configureAttachment(attachment);
 								break;
 							}
+							default:
+								break;
 						}
 
 						skin->setAttachment(slot->getIndex(), skinAttachmentName, attachment);
@@ -850,6 +862,8 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 
 	delete root;
 
+	skeletonData->buildNameIndex();
+	skeletonData->buildSkinningLayouts();
 	return skeletonData;
 }
 
@@ -35,10 +35,13 @@
 #include <spine/MeshAttachment.h>
 #include <spine/ClippingAttachment.h>
 #include <spine/Bone.h>
+#include <spine/Sequence.h>
 
 using namespace spine;
 
-SkeletonRenderer::SkeletonRenderer() : _allocator(4096), _worldVertices(), _quadIndices(), _clipping(), _renderCommands() {
+SkeletonRenderer::SkeletonRenderer() : _allocator(4096), _worldVertices(), _quadIndices(), _clipping(), _renderCommands(),
+										 _indices(), _indices32(), _vertexCount(0), _indexCount(0), _drawCallCount(0),
+										 _maxBatchVertices(0) {
 	_quadIndices.add(0);
 	_quadIndices.add(1);
 	_quadIndices.add(2);
@@ -50,6 +53,17 @@ SkeletonRenderer::SkeletonRenderer() : _allocator(4096), _worldVertices(), _quad
 SkeletonRenderer::~SkeletonRenderer() {
 }
 
+void SkeletonRenderer::reserve(size_t vertexCount, size_t indexCount, size_t slotCount, size_t clipVertexCount) {
+	// Each command is allocated once per slot and once more when batched, each array padded to 16 bytes.
+	size_t vertexBytes = vertexCount * (sizeof(float) * 4 + sizeof(uint32_t) * 2) + indexCount * sizeof(uint16_t);
+	size_t commandBytes = sizeof(RenderCommand) + 5 * 16;
+	_allocator.reserve((int) (2 * (vertexBytes + slotCount * commandBytes)));
+	_worldVertices.ensureCapacity(vertexCount << 1);
+	_clipping.reserve(vertexCount, indexCount, clipVertexCount);
+	_renderCommands.ensureCapacity(slotCount);
+	_indices.ensureCapacity(indexCount);
+}
+
 static RenderCommand *createRenderCommand(BlockAllocator &allocator, int numVertices, int32_t numIndices, BlendMode blendMode, void *texture) {
 	RenderCommand *cmd = allocator.allocate<RenderCommand>(1);
 	cmd->positions = allocator.allocate<float>(numVertices << 1);
@@ -62,6 +76,12 @@ static RenderCommand *createRenderCommand(BlockAllocator &allocator, int numVert
 	cmd->blendMode = blendMode;
 	cmd->texture = texture;
 	cmd->next = nullptr;
+	cmd->vertices = nullptr;
+	cmd->vertexStart = 0;
+	cmd->indexStart = 0;
+	cmd->indices32 = nullptr;
+	cmd->color = 0;
+	cmd->darkColor = 0;
 	return cmd;
 }
 
@@ -151,7 +171,7 @@ RenderCommand *SkeletonRenderer::render(Skeleton &skeleton) {
 		}
 
 		// Early out if the slot color is 0 or the bone is not active
-		if ((slot.getColor().a == 0 || !slot.getBone().isActive()) && !attachment->getRTTI().isExactly(ClippingAttachment::rtti)) {
+		if ((slot.getColor().a == 0 || !slot.getBone().isActive()) && attachment->getType() != AttachmentType_Clipping) {
 			clipper.clipEnd(slot);
 			continue;
 		}
@@ -166,7 +186,7 @@ RenderCommand *SkeletonRenderer::render(Skeleton &skeleton) {
 		Color *attachmentColor;
 		void *texture;
 
-		if (attachment->getRTTI().isExactly(RegionAttachment::rtti)) {
+		if (attachment->getType() == AttachmentType_Region) {
 			RegionAttachment *regionAttachment = (RegionAttachment *) attachment;
 			attachmentColor = &regionAttachment->getColor();
 
@@ -184,7 +204,7 @@ RenderCommand *SkeletonRenderer::render(Skeleton &skeleton) {
 			indicesCount = 6;
 			texture = regionAttachment->getRegion()->rendererObject;
 
-		} else if (attachment->getRTTI().isExactly(MeshAttachment::rtti)) {
+		} else if (attachment->getType() == AttachmentType_Mesh) {
 			MeshAttachment *mesh = (MeshAttachment *) attachment;
 			attachmentColor = &mesh->getColor();
 
@@ -202,7 +222,7 @@ RenderCommand *SkeletonRenderer::render(Skeleton &skeleton) {
 			indicesCount = (int32_t) indices->size();
 			texture = mesh->getRegion()->rendererObject;
 
-		} else if (attachment->getRTTI().isExactly(ClippingAttachment::rtti)) {
+		} else if (attachment->getType() == AttachmentType_Clipping) {
 			ClippingAttachment *clip = (ClippingAttachment *) slot.getAttachment();
 			clipper.clipStart(slot, clip);
 			continue;
@@ -244,3 +264,270 @@ RenderCommand *SkeletonRenderer::render(Skeleton &skeleton) {
 
 	return batchCommands(_allocator, _renderCommands);
 }
+
+size_t SkeletonRenderer::getVertexCount() {
+	return _vertexCount;
+}
+
+size_t SkeletonRenderer::getIndexCount() {
+	return _indexCount;
+}
+
+size_t SkeletonRenderer::getDrawCallCount() {
+	return _drawCallCount;
+}
+
+size_t SkeletonRenderer::getMaxBatchVertices() {
+	return _maxBatchVertices;
+}
+
+static uint32_t toColorFormat(uint32_t color, VertexColorFormat format) {
+	if (format == VertexColorFormat_ABGR) return (color & 0xff00ff00) | ((color >> 16) & 0xff) | ((color & 0xff) << 16);
+	return color;
+}
+
+static void writeVertices(const VertexLayout &layout, uint8_t *vertices, const float *positions, const float *uvs, int32_t count,
+						  uint32_t color, uint32_t darkColor) {
+	color = toColorFormat(color, layout.colorFormat);
+	darkColor = toColorFormat(darkColor, layout.colorFormat);
+	for (int32_t i = 0; i < count; i++, vertices += layout.stride, uvs += 2) {
+		if (positions) {
+			float *position = (float *) (vertices + layout.position);
+			position[0] = positions[i << 1];
+			position[1] = positions[(i << 1) + 1];
+		}
+		float *uv = (float *) (vertices + layout.uv);
+		uv[0] = uvs[0];
+		uv[1] = uvs[1];
+		if (layout.color >= 0) *(uint32_t *) (vertices + layout.color) = color;
+		if (layout.darkColor >= 0) *(uint32_t *) (vertices + layout.darkColor) = darkColor;
+	}
+}
+
+RenderCommand *SkeletonRenderer::render(Skeleton &skeleton, const VertexLayout &layout, void *vertices, size_t vertexCapacity,
+										uint16_t *indices, size_t indexCapacity) {
+	RenderInstance instance(skeleton);
+	return renderInterleaved(&instance, 1, layout, vertices, vertexCapacity, indices, indexCapacity, false);
+}
+
+RenderCommand *SkeletonRenderer::render(const RenderInstance *instances, size_t count, const VertexLayout &layout, void *vertices,
+										size_t vertexCapacity, uint16_t *indices, size_t indexCapacity) {
+	return renderInterleaved(instances, count, layout, vertices, vertexCapacity, indices, indexCapacity, false);
+}
+
+RenderCommand *SkeletonRenderer::render(const RenderInstance *instances, size_t count, const VertexLayout &layout, void *vertices,
+										size_t vertexCapacity, uint32_t *indices, size_t indexCapacity) {
+	return renderInterleaved(instances, count, layout, vertices, vertexCapacity, indices, indexCapacity, true);
+}
+
+RenderCommand *SkeletonRenderer::renderInterleaved(const RenderInstance *instances, size_t count, const VertexLayout &layout,
+												   void *vertices, size_t vertexCapacity, void *indices, size_t indexCapacity,
+												   bool wideIndices) {
+	_allocator.compress();
+	_renderCommands.clear();
+	_indices.clear();
+	_indices32.clear();
+	_vertexCount = 0;
+	_indexCount = 0;
+	_drawCallCount = 0;
+	_maxBatchVertices = 0;
+
+	SkeletonClipping &clipper = _clipping;
+	uint8_t *vertexBuffer = (uint8_t *) vertices;
+	bool fits = true;
+	RenderCommand *last = NULL;
+	uint32_t lastColor = 0, lastDarkColor = 0;
+	size_t positionStride = layout.stride / sizeof(float);
+
+	for (size_t n = 0; n < count; n++) {
+		const RenderInstance &instance = instances[n];
+		Skeleton &skeleton = *instance.skeleton;
+		bool transformed = instance.a != 1 || instance.b != 0 || instance.c != 0 || instance.d != 1 || instance.x != 0 ||
+						   instance.y != 0;
+
+		for (unsigned i = 0; i < skeleton.getSlots().size(); ++i) {
+			Slot &slot = *skeleton.getDrawOrder()[i];
+			Attachment *attachment = slot.getAttachment();
+			if (!attachment) {
+				clipper.clipEnd(slot);
+				continue;
+			}
+
+			// Early out if the slot color is 0 or the bone is not active
+			if ((slot.getColor().a == 0 || !slot.getBone().isActive()) && attachment->getType() != AttachmentType_Clipping) {
+				clipper.clipEnd(slot);
+				continue;
+			}
+
+			RegionAttachment *regionAttachment = NULL;
+			MeshAttachment *mesh = NULL;
+			int32_t verticesCount;
+			Vector<float> *uvs;
+			Vector<unsigned short> *triangles;
+			Color *attachmentColor;
+			void *texture;
+
+			if (attachment->getType() == AttachmentType_Region) {
+				regionAttachment = (RegionAttachment *) attachment;
+				attachmentColor = &regionAttachment->getColor();
+				if (attachmentColor->a == 0) {
+					clipper.clipEnd(slot);
+					continue;
+				}
+				// Computing world vertices applies the sequence, but the texture and uvs are needed before that.
+				if (regionAttachment->getSequence()) regionAttachment->getSequence()->apply(&slot, regionAttachment);
+				verticesCount = 4;
+				uvs = &regionAttachment->getUVs();
+				triangles = &_quadIndices;
+				texture = regionAttachment->getRegion()->rendererObject;
+			} else if (attachment->getType() == AttachmentType_Mesh) {
+				mesh = (MeshAttachment *) attachment;
+				attachmentColor = &mesh->getColor();
+				if (attachmentColor->a == 0) {
+					clipper.clipEnd(slot);
+					continue;
+				}
+				if (mesh->getSequence()) mesh->getSequence()->apply(&slot, mesh);
+				verticesCount = (int32_t) (mesh->getWorldVerticesLength() >> 1);
+				uvs = &mesh->getUVs();
+				triangles = &mesh->getTriangles();
+				texture = mesh->getRegion()->rendererObject;
+			} else if (attachment->getType() == AttachmentType_Clipping) {
+				ClippingAttachment *clip = (ClippingAttachment *) slot.getAttachment();
+				clipper.clipStart(slot, clip);
+				continue;
+			} else
+				continue;
+
+			uint8_t r = static_cast<uint8_t>(skeleton.getColor().r * slot.getColor().r * attachmentColor->r * 255);
+			uint8_t g = static_cast<uint8_t>(skeleton.getColor().g * slot.getColor().g * attachmentColor->g * 255);
+			uint8_t b = static_cast<uint8_t>(skeleton.getColor().b * slot.getColor().b * attachmentColor->b * 255);
+			uint8_t a = static_cast<uint8_t>(skeleton.getColor().a * slot.getColor().a * attachmentColor->a * 255);
+			uint32_t color = (a << 24) | (r << 16) | (g << 8) | b;
+			uint32_t darkColor = 0xff000000;
+			if (slot.hasDarkColor()) {
+				Color &slotDarkColor = slot.getDarkColor();
+				darkColor = 0xff000000 | (static_cast<uint8_t>(slotDarkColor.r * 255) << 16) | (static_cast<uint8_t>(slotDarkColor.g * 255) << 8) | static_cast<uint8_t>(slotDarkColor.b * 255);
+			}
+
+			// Clipped vertices are computed up front to know their count. Others are written to the vertex buffer below.
+			const float *positions = NULL;
+			int32_t indicesCount = (int32_t) triangles->size();
+			if (clipper.isClipping()) {
+				if (regionAttachment) {
+					_worldVertices.setSize(8, 0);
+					regionAttachment->computeWorldVertices(slot, _worldVertices, 0, 2);
+				} else {
+					_worldVertices.setSize(mesh->getWorldVerticesLength(), 0);
+					mesh->computeWorldVertices(slot, 0, mesh->getWorldVerticesLength(), _worldVertices.buffer(), 0, 2);
+				}
+				clipper.clipTriangles(_worldVertices, *triangles, *uvs, 2);
+				positions = clipper.getClippedVertices().buffer();
+				verticesCount = (int32_t) (clipper.getClippedVertices().size() >> 1);
+				uvs = &clipper.getClippedUVs();
+				triangles = &clipper.getClippedTriangles();
+				indicesCount = (int32_t) triangles->size();
+			}
+			if (verticesCount == 0 && indicesCount == 0) {
+				clipper.clipEnd(slot);
+				continue;
+			}
+
+			size_t vertexStart = _vertexCount, indexStart = _indexCount;
+			_vertexCount += verticesCount;
+			_indexCount += indicesCount;
+			if (_vertexCount > vertexCapacity || (indices && _indexCount > indexCapacity)) fits = false;
+			if (!fits) {
+				clipper.clipEnd(slot);
+				continue;
+			}
+
+			// Colors only split commands when the layout leaves them out, the backend sets them per command from its color.
+			BlendMode blendMode = slot.getData().getBlendMode();
+			if (!last || last->texture != texture || last->blendMode != blendMode ||
+				(layout.color < 0 && lastColor != color) || (layout.darkColor < 0 && lastDarkColor != darkColor) ||
+				(!wideIndices && (last->numIndices + indicesCount >= 0xffff || last->numVertices + verticesCount > 0xffff))) {
+				RenderCommand *cmd = _allocator.allocate<RenderCommand>(1);
+				cmd->positions = NULL;
+				cmd->uvs = NULL;
+				cmd->colors = NULL;
+				cmd->darkColors = NULL;
+				cmd->numVertices = 0;
+				cmd->indices = NULL;
+				cmd->numIndices = 0;
+				cmd->blendMode = blendMode;
+				cmd->texture = texture;
+				cmd->next = NULL;
+				cmd->vertices = vertexBuffer + vertexStart * layout.stride;
+				cmd->vertexStart = (int32_t) vertexStart;
+				cmd->indexStart = (int32_t) indexStart;
+				cmd->indices32 = NULL;
+				cmd->color = toColorFormat(color, layout.colorFormat);
+				cmd->darkColor = toColorFormat(darkColor, layout.colorFormat);
+				_renderCommands.add(cmd);
+				if (last) last->next = cmd;
+				last = cmd;
+				lastColor = color;
+				lastDarkColor = darkColor;
+			}
+
+			uint8_t *slotVertices = vertexBuffer + vertexStart * layout.stride;
+			float *worldVertices = (float *) (slotVertices + layout.position);
+			if (!positions) {
+				if (regionAttachment)
+					regionAttachment->computeWorldVertices(slot, worldVertices, 0, positionStride);
+				else
+					mesh->computeWorldVertices(slot, 0, mesh->getWorldVerticesLength(), worldVertices, 0, positionStride);
+			}
+			writeVertices(layout, slotVertices, positions, uvs->buffer(), verticesCount, color, darkColor);
+			if (transformed) {
+				for (int32_t ii = 0; ii < verticesCount; ii++, worldVertices += positionStride) {
+					float x = worldVertices[0], y = worldVertices[1];
+					worldVertices[0] = instance.a * x + instance.b * y + instance.x;
+					worldVertices[1] = instance.c * x + instance.d * y + instance.y;
+				}
+			}
+
+			const unsigned short *source = triangles->buffer();
+			if (wideIndices) {
+				uint32_t *slotIndices;
+				if (indices)
+					slotIndices = (uint32_t *) indices + indexStart;
+				else {
+					_indices32.setSize(_indexCount, 0);
+					slotIndices = _indices32.buffer() + indexStart;
+				}
+				uint32_t base = (uint32_t) (last->numVertices);
+				for (int32_t ii = 0; ii < indicesCount; ii++)
+					slotIndices[ii] = source[ii] + base;
+			} else {
+				uint16_t *slotIndices;
+				if (indices)
+					slotIndices = (uint16_t *) indices + indexStart;
+				else {
+					_indices.setSize(_indexCount, 0);
+					slotIndices = _indices.buffer() + indexStart;
+				}
+				uint16_t base = (uint16_t) (last->numVertices);
+				for (int32_t ii = 0; ii < indicesCount; ii++)
+					slotIndices[ii] = source[ii] + base;
+			}
+			last->numVertices += verticesCount;
+			last->numIndices += indicesCount;
+			clipper.clipEnd(slot);
+		}
+		clipper.clipEnd();
+	}
+
+	if (!fits) return NULL;
+	for (size_t i = 0, n = _renderCommands.size(); i < n; i++) {
+		RenderCommand *cmd = _renderCommands[i];
+		if (wideIndices)
+			cmd->indices32 = (indices ? (uint32_t *) indices : _indices32.buffer()) + cmd->indexStart;
+		else
+			cmd->indices = (indices ? (uint16_t *) indices : _indices.buffer()) + cmd->indexStart;
+		if ((size_t) cmd->numVertices > _maxBatchVertices) _maxBatchVertices = cmd->numVertices;
+	}
+	_drawCallCount = _renderCommands.size();
+	return _renderCommands.size() > 0 ? _renderCommands[0] : NULL;
+}
@@ -178,7 +178,7 @@ void Skin::copySkin(Skin *other) {
 	AttachmentMap::Entries entries = other->getAttachments();
 	while (entries.hasNext()) {
 		AttachmentMap::Entry &entry = entries.next();
-		if (entry._attachment->getRTTI().isExactly(MeshAttachment::rtti))
+		if (entry._attachment->getType() == AttachmentType_Mesh)
 			setAttachment(entry._slotIndex, entry._name,
 						  static_cast<MeshAttachment *>(entry._attachment)->newLinkedMesh());
 		else
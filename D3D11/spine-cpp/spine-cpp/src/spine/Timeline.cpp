@@ -36,7 +36,7 @@ namespace spine {
 	RTTI_IMPL_NOPARENT(Timeline)
 
 	Timeline::Timeline(size_t frameCount, size_t frameEntries)
-		: _propertyIds(), _frames(), _frameEntries(frameEntries) {
+		: _propertyIds(), _frames(), _frameEntries(frameEntries), _type(TimelineType_Custom) {
 		_frames.setSize(frameCount * frameEntries, 0);
 	}
 
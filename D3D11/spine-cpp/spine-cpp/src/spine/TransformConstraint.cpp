@@ -166,7 +166,8 @@ void TransformConstraint::applyAbsoluteWorld() {
 				r += MathUtil::Pi_2;
 
 			r *= mixRotate;
-			float cos = MathUtil::cos(r), sin = MathUtil::sin(r);
+			float cos, sin;
+			MathUtil::sinCos(r, sin, cos);
 			bone._a = cos * a - sin * c;
 			bone._b = cos * b - sin * d;
 			bone._c = sin * a + cos * c;
@@ -233,7 +234,8 @@ void TransformConstraint::applyRelativeWorld() {
 				r += MathUtil::Pi_2;
 
 			r *= mixRotate;
-			float cos = MathUtil::cos(r), sin = MathUtil::sin(r);
+			float cos, sin;
+			MathUtil::sinCos(r, sin, cos);
 			bone._a = cos * a - sin * c;
 			bone._b = cos * b - sin * d;
 			bone._c = sin * a + cos * c;
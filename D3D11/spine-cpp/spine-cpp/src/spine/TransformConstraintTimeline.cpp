@@ -49,6 +49,7 @@ TransformConstraintTimeline::TransformConstraintTimeline(size_t frameCount, size
 																									   bezierCount),
 																						 _constraintIndex(
 																								 transformConstraintIndex) {
+	_type = TimelineType_TransformConstraint;
 	PropertyId ids[] = {((PropertyId) Property_TransformConstraint << 32) | transformConstraintIndex};
 	setPropertyIds(ids, 1);
 }
@@ -44,6 +44,7 @@ RTTI_IMPL(TranslateTimeline, CurveTimeline2)
 TranslateTimeline::TranslateTimeline(size_t frameCount, size_t bezierCount, int boneIndex) : CurveTimeline2(frameCount,
 																											bezierCount),
 																							 _boneIndex(boneIndex) {
+	_type = TimelineType_Translate;
 	PropertyId ids[] = {((PropertyId) Property_X << 32) | boneIndex,
 						((PropertyId) Property_Y << 32) | boneIndex};
 	setPropertyIds(ids, 2);
@@ -122,6 +123,7 @@ RTTI_IMPL(TranslateXTimeline, CurveTimeline1)
 TranslateXTimeline::TranslateXTimeline(size_t frameCount, size_t bezierCount, int boneIndex) : CurveTimeline1(
 																									   frameCount, bezierCount),
 																							   _boneIndex(boneIndex) {
+	_type = TimelineType_TranslateX;
 	PropertyId ids[] = {((PropertyId) Property_X << 32) | boneIndex};
 	setPropertyIds(ids, 1);
 }
@@ -144,6 +146,7 @@ RTTI_IMPL(TranslateYTimeline, CurveTimeline1)
 TranslateYTimeline::TranslateYTimeline(size_t frameCount, size_t bezierCount, int boneIndex) : CurveTimeline1(
 																									   frameCount, bezierCount),
 																							   _boneIndex(boneIndex) {
+	_type = TimelineType_TranslateY;
 	PropertyId ids[] = {((PropertyId) Property_Y << 32) | boneIndex};
 	setPropertyIds(ids, 1);
 }
@@ -38,6 +38,31 @@ Triangulator::~Triangulator() {
 	ContainerUtil::cleanUpVectorOfPointers(_convexPolygonsIndices);
 }
 
+void Triangulator::reserve(size_t vertexCount) {
+	size_t polygonCount = MathUtil::max((size_t) 1, vertexCount - MathUtil::min(vertexCount, (size_t) 2));
+	_indices.ensureCapacity(vertexCount);
+	_isConcaveArray.ensureCapacity(vertexCount);
+	_triangles.ensureCapacity(polygonCount << 2);
+	_convexPolygons.ensureCapacity(polygonCount);
+	_convexPolygonsIndices.ensureCapacity(polygonCount);
+
+	// Decomposing yields at most one polygon per triangle, see the capacities used by decompose().
+	Vector<Vector<float> *> polygons;
+	Vector<Vector<int> *> polygonsIndices;
+	for (size_t i = 0; i < polygonCount; i++) {
+		Vector<float> *polygon = _polygonPool.obtain();
+		polygon->ensureCapacity((vertexCount << 1) + 2);
+		polygons.add(polygon);
+		Vector<int> *polygonIndices = _polygonIndicesPool.obtain();
+		polygonIndices->ensureCapacity(vertexCount);
+		polygonsIndices.add(polygonIndices);
+	}
+	for (size_t i = 0; i < polygonCount; i++) {
+		_polygonPool.free(polygons[i]);
+		_polygonIndicesPool.free(polygonsIndices[i]);
+	}
+}
+
 Vector<int> &Triangulator::triangulate(Vector<float> &vertices) {
 	size_t vertexCount = vertices.size() >> 1;
 
@@ -135,11 +160,17 @@ Vector<Vector<float> *> &Triangulator::decompose(Vector<float> &vertices, Vector
 		_polygonIndicesPool.free(convexPolygonsIndices[i]);
 	convexPolygonsIndices.clear();
 
+	// Pooled polygons are reused in any order, so each gets room for all vertices plus the closing vertex SkeletonClipping adds,
+	// otherwise a polygon that grew in an earlier call ends up holding a small fan and another one is reallocated.
+	size_t polygonCapacity = vertices.size() + 2, polygonIndicesCapacity = vertices.size() >> 1;
+
 	Vector<int> *polygonIndices = _polygonIndicesPool.obtain();
 	polygonIndices->clear();
+	polygonIndices->ensureCapacity(polygonIndicesCapacity);
 
 	Vector<float> *polygon = _polygonPool.obtain();
 	polygon->clear();
+	polygon->ensureCapacity(polygonCapacity);
 
 	// Merge subsequent triangles if they form a triangle fan.
 	int fanBaseIndex = -1, lastwinding = 0;
@@ -176,6 +207,7 @@ Vector<Vector<float> *> &Triangulator::decompose(Vector<float> &vertices, Vector
 
 			polygon = _polygonPool.obtain();
 			polygon->clear();
+			polygon->ensureCapacity(polygonCapacity);
 			polygon->add(x1);
 			polygon->add(y1);
 			polygon->add(x2);
@@ -184,6 +216,7 @@ Vector<Vector<float> *> &Triangulator::decompose(Vector<float> &vertices, Vector
 			polygon->add(y3);
 			polygonIndices = _polygonIndicesPool.obtain();
 			polygonIndices->clear();
+			polygonIndices->ensureCapacity(polygonIndicesCapacity);
 			polygonIndices->add(t1);
 			polygonIndices->add(t2);
 			polygonIndices->add(t3);
@@ -195,6 +228,9 @@ Vector<Vector<float> *> &Triangulator::decompose(Vector<float> &vertices, Vector
 	if (polygon->size() > 0) {
 		convexPolygons.add(polygon);
 		convexPolygonsIndices.add(polygonIndices);
+	} else {
+		_polygonPool.free(polygon);
+		_polygonIndicesPool.free(polygonIndices);
 	}
 
 	// Go through the list of polygons and try to merge the remaining triangles with the found triangle fans.
@@ -33,12 +33,19 @@
 
 #include <spine/Bone.h>
 #include <spine/Skeleton.h>
+#include <spine/VertexSkinning.h>
+
+#include <atomic>
 
 using namespace spine;
 
 RTTI_IMPL(VertexAttachment, Attachment)
 
 VertexAttachment::VertexAttachment(const String &name) : Attachment(name), _worldVerticesLength(0),
+													_timelineAttachment(this), _id(getNextID()) {
+}
+
+VertexAttachment::VertexAttachment(const String &name, AttachmentType type) : Attachment(name, type), _worldVerticesLength(0),
 														 _timelineAttachment(this), _id(getNextID()) {
 }
 
@@ -60,7 +67,8 @@ void VertexAttachment::computeWorldVertices(Slot &slot, size_t start, size_t cou
 
 void VertexAttachment::computeWorldVertices(Slot &slot, size_t start, size_t count, float *worldVertices, size_t offset,
 											size_t stride) {
-	count = offset + (count >> 1) * stride;
+	size_t vertexCount = count >> 1;
+	count = offset + vertexCount * stride;
 	Skeleton &skeleton = slot._bone._skeleton;
 	Vector<float> *deformArray = &slot.getDeform();
 	Vector<float> *vertices = &_vertices;
@@ -81,6 +89,15 @@ void VertexAttachment::computeWorldVertices(Slot &slot, size_t start, size_t cou
 		return;
 	}
 
+	if (VertexSkinning::getKernel() != SkinningKernel_Scalar && _skinningLayout.isValid(bones.size(), _vertices.size())) {
+		// The snapshot is refreshed on first use, so skeletons without weighted attachments never copy their bones.
+		BoneMatrices &matrices = skeleton.getBoneMatrices();
+		if (!matrices.isValid()) matrices.update(skeleton.getBones());
+		if (VertexSkinning::computeWeighted(matrices, _skinningLayout, start >> 1, deformArray->size() > 0 ? deformArray->buffer() : NULL,
+											vertexCount, worldVertices + offset, stride))
+			return;
+	}
+
 	int v = 0, skip = 0;
 	for (size_t i = 0; i < start; i += 2) {
 		int n = (int) bones[v];
@@ -134,10 +151,31 @@ Vector<int> &VertexAttachment::getBones() {
 	return _bones;
 }
 
+void VertexAttachment::setBones(Vector<int> &bones) {
+	_bones.clearAndAddAll(bones);
+	updateSkinningLayout();
+}
+
 Vector<float> &VertexAttachment::getVertices() {
 	return _vertices;
 }
 
+void VertexAttachment::setVertices(Vector<float> &vertices) {
+	_vertices.clearAndAddAll(vertices);
+	updateSkinningLayout();
+}
+
+void VertexAttachment::updateSkinningLayout() {
+	if (_bones.size() == 0 || VertexSkinning::getSupportedKernel() == SkinningKernel_Scalar)
+		_skinningLayout.clear();
+	else
+		_skinningLayout.build(_bones, _vertices);
+}
+
+SkinningLayout &VertexAttachment::getSkinningLayout() {
+	return _skinningLayout;
+}
+
 size_t VertexAttachment::getWorldVerticesLength() {
 	return _worldVerticesLength;
 }
@@ -155,8 +193,9 @@ void VertexAttachment::setTimelineAttachment(Attachment *attachment) {
 }
 
 int VertexAttachment::getNextID() {
-	static int nextID = 0;
-	return nextID++;
+	/* Attachments may be created by loaders on several threads at once. */
+	static std::atomic<int> nextID(0);
+	return nextID.fetch_add(1, std::memory_order_relaxed);
 }
 
 void VertexAttachment::copyTo(VertexAttachment *other) {
@@ -164,4 +203,5 @@ void VertexAttachment::copyTo(VertexAttachment *other) {
 	other->_vertices.clearAndAddAll(this->_vertices);
 	other->_worldVerticesLength = this->_worldVerticesLength;
 	other->_timelineAttachment = this->_timelineAttachment;
+	other->updateSkinningLayout();
 }
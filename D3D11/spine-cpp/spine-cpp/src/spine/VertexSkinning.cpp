@@ -0,0 +1,362 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated April 5, 2025. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2025, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/VertexSkinning.h>
+
+#include <spine/Bone.h>
+#include <spine/Extension.h>
+
+#if !defined(SPINE_NO_SIMD) && (defined(_M_X64) || defined(__x86_64__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__))
+#define SPINE_SKINNING_X86
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(SPINE_SKINNING_X86) && (defined(__GNUC__) || defined(__clang__))
+#define SPINE_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define SPINE_TARGET_AVX2
+#endif
+
+using namespace spine;
+
+BoneMatrices::BoneMatrices() : _buffer(NULL), _size(0), _capacity(0), _valid(false) {
+}
+
+BoneMatrices::~BoneMatrices() {
+	if (_buffer) SpineExtension::free(_buffer, __FILE__, __LINE__);
+}
+
+void BoneMatrices::update(Vector<Bone *> &bones) {
+	size_t n = bones.size();
+	if (n > _capacity) {
+		if (_buffer) SpineExtension::free(_buffer, __FILE__, __LINE__);
+		_capacity = n;
+		_buffer = SpineExtension::calloc<float>(_capacity * Stride, __FILE__, __LINE__);
+	}
+	_size = n;
+	float *matrix = _buffer;
+	for (size_t i = 0; i < n; i++, matrix += Stride) {
+		Bone &bone = *bones[i];
+		matrix[0] = bone.getA();
+		matrix[1] = bone.getB();
+		matrix[2] = bone.getC();
+		matrix[3] = bone.getD();
+		matrix[4] = bone.getWorldX();
+		matrix[5] = bone.getWorldY();
+	}
+	_valid = true;
+}
+
+SkinningLayout::SkinningLayout() : _vertexCount(0), _bonesLength(0), _verticesLength(0) {
+}
+
+void SkinningLayout::clear() {
+	_counts.clear();
+	_rowStarts.clear();
+	_rowBones.clear();
+	_rowDeform.clear();
+	_rowValues.clear();
+	_vertexCount = 0;
+	_bonesLength = 0;
+	_verticesLength = 0;
+}
+
+void SkinningLayout::build(Vector<int> &bones, Vector<float> &vertices) {
+	clear();
+	size_t bonesLength = bones.size();
+	if (bonesLength == 0) return;
+
+	size_t vertexCount = 0, influenceCount = 0, end = 0;
+	for (; end < bonesLength; end += bones[end] + 1) {
+		if (bones[end] < 0) return;
+		vertexCount++;
+		influenceCount += bones[end];
+	}
+	// Bones and vertices are set separately, they may not match yet.
+	if (end != bonesLength || influenceCount * 3 != vertices.size()) return;
+	size_t batches = (vertexCount + BatchSize - 1) / BatchSize;
+
+	// Influence counts per lane and the first row of each batch.
+	_counts.setSize(batches * BatchSize, 0);
+	_rowStarts.setSize(batches + 1, 0);
+	int rows = 0;
+	for (size_t i = 0, v = 0; i < batches; i++) {
+		int maxCount = 0;
+		for (size_t l = 0; l < BatchSize && i * BatchSize + l < vertexCount; l++) {
+			int n = bones[v];
+			_counts[i * BatchSize + l] = n;
+			if (n > maxCount) maxCount = n;
+			v += n + 1;
+		}
+		_rowStarts[i] = rows;
+		rows += maxCount;
+	}
+	_rowStarts[batches] = rows;
+
+	_rowBones.setSize(rows * BatchSize, 0);
+	_rowDeform.setSize(rows * BatchSize, 0);
+	_rowValues.setSize(rows * BatchSize * 3, 0);
+	size_t boneStarts[BatchSize], influences[BatchSize];
+	for (size_t i = 0, v = 0, influence = 0; i < batches; i++) {
+		for (size_t l = 0; l < BatchSize && i * BatchSize + l < vertexCount; l++) {
+			int n = bones[v];
+			boneStarts[l] = v + 1;
+			influences[l] = influence;
+			v += n + 1;
+			influence += n;
+		}
+		for (int row = _rowStarts[i], k = 0; row < _rowStarts[i + 1]; row++, k++) {
+			for (size_t l = 0; l < BatchSize; l++) {
+				if (k >= _counts[i * BatchSize + l]) continue;
+				size_t lane = row * BatchSize + l, b = (influences[l] + k) * 3;
+				_rowBones[lane] = bones[boneStarts[l] + k];
+				_rowDeform[lane] = (int) ((influences[l] + k) << 1);
+				_rowValues[row * BatchSize * 3 + l] = vertices[b];
+				_rowValues[row * BatchSize * 3 + BatchSize + l] = vertices[b + 1];
+				_rowValues[row * BatchSize * 3 + BatchSize * 2 + l] = vertices[b + 2];
+			}
+		}
+	}
+
+	_vertexCount = vertexCount;
+	_bonesLength = bonesLength;
+	_verticesLength = vertices.size();
+}
+
+namespace {
+	struct Batches {
+		const int *counts;
+		const int *rowStarts;
+		const int *rowBones;
+		const int *rowDeform;
+		const float *rowValues;
+	};
+
+	typedef void (*SkinningFunction)(const float *matrices, const Batches &batches, const float *deform, size_t vertexCount,
+									 float *worldVertices, size_t stride);
+
+	const int BatchSize = SkinningLayout::BatchSize;
+	const int Stride = BoneMatrices::Stride;
+
+#ifdef SPINE_SKINNING_X86
+	void skinSse2(const float *matrices, const Batches &batches, const float *deform, size_t vertexCount,
+				  float *worldVertices, size_t stride) {
+		float dx[4], dy[4], lx[4], ly[4];
+		for (size_t i = 0; vertexCount > 0; i++) {
+			int rowStart = batches.rowStarts[i], rowEnd = batches.rowStarts[i + 1];
+			// Each batch is two halves of 4 lanes.
+			for (int half = 0; half < BatchSize && vertexCount > 0; half += 4) {
+				__m128i counts = _mm_loadu_si128((const __m128i *) (batches.counts + i * BatchSize + half));
+				__m128 wx = _mm_setzero_ps(), wy = _mm_setzero_ps();
+				for (int row = rowStart, k = 0; row < rowEnd; row++, k++) {
+					__m128 mask = _mm_castsi128_ps(_mm_cmpgt_epi32(counts, _mm_set1_epi32(k)));
+					const int *bones = batches.rowBones + row * BatchSize + half;
+					__m128 r0 = _mm_loadu_ps(matrices + bones[0] * Stride), r1 = _mm_loadu_ps(matrices + bones[1] * Stride);
+					__m128 r2 = _mm_loadu_ps(matrices + bones[2] * Stride), r3 = _mm_loadu_ps(matrices + bones[3] * Stride);
+					_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+					__m128 t0 = _mm_unpacklo_ps(_mm_loadu_ps(matrices + bones[0] * Stride + 4), _mm_loadu_ps(matrices + bones[1] * Stride + 4));
+					__m128 t1 = _mm_unpacklo_ps(_mm_loadu_ps(matrices + bones[2] * Stride + 4), _mm_loadu_ps(matrices + bones[3] * Stride + 4));
+					__m128 x = _mm_movelh_ps(t0, t1), y = _mm_movehl_ps(t1, t0);
+
+					const float *values = batches.rowValues + row * BatchSize * 3 + half;
+					__m128 vx = _mm_loadu_ps(values), vy = _mm_loadu_ps(values + BatchSize);
+					__m128 weight = _mm_loadu_ps(values + BatchSize * 2);
+					if (deform) {
+						const int *offsets = batches.rowDeform + row * BatchSize + half;
+						for (int l = 0; l < 4; l++) {
+							dx[l] = deform[offsets[l]];
+							dy[l] = deform[offsets[l] + 1];
+						}
+						vx = _mm_add_ps(vx, _mm_loadu_ps(dx));
+						vy = _mm_add_ps(vy, _mm_loadu_ps(dy));
+					}
+					__m128 tx = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, r0), _mm_mul_ps(vy, r1)), x), weight);
+					__m128 ty = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, r2), _mm_mul_ps(vy, r3)), y), weight);
+					wx = _mm_or_ps(_mm_and_ps(mask, _mm_add_ps(wx, tx)), _mm_andnot_ps(mask, wx));
+					wy = _mm_or_ps(_mm_and_ps(mask, _mm_add_ps(wy, ty)), _mm_andnot_ps(mask, wy));
+				}
+				size_t n = vertexCount < 4 ? vertexCount : 4;
+				if (n == 4 && stride == 2) {
+					_mm_storeu_ps(worldVertices, _mm_unpacklo_ps(wx, wy));
+					_mm_storeu_ps(worldVertices + 4, _mm_unpackhi_ps(wx, wy));
+				} else {
+					_mm_storeu_ps(lx, wx);
+					_mm_storeu_ps(ly, wy);
+					for (size_t l = 0; l < n; l++) {
+						worldVertices[l * stride] = lx[l];
+						worldVertices[l * stride + 1] = ly[l];
+					}
+				}
+				worldVertices += n * stride;
+				vertexCount -= n;
+			}
+		}
+	}
+
+	SPINE_TARGET_AVX2 void skinAvx2(const float *matrices, const Batches &batches, const float *deform, size_t vertexCount,
+									float *worldVertices, size_t stride) {
+		float dx[8], dy[8], lx[8], ly[8];
+		for (size_t i = 0; vertexCount > 0; i++) {
+			__m256i counts = _mm256_loadu_si256((const __m256i *) (batches.counts + i * BatchSize));
+			__m256 wx = _mm256_setzero_ps(), wy = _mm256_setzero_ps();
+			for (int row = batches.rowStarts[i], k = 0; row < batches.rowStarts[i + 1]; row++, k++) {
+				__m256 mask = _mm256_castsi256_ps(_mm256_cmpgt_epi32(counts, _mm256_set1_epi32(k)));
+
+				// Transpose the 8 bone rows (a, b, c, d, worldX, worldY, 0, 0) into one vector per component.
+				const int *bones = batches.rowBones + row * BatchSize;
+				__m256 t0 = _mm256_loadu_ps(matrices + bones[0] * Stride), t1 = _mm256_loadu_ps(matrices + bones[1] * Stride);
+				__m256 t2 = _mm256_loadu_ps(matrices + bones[2] * Stride), t3 = _mm256_loadu_ps(matrices + bones[3] * Stride);
+				__m256 t4 = _mm256_loadu_ps(matrices + bones[4] * Stride), t5 = _mm256_loadu_ps(matrices + bones[5] * Stride);
+				__m256 t6 = _mm256_loadu_ps(matrices + bones[6] * Stride), t7 = _mm256_loadu_ps(matrices + bones[7] * Stride);
+				__m256 u0 = _mm256_unpacklo_ps(t0, t1), u1 = _mm256_unpackhi_ps(t0, t1);
+				__m256 u2 = _mm256_unpacklo_ps(t2, t3), u3 = _mm256_unpackhi_ps(t2, t3);
+				__m256 u4 = _mm256_unpacklo_ps(t4, t5), u5 = _mm256_unpackhi_ps(t4, t5);
+				__m256 u6 = _mm256_unpacklo_ps(t6, t7), u7 = _mm256_unpackhi_ps(t6, t7);
+				__m256 ax0 = _mm256_shuffle_ps(u0, u2, 0x44), by0 = _mm256_shuffle_ps(u0, u2, 0xEE);
+				__m256 ax1 = _mm256_shuffle_ps(u4, u6, 0x44), by1 = _mm256_shuffle_ps(u4, u6, 0xEE);
+				__m256 c0 = _mm256_shuffle_ps(u1, u3, 0x44), d0 = _mm256_shuffle_ps(u1, u3, 0xEE);
+				__m256 c1 = _mm256_shuffle_ps(u5, u7, 0x44), d1 = _mm256_shuffle_ps(u5, u7, 0xEE);
+				__m256 a = _mm256_permute2f128_ps(ax0, ax1, 0x20), x = _mm256_permute2f128_ps(ax0, ax1, 0x31);
+				__m256 b = _mm256_permute2f128_ps(by0, by1, 0x20), y = _mm256_permute2f128_ps(by0, by1, 0x31);
+				__m256 c = _mm256_permute2f128_ps(c0, c1, 0x20), d = _mm256_permute2f128_ps(d0, d1, 0x20);
+
+				const float *values = batches.rowValues + row * BatchSize * 3;
+				__m256 vx = _mm256_loadu_ps(values), vy = _mm256_loadu_ps(values + BatchSize);
+				__m256 weight = _mm256_loadu_ps(values + BatchSize * 2);
+				if (deform) {
+					const int *offsets = batches.rowDeform + row * BatchSize;
+					for (int l = 0; l < 8; l++) {
+						dx[l] = deform[offsets[l]];
+						dy[l] = deform[offsets[l] + 1];
+					}
+					vx = _mm256_add_ps(vx, _mm256_loadu_ps(dx));
+					vy = _mm256_add_ps(vy, _mm256_loadu_ps(dy));
+				}
+				__m256 tx = _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vx, a), _mm256_mul_ps(vy, b)), x), weight);
+				__m256 ty = _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vx, c), _mm256_mul_ps(vy, d)), y), weight);
+				wx = _mm256_blendv_ps(wx, _mm256_add_ps(wx, tx), mask);
+				wy = _mm256_blendv_ps(wy, _mm256_add_ps(wy, ty), mask);
+			}
+			size_t n = vertexCount < 8 ? vertexCount : 8;
+			if (n == 8 && stride == 2) {
+				__m256 lo = _mm256_unpacklo_ps(wx, wy), hi = _mm256_unpackhi_ps(wx, wy);
+				_mm256_storeu_ps(worldVertices, _mm256_permute2f128_ps(lo, hi, 0x20));
+				_mm256_storeu_ps(worldVertices + 8, _mm256_permute2f128_ps(lo, hi, 0x31));
+			} else {
+				_mm256_storeu_ps(lx, wx);
+				_mm256_storeu_ps(ly, wy);
+				for (size_t l = 0; l < n; l++) {
+					worldVertices[l * stride] = lx[l];
+					worldVertices[l * stride + 1] = ly[l];
+				}
+			}
+			worldVertices += n * stride;
+			vertexCount -= n;
+		}
+	}
+
+	bool cpuHasAvx2() {
+#if defined(_MSC_VER)
+		int info[4];
+		__cpuid(info, 0);
+		if (info[0] < 7) return false;
+		__cpuid(info, 1);
+		// OSXSAVE and AVX, then check the OS saves the YMM registers.
+		if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0) return false;
+		if ((_xgetbv(0) & 6) != 6) return false;
+		__cpuidex(info, 7, 0);
+		return (info[1] & (1 << 5)) != 0;
+#else
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("avx2") != 0;
+#endif
+	}
+#endif
+
+	SkinningKernel detectKernel() {
+#ifdef SPINE_SKINNING_X86
+		return cpuHasAvx2() ? SkinningKernel_Avx2 : SkinningKernel_Sse2;
+#else
+		return SkinningKernel_Scalar;
+#endif
+	}
+
+	SkinningFunction kernelFunction(SkinningKernel kernel) {
+		switch (kernel) {
+#ifdef SPINE_SKINNING_X86
+			case SkinningKernel_Avx2:
+				return skinAvx2;
+			case SkinningKernel_Sse2:
+				return skinSse2;
+#endif
+			default:
+				return NULL;
+		}
+	}
+
+	SkinningKernel supportedKernel() {
+		static const SkinningKernel kernel = detectKernel();
+		return kernel;
+	}
+
+	SkinningKernel selectedKernel = supportedKernel();
+	SkinningFunction selectedFunction = kernelFunction(selectedKernel);
+}
+
+SkinningKernel VertexSkinning::getSupportedKernel() {
+	return supportedKernel();
+}
+
+SkinningKernel VertexSkinning::getKernel() {
+	return selectedKernel;
+}
+
+void VertexSkinning::setKernel(SkinningKernel kernel) {
+	if (kernel > supportedKernel()) kernel = supportedKernel();
+	selectedKernel = kernel;
+	selectedFunction = kernelFunction(kernel);
+}
+
+bool VertexSkinning::computeWeighted(const BoneMatrices &matrices, SkinningLayout &layout, size_t firstVertex,
+									 const float *deform, size_t vertexCount, float *worldVertices, size_t stride) {
+	if (!selectedFunction || firstVertex % BatchSize != 0 || firstVertex + vertexCount > layout._vertexCount) return false;
+	if (vertexCount == 0) return true;
+	size_t firstBatch = firstVertex / BatchSize;
+	Batches batches;
+	batches.counts = layout._counts.buffer() + firstBatch * BatchSize;
+	batches.rowStarts = layout._rowStarts.buffer() + firstBatch;
+	batches.rowBones = layout._rowBones.buffer();
+	batches.rowDeform = layout._rowDeform.buffer();
+	batches.rowValues = layout._rowValues.buffer();
+	selectedFunction(matrices.getMatrices(), batches, deform, vertexCount, worldVertices, stride);
+	return true;
+}
@@ -0,0 +1,145 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated April 5, 2025. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2025, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+// Animation::search: the linear scan and binary search must return what the original linear scan did, for frame counts
+// around the 16 frame threshold, every step, duplicate keys and targets on, just before and just after each frame. Then
+// every sample rig is played with and without per track keyframe cursors, forwards, reversed and mixed, and the bone
+// world transforms must be bit identical.
+
+#include "TestUtil.h"
+#include <cmath>
+#include <vector>
+
+using namespace spine;
+
+namespace spine {
+	SpineExtension *getDefaultExtension() {
+		static DefaultSpineExtension extension;
+		return &extension;
+	}
+}
+
+// The linear scan search() replaced.
+static int linearSearch(Vector<float> &values, float target, int step) {
+	for (size_t i = step, n = values.size(); i < n; i += step)
+		if (values[i] > target) return (int) (i - step);
+	return (int) values.size() - step;
+}
+
+static void testSearch() {
+	const int steps[] = {1, 2, 3, 4, 5, 6, 7, 9};
+	int checks = 0;
+	for (size_t s = 0; s < sizeof(steps) / sizeof(steps[0]); s++) {
+		int step = steps[s];
+		for (int frameCount = 1; frameCount <= 40; frameCount++) {
+			for (int duplicates = 0; duplicates < 2; duplicates++) {
+				Vector<float> values;
+				values.setSize(frameCount * step, -1);
+				float time = 0;
+				for (int frame = 0; frame < frameCount; frame++) {
+					// Every third frame repeats the previous time when testing duplicates.
+					if (frame > 0 && !(duplicates && frame % 3 == 0)) time += 0.1f + 0.01f * (float) (frame % 4);
+					values[frame * step] = time;
+				}
+				std::vector<float> targets;
+				targets.push_back(-1);
+				targets.push_back(time + 1);
+				for (int frame = 0; frame < frameCount; frame++) {
+					float key = values[frame * step];
+					targets.push_back(key);
+					targets.push_back(std::nextafter(key, -1.0f));
+					targets.push_back(std::nextafter(key, 100.0f));
+					if (frame + 1 < frameCount) targets.push_back((key + values[(frame + 1) * step]) / 2);
+				}
+				for (size_t i = 0; i < targets.size(); i++) {
+					int expected = linearSearch(values, targets[i], step);
+					int actual = Animation::search(values, targets[i], step);
+					CHECK_MSG(actual == expected, "step %d, %d frames%s, target %.9g: %d, expected %d", step, frameCount,
+							  duplicates ? " with duplicates" : "", targets[i], actual, expected);
+					if (step == 1) CHECK(Animation::search(values, targets[i]) == expected);
+					checks++;
+				}
+			}
+		}
+	}
+	printf("search: %d targets match the linear scan\n", checks);
+}
+
+// Queues every animation, mixed, with every third one reversed.
+static void queue(AnimationState &state, SkeletonData &data, bool cursors) {
+	Vector<Animation *> &animations = data.getAnimations();
+	for (size_t i = 0; i < animations.size(); i++) {
+		TrackEntry *entry = i == 0 ? state.setAnimation(0, animations[i], true) : state.addAnimation(0, animations[i], false, 0.5f);
+		entry->setReverse(i % 3 == 2);
+		entry->setKeyframeCursors(cursors);
+	}
+}
+
+static void testCursors(Atlas &atlas, const std::string &path) {
+	SkeletonData *data = readSkeletonData(atlas, path);
+	if (!data) return;
+	{
+		AnimationStateData stateData(data);
+		stateData.setDefaultMix(0.2f);
+		Skeleton withCursors(data), withoutCursors(data);
+		AnimationState stateWith(&stateData), stateWithout(&stateData);
+		queue(stateWith, *data, true);
+		queue(stateWithout, *data, false);
+		int mismatches = 0, firstFrame = -1;
+		for (int frame = 0; frame < 1500; frame++) {
+			// Uneven steps, with the occasional large one, so cursors both advance and jump.
+			float delta = frame % 97 == 0 ? 0.7f : (frame % 5 + 1) / 120.0f;
+			advance(stateWith, withCursors, delta);
+			advance(stateWithout, withoutCursors, delta);
+			Vector<Bone *> &a = withCursors.getBones(), &b = withoutCursors.getBones();
+			for (size_t i = 0; i < a.size(); i++) {
+				Bone &x = *a[i], &y = *b[i];
+				if (x.getA() != y.getA() || x.getB() != y.getB() || x.getC() != y.getC() || x.getD() != y.getD() ||
+					x.getWorldX() != y.getWorldX() || x.getWorldY() != y.getWorldY()) {
+					if (firstFrame < 0) firstFrame = frame;
+					mismatches++;
+					break;
+				}
+			}
+		}
+		CHECK_MSG(mismatches == 0, "%s: %d frames differ with keyframe cursors, the first is %d", path.c_str(), mismatches,
+				  firstFrame);
+	}
+	delete data;
+}
+
+int main() {
+	testSearch();
+	TestTextureLoader textureLoader;
+	for (size_t r = 0; r < testRigCount; r++) {
+		Atlas atlas(assetPath(testRigs[r].atlas).c_str(), &textureLoader);
+		testCursors(atlas, assetPath(testRigs[r].skeleton));
+	}
+	return testResult();
+}
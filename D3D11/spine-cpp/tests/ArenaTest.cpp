@@ -0,0 +1,217 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated April 5, 2025. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2025, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+// ArenaAllocator and ArenaScope: arena memory is served while a scope is alive and must stay safe to free and grow after
+// the scope ended, on any thread, while heap memory is unaffected. All memory goes through a DebugExtension. Blocks above the
+// addresses the page map covers are not used, the allocations go to the heap.
+
+#include "TestUtil.h"
+#include <spine/ArenaAllocator.h>
+#include <spine/Debug.h>
+#include <thread>
+
+using namespace spine;
+
+// Above the 48 bit addresses of the page map. Never dereferenced, the arena checks the block before writing its header.
+static const uintptr_t highAddress = sizeof(uintptr_t) > 4 ? (uintptr_t) 1 << (sizeof(uintptr_t) * 8 - 4) : 0;
+static bool highAddressNext = false;
+
+namespace spine {
+	// Returns highAddress once for the next allocation after highAddressNext is set, as a system with 5 level paging could.
+	class HighAddressExtension : public DefaultSpineExtension {
+	public:
+		void *_alloc(size_t size, const char *file, int line) {
+			if (!highAddressNext) return DefaultSpineExtension::_alloc(size, file, line);
+			highAddressNext = false;
+			return (void *) highAddress;
+		}
+
+		void _free(void *mem, const char *file, int line) {
+			if (mem != (void *) highAddress) DefaultSpineExtension::_free(mem, file, line);
+		}
+	};
+
+	SpineExtension *getDefaultExtension() {
+		static HighAddressExtension highAddressExtension;
+		static DebugExtension extension(&highAddressExtension);
+		return &extension;
+	}
+}
+
+static DebugExtension *debugExtension() {
+	return (DebugExtension *) SpineExtension::getInstance();
+}
+
+static void testScopes() {
+	ArenaAllocator arena(1024);
+	Vector<float> longLived;
+	longLived.add(1);
+	for (int frame = 0; frame < 3; frame++) {
+		{
+			ArenaScope scope(arena);
+			Vector<float> temporary;
+			for (int i = 0; i < 5000; i++) temporary.add((float) i);
+			String string("hello arena");
+			string.append(" world");
+			longLived.add(2);
+			CHECK(arena.owns(temporary.buffer()));
+			CHECK(arena.owns(string.buffer()));
+			CHECK(!arena.owns(longLived.buffer()));
+			{
+				// Arena memory of the outer scope grows within the outer arena.
+				ArenaAllocator inner;
+				ArenaScope innerScope(inner);
+				Vector<int> innerTemporary;
+				innerTemporary.add(3);
+				for (int i = 0; i < 10000; i++) temporary.add(9);
+				CHECK(arena.owns(temporary.buffer()));
+				CHECK(inner.owns(innerTemporary.buffer()));
+			}
+			bool intact = true;
+			for (int i = 0; i < 5000; i++) intact &= temporary[i] == (float) i;
+			CHECK(intact);
+		}
+		arena.reset();
+	}
+}
+
+// Vectors grown in a scope and freed or grown after it ended, the case of objects that outlive the frame.
+static void testAfterScope() {
+	ArenaAllocator arena;
+	Vector<int> *grown = new (__FILE__, __LINE__) Vector<int>();
+	Vector<int> *freed = new (__FILE__, __LINE__) Vector<int>();
+	{
+		ArenaScope scope(arena);
+		for (int i = 0; i < 100; i++) {
+			grown->add(i);
+			freed->add(i);
+		}
+		CHECK(arena.owns(grown->buffer()));
+		CHECK(arena.owns(freed->buffer()));
+	}
+	CHECK(ArenaAllocator::isArenaMemory(freed->buffer()));
+	delete freed;
+
+	// Growing after the scope moves the buffer to the heap, where it is freed normally.
+	for (int i = 100; i < 1000; i++) grown->add(i);
+	CHECK(!ArenaAllocator::isArenaMemory(grown->buffer()));
+	bool intact = true;
+	for (int i = 0; i < 1000; i++) intact &= (*grown)[i] == i;
+	CHECK(intact);
+
+	// Arena memory is recognized on other threads too.
+	Vector<int> *other = NULL;
+	{
+		ArenaScope scope(arena);
+		other = new (__FILE__, __LINE__) Vector<int>();
+		other->add(1);
+	}
+	std::thread([other]() {
+		other->add(2);
+		delete other;
+	}).join();
+	delete grown;
+}
+
+// Heap memory freed and grown while an arena holds blocks, inside and outside of a scope and on other threads, must still
+// reach the heap. A miss would show as leaked memory.
+static void testHeapWhileArenaLive() {
+	ArenaAllocator arena(1024);
+	{
+		ArenaScope scope(arena);
+		Vector<int> temporary;
+		for (int i = 0; i < 1000; i++) temporary.add(i);
+		CHECK(ArenaAllocator::isArenaMemory(temporary.buffer()));
+	}
+	size_t before = debugExtension()->getUsedMemory();
+
+	Vector<int> *heap = new (__FILE__, __LINE__) Vector<int>();
+	heap->add(1);
+	{
+		ArenaScope scope(arena);
+		CHECK(!ArenaAllocator::isArenaMemory(heap->buffer()));
+		// Heap memory allocated before the scope grows on the heap.
+		for (int i = 0; i < 1000; i++) heap->add(i);
+		CHECK(!ArenaAllocator::isArenaMemory(heap->buffer()));
+	}
+	CHECK(!ArenaAllocator::isArenaMemory(heap));
+	delete heap;
+
+	std::thread workers[4];
+	for (int t = 0; t < 4; t++) {
+		workers[t] = std::thread([]() {
+			for (int i = 0; i < 1000; i++) {
+				Vector<float> vector;
+				for (int n = 0; n < 64; n++) vector.add((float) n);
+				CHECK(!ArenaAllocator::isArenaMemory(vector.buffer()));
+				String string("heap");
+				string.append(" string");
+			}
+		});
+	}
+	for (int t = 0; t < 4; t++) workers[t].join();
+	CHECK_MSG(debugExtension()->getUsedMemory() == before, "%zu heap bytes not freed", debugExtension()->getUsedMemory() - before);
+}
+
+static void testHighAddresses() {
+	if (!highAddress) return;
+	size_t before = debugExtension()->getUsedMemory();
+	{
+		ArenaAllocator arena(1024);
+		highAddressNext = true;
+		CHECK(arena.allocate(64) == NULL);
+		CHECK(arena.getCapacity() == 0);
+		CHECK(!ArenaAllocator::isArenaMemory((void *) highAddress));
+		void *memory = arena.allocate(64);
+		CHECK(memory && ArenaAllocator::isArenaMemory(memory));
+
+		// In a scope, the allocation falls back to the heap.
+		ArenaAllocator scoped(1024);
+		ArenaScope scope(scoped);
+		highAddressNext = true;
+		Vector<int> vector;
+		vector.add(7);
+		CHECK(!ArenaAllocator::isArenaMemory(vector.buffer()) && !scoped.owns(vector.buffer()));
+		CHECK(vector[0] == 7);
+		CHECK(scoped.getCapacity() == 0);
+	}
+	CHECK(!highAddressNext);
+	CHECK_MSG(debugExtension()->getUsedMemory() == before, "%zu bytes leaked", debugExtension()->getUsedMemory() - before);
+}
+
+int main() {
+	size_t before = debugExtension()->getUsedMemory();
+	testScopes();
+	testAfterScope();
+	testHeapWhileArenaLive();
+	testHighAddresses();
+	CHECK(!ArenaAllocator::isArenaMemory(&before));
+	CHECK_MSG(debugExtension()->getUsedMemory() == before, "%zu bytes leaked", debugExtension()->getUsedMemory() - before);
+	return testResult();
+}
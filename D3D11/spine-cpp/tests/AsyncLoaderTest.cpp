@@ -0,0 +1,212 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated April 5, 2025. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2025, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+// AsyncLoader: every sample rig is loaded with 1 and 3 worker threads and a DeferredTextureLoader. Apart from the threads'
+// start up state, the loader must allocate only through the SpineExtension, and return all of it. Baked skeleton data
+// must fail to load with a scale other than 1, through the loader and through SkeletonDataCache.
+
+#include "TestUtil.h"
+#include <atomic>
+#include <new>
+#include <stdlib.h>
+
+using namespace spine;
+
+static std::atomic<size_t> globalAllocations(0);
+
+void *operator new(size_t size) {
+	globalAllocations++;
+	void *memory = malloc(size ? size : 1);
+	if (!memory) throw std::bad_alloc();
+	return memory;
+}
+
+void operator delete(void *memory) noexcept {
+	free(memory);
+}
+
+void operator delete(void *memory, size_t) noexcept {
+	free(memory);
+}
+
+namespace {
+	// Counts allocations and frees, from any thread.
+	class CountingExtension : public DefaultSpineExtension {
+	public:
+		CountingExtension() : allocations(0), frees(0) {
+		}
+
+		void *_alloc(size_t size, const char *file, int line) {
+			allocations++;
+			return DefaultSpineExtension::_alloc(size, file, line);
+		}
+
+		void *_calloc(size_t size, const char *file, int line) {
+			allocations++;
+			return DefaultSpineExtension::_calloc(size, file, line);
+		}
+
+		void *_realloc(void *ptr, size_t size, const char *file, int line) {
+			if (!ptr) allocations++;
+			return DefaultSpineExtension::_realloc(ptr, size, file, line);
+		}
+
+		void _free(void *mem, const char *file, int line) {
+			if (mem) frees++;
+			DefaultSpineExtension::_free(mem, file, line);
+		}
+
+		size_t getLive() {
+			return allocations - frees;
+		}
+
+		std::atomic<size_t> allocations, frees;
+	};
+
+	// Decoding returns a fake texture for the page, which upload() sets on the thread calling update().
+	class TestDeferredLoader : public DeferredTextureLoader {
+	public:
+		void *decode(AtlasPage &page, const String &path) {
+			SP_UNUSED(path);
+			return (void *) (uintptr_t) (0x1000 + page.index);
+		}
+
+		void upload(AtlasPage &page, const String &path, void *decoded) {
+			SP_UNUSED(path);
+			page.texture = decoded;
+			page.width = 1024;
+			page.height = 1024;
+		}
+
+		void unload(void *texture) {
+			SP_UNUSED(texture);
+		}
+	};
+}
+
+static CountingExtension *countingExtension() {
+	return (CountingExtension *) SpineExtension::getInstance();
+}
+
+namespace spine {
+	SpineExtension *getDefaultExtension() {
+		static CountingExtension extension;
+		return &extension;
+	}
+}
+
+static void testLoads(int threadCount) {
+	TestDeferredLoader textureLoader;
+	// The paths are built before counting, assetPath() returns a std::string.
+	Vector<String> atlasPaths, skeletonPaths;
+	for (size_t r = 0; r < testRigCount; r++) {
+		atlasPaths.add(assetPath(testRigs[r].atlas).c_str());
+		skeletonPaths.add(assetPath(testRigs[r].skeleton).c_str());
+		if (!testRigs[r].json) continue;
+		atlasPaths.add(assetPath(testRigs[r].atlas).c_str());
+		skeletonPaths.add(assetPath(testRigs[r].json).c_str());
+	}
+	size_t live = countingExtension()->getLive(), before = globalAllocations;
+	{
+		AsyncLoader loader(&textureLoader, threadCount);
+		CHECK(loader.getThreadCount() == threadCount);
+		Vector<AsyncLoad *> loads;
+		for (size_t i = 0; i < atlasPaths.size(); i++)
+			loads.add(loader.load(atlasPaths[i], skeletonPaths[i]));
+		loader.finish();
+		CHECK(loader.getPendingCount() == 0);
+		for (size_t i = 0; i < loads.size(); i++) {
+			AsyncLoad *load = loads[i];
+			CHECK(load->isDone());
+			CHECK_MSG(load->getSkeletonData(), "%s: %s", load->getSkeletonPath().buffer(), load->getError().buffer());
+			if (load->getAtlas()) {
+				Vector<AtlasPage *> &pages = load->getAtlas()->getPages();
+				for (size_t ii = 0; ii < pages.size(); ii++)
+					CHECK(pages[ii]->texture == (void *) (uintptr_t) (0x1000 + pages[ii]->index));
+			}
+			delete load->getSkeletonData();
+			delete load->getAtlas();
+			delete load;
+		}
+	}
+	size_t allocations = globalAllocations - before;
+	CHECK_MSG(allocations <= (size_t) threadCount, "%d threads: %zu allocations outside the SpineExtension", threadCount,
+			  allocations);
+	CHECK_MSG(countingExtension()->getLive() == live, "%d threads: %zu allocations not freed", threadCount,
+			  countingExtension()->getLive() - live);
+}
+
+static void testBakedScale() {
+	const TestRig &rig = testRigs[0];
+	TestTextureLoader textureLoader;
+	String bakedPath("AsyncLoaderTest.baked");
+	{
+		Atlas atlas(assetPath(rig.atlas).c_str(), &textureLoader);
+		SkeletonData *data = readSkeletonData(atlas, assetPath(rig.skeleton));
+		if (!data) return;
+		SkeletonBaker baker;
+		bool written = baker.writeFile(*data, bakedPath);
+		CHECK_MSG(written, "%s", baker.getError().buffer());
+		delete data;
+		if (!written) return;
+	}
+
+	TestDeferredLoader deferredLoader;
+	{
+		AsyncLoader loader(&deferredLoader, 2);
+		AsyncLoad *scaled = loader.load(assetPath(rig.atlas).c_str(), bakedPath, 2);
+		AsyncLoad *unscaled = loader.load(assetPath(rig.atlas).c_str(), bakedPath);
+		loader.finish();
+		CHECK(scaled->getSkeletonData() == NULL);
+		CHECK(!scaled->getError().isEmpty());
+		CHECK_MSG(unscaled->getSkeletonData(), "%s", unscaled->getError().buffer());
+		delete scaled->getSkeletonData();
+		delete scaled->getAtlas();
+		delete scaled;
+		delete unscaled->getSkeletonData();
+		delete unscaled->getAtlas();
+		delete unscaled;
+	}
+	{
+		SkeletonDataCache cache(&textureLoader);
+		CHECK(cache.acquire(assetPath(rig.atlas).c_str(), bakedPath, 2) == NULL);
+		CHECK(!cache.getError().isEmpty());
+		SkeletonDataCache::Entry *entry = cache.acquire(assetPath(rig.atlas).c_str(), bakedPath);
+		CHECK_MSG(entry, "%s", cache.getError().buffer());
+		if (entry) cache.release(entry);
+	}
+	remove(bakedPath.buffer());
+}
+
+int main() {
+	testLoads(1);
+	testLoads(3);
+	testBakedScale();
+	return testResult();
+}
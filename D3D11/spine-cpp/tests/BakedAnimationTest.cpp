@@ -0,0 +1,129 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated April 5, 2025. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2025, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+// BakedAnimation: every animation of the sample rigs is baked, with and without quantization. The bone local values applied
+// from the samples must be within the storage tolerance of the timelines at each sample, and within getError() halfway
+// between samples, which must be the largest difference found there.
+
+#include "TestUtil.h"
+
+using namespace spine;
+
+namespace spine {
+	SpineExtension *getDefaultExtension() {
+		static DefaultSpineExtension extension;
+		return &extension;
+	}
+}
+
+static const float storageTolerance = 0.01f;
+
+static float boneError(Bone &a, Bone &b) {
+	float error = MathUtil::abs(a.getRotation() - b.getRotation());
+	error = MathUtil::max(error, MathUtil::abs(a.getX() - b.getX()));
+	error = MathUtil::max(error, MathUtil::abs(a.getY() - b.getY()));
+	error = MathUtil::max(error, MathUtil::abs(a.getScaleX() - b.getScaleX()));
+	error = MathUtil::max(error, MathUtil::abs(a.getScaleY() - b.getScaleY()));
+	error = MathUtil::max(error, MathUtil::abs(a.getShearX() - b.getShearX()));
+	return MathUtil::max(error, MathUtil::abs(a.getShearY() - b.getShearY()));
+}
+
+// Applies the baked timelines as Animation::apply() does and from the samples to skeletons in the setup pose, and returns
+// the largest difference of a bone local value. As when baking, a key within epsilon after the time is applied at the key.
+static float compare(Animation &animation, BakedAnimation &baked, Skeleton &expected, Skeleton &actual, float time, float epsilon) {
+	expected.setToSetupPose();
+	actual.setToSetupPose();
+	Vector<Timeline *> &timelines = animation.getTimelines();
+	for (size_t i = 0; i < timelines.size(); i++) {
+		if (!baked.isBaked(i)) continue;
+		Vector<float> &frames = timelines[i]->getFrames();
+		float keyTime = time;
+		for (size_t frame = 0; frame < frames.size(); frame += timelines[i]->getFrameEntries()) {
+			if (frames[frame] > time && frames[frame] - time <= epsilon) {
+				keyTime = frames[frame];
+				break;
+			}
+		}
+		timelines[i]->apply(expected, keyTime, keyTime, NULL, 1, MixBlend_Setup, MixDirection_In);
+		baked.apply(i, actual, time, 1, MixBlend_Setup, MixDirection_In);
+	}
+	float error = 0;
+	for (size_t i = 0; i < expected.getBones().size(); i++)
+		error = MathUtil::max(error, boneError(*expected.getBones()[i], *actual.getBones()[i]));
+	return error;
+}
+
+// Returns the number of baked channels.
+static int testRig(Atlas &atlas, const std::string &path) {
+	SkeletonData *data = readSkeletonData(atlas, path);
+	if (!data) return 0;
+	int channelCount = 0;
+	{
+		Skeleton expected(data), actual(data);
+		// Bones that need a skin are keyed too.
+		for (size_t i = 0; i < expected.getBones().size(); i++) {
+			expected.getBones()[i]->setActive(true);
+			actual.getBones()[i]->setActive(true);
+		}
+		Vector<Animation *> &animations = data->getAnimations();
+		for (size_t a = 0; a < animations.size() * 2; a++) {
+			Animation &animation = *animations[a >> 1];
+			bool quantize = (a & 1) != 0;
+			BakedAnimation baked(*data, animation, 30, storageTolerance, quantize);
+			channelCount += baked.getChannelCount();
+			int sampleCount = baked.getSampleCount();
+			float step = sampleCount > 1 ? animation.getDuration() / (sampleCount - 1) : 0, epsilon = step * 0.001f;
+			float sampleError = 0, error = 0;
+			for (int half = 0, n = sampleCount * 2 - 1; half < n; half++) {
+				float time = MathUtil::min(half * step * 0.5f, animation.getDuration());
+				float timeError = compare(animation, baked, expected, actual, time, epsilon);
+				if (half % 2 == 0) sampleError = MathUtil::max(sampleError, timeError);
+				error = MathUtil::max(error, timeError);
+			}
+			const char *name = animation.getName().buffer();
+			CHECK_MSG(sampleError <= storageTolerance * 1.001f, "%s %s%s: %g at the samples", path.c_str(), name,
+					  quantize ? " quantized" : "", sampleError);
+			CHECK_MSG(MathUtil::abs(error - baked.getError()) <= storageTolerance * 0.001f, "%s %s%s: %g, getError() %g",
+					  path.c_str(), name, quantize ? " quantized" : "", error, baked.getError());
+		}
+	}
+	delete data;
+	return channelCount;
+}
+
+int main() {
+	TestTextureLoader textureLoader;
+	int channelCount = 0;
+	for (size_t r = 0; r < testRigCount; r++) {
+		Atlas atlas(assetPath(testRigs[r].atlas).c_str(), &textureLoader);
+		channelCount += testRig(atlas, assetPath(testRigs[r].skeleton));
+	}
+	CHECK(channelCount > 0);
+	return testResult();
+}
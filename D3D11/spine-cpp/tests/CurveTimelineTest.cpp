@@ -0,0 +1,213 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated April 5, 2025. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2025, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+// CurveTimeline: the curve values of every timeline of the sample rigs, and of bezier curves built to hit the sample boundaries,
+// must be bit identical to the scalar sample scan, at frame times, at every bezier sample time and one ulp around it. The
+// batched CurveTimeline1/2::getCurveValues() must equal getCurveValue() per timeline. The test is also built against the
+// runtime compiled with SPINE_NO_SIMD.
+
+#include "TestUtil.h"
+#include <cmath>
+#include <vector>
+
+using namespace spine;
+
+namespace spine {
+	SpineExtension *getDefaultExtension() {
+		static DefaultSpineExtension extension;
+		return &extension;
+	}
+}
+
+static const int BezierSize = 18;
+
+static bool sameBits(float a, float b) {
+	return memcmp(&a, &b, sizeof(float)) == 0;
+}
+
+// The scalar sample scan getBezierValue() replaces.
+static float scanBezier(CurveTimeline &timeline, float time, size_t frame, size_t valueOffset, size_t i) {
+	float *curves = timeline.getCurves().buffer(), *frames = timeline.getFrames().buffer();
+	if (curves[i] > time) {
+		float x = frames[frame], y = frames[frame + valueOffset];
+		return y + (time - x) / (curves[i] - x) * (curves[i + 1] - y);
+	}
+	size_t n = i + BezierSize;
+	for (i += 2; i < n; i += 2) {
+		if (curves[i] >= time) {
+			float x = curves[i - 2], y = curves[i - 1];
+			return y + (time - x) / (curves[i] - x) * (curves[i + 1] - y);
+		}
+	}
+	frame += timeline.getFrameEntries();
+	float x = curves[n - 2], y = curves[n - 1];
+	return y + (time - x) / (frames[frame] - x) * (frames[frame + valueOffset] - y);
+}
+
+// The value of the curve at the time, as getCurveValue() computes it, with the bezier samples scanned.
+static float scanValue(CurveTimeline &timeline, float time, size_t valueOffset) {
+	Vector<float> &frames = timeline.getFrames();
+	size_t entries = timeline.getFrameEntries();
+	int i = Animation::search(frames, time, (int) entries);
+	int curveType = (int) timeline.getCurves()[i / entries];
+	if (curveType == 0) {
+		float before = frames[i], value = frames[i + valueOffset];
+		if (entries == 2) return value + (time - before) / (frames[i + entries] - before) * (frames[i + entries + valueOffset] - value);
+		return value + (frames[i + entries + valueOffset] - value) * ((time - before) / (frames[i + entries] - before));
+	}
+	if (curveType == 1) return frames[i + valueOffset];
+	return scanBezier(timeline, time, i, valueOffset, curveType - 2 + (valueOffset - 1) * BezierSize);
+}
+
+// Frame times, midpoints, every bezier sample time and the floats next to them, from the first frame on.
+static void curveTimes(CurveTimeline &timeline, std::vector<float> &times) {
+	Vector<float> &frames = timeline.getFrames(), &curves = timeline.getCurves();
+	size_t entries = timeline.getFrameEntries(), frameCount = timeline.getFrameCount();
+	times.clear();
+	for (size_t f = 0; f < frameCount; f++) {
+		float time = frames[f * entries];
+		times.push_back(time);
+		if (f + 1 < frameCount) times.push_back((time + frames[(f + 1) * entries]) / 2);
+		int curveType = (int) curves[f];
+		if (curveType < 2) continue;
+		for (size_t b = 0; b < entries - 1; b++) {
+			for (int s = 0; s < BezierSize; s += 2) {
+				float sample = curves[curveType - 2 + b * BezierSize + s];
+				times.push_back(sample);
+				times.push_back(std::nextafter(sample, -INFINITY));
+				times.push_back(std::nextafter(sample, INFINITY));
+			}
+		}
+	}
+	times.push_back(frames[(frameCount - 1) * entries] + 1);
+	for (size_t i = 0; i < times.size();)
+		if (times[i] < frames[0])
+			times.erase(times.begin() + i);
+		else
+			i++;
+}
+
+// Returns the number of values that differ from the scan.
+static int compareTimeline(CurveTimeline &timeline, std::vector<float> &times) {
+	curveTimes(timeline, times);
+	int mismatches = 0;
+	for (size_t t = 0; t < times.size(); t++) {
+		float time = times[t];
+		if (timeline.getRTTI().instanceOf(CurveTimeline1::rtti)) {
+			if (!sameBits(static_cast<CurveTimeline1 &>(timeline).getCurveValue(time), scanValue(timeline, time, 1))) mismatches++;
+		} else {
+			float value1, value2;
+			static_cast<CurveTimeline2 &>(timeline).getCurveValue(time, value1, value2);
+			if (!sameBits(value1, scanValue(timeline, time, 1)) || !sameBits(value2, scanValue(timeline, time, 2))) mismatches++;
+		}
+	}
+	return mismatches;
+}
+
+// Bezier curves whose samples are hit exactly, whose times overshoot so the samples are not sorted, and which are flat.
+static void testBoundaries() {
+	RotateTimeline timeline(5, 4, 0);
+	timeline.setFrame(0, 0, 0);
+	timeline.setFrame(1, 1, 10);
+	timeline.setFrame(2, 2, -5);
+	timeline.setFrame(3, 3, -5);
+	timeline.setFrame(4, 4, 2);
+	timeline.setBezier(0, 0, 0, 0, 0, 0.25f, 5, 0.75f, 10, 1, 10);
+	timeline.setBezier(1, 1, 0, 1, 10, 1.9f, 30, 1.1f, -40, 2, -5);
+	timeline.setBezier(2, 2, 0, 2, -5, 2, -5, 3, -5, 3, -5);
+	timeline.setBezier(3, 3, 0, 3, -5, 3.5f, -5, 3.5f, 2, 4, 2);
+	std::vector<float> times;
+	int mismatches = compareTimeline(timeline, times);
+	CHECK_MSG(mismatches == 0, "bezier boundaries: %d of %d values differ", mismatches, (int) times.size());
+
+	TranslateTimeline timeline2(2, 2, 0);
+	timeline2.setFrame(0, 0, 0, 1);
+	timeline2.setFrame(1, 1, 4, -4);
+	timeline2.setBezier(0, 0, 0, 0, 0, 0.9f, 1, 0.1f, 3, 1, 4);
+	timeline2.setBezier(1, 0, 1, 0, 1, 0.5f, 1, 0.5f, -4, 1, -4);
+	mismatches = compareTimeline(timeline2, times);
+	CHECK_MSG(mismatches == 0, "bezier boundaries, 2 values: %d of %d values differ", mismatches, (int) times.size());
+}
+
+static void testRig(Atlas &atlas, const std::string &path, int &timelineCount) {
+	SkeletonData *data = readSkeletonData(atlas, path);
+	if (!data) return;
+	std::vector<float> times;
+	int mismatches = 0, batchMismatches = 0;
+	Vector<Animation *> &animations = data->getAnimations();
+	for (size_t a = 0; a < animations.size(); a++) {
+		Animation &animation = *animations[a];
+		Vector<CurveTimeline1 *> timelines1;
+		Vector<CurveTimeline2 *> timelines2;
+		Vector<Timeline *> &timelines = animation.getTimelines();
+		for (size_t i = 0; i < timelines.size(); i++) {
+			const RTTI &rtti = timelines[i]->getRTTI();
+			if (rtti.instanceOf(CurveTimeline1::rtti))
+				timelines1.add(static_cast<CurveTimeline1 *>(timelines[i]));
+			else if (rtti.instanceOf(CurveTimeline2::rtti))
+				timelines2.add(static_cast<CurveTimeline2 *>(timelines[i]));
+			else
+				continue;
+			mismatches += compareTimeline(*static_cast<CurveTimeline *>(timelines[i]), times);
+			timelineCount++;
+		}
+
+		std::vector<float> values1(timelines1.size()), values2(timelines2.size() * 2);
+		for (int step = 0; step <= 60; step++) {
+			float time = animation.getDuration() * step / 60;
+			CurveTimeline1::getCurveValues(timelines1.buffer(), timelines1.size(), time, values1.data());
+			for (size_t i = 0; i < timelines1.size(); i++)
+				if (!sameBits(values1[i], timelines1[i]->getCurveValue(time))) batchMismatches++;
+			CurveTimeline2::getCurveValues(timelines2.buffer(), timelines2.size(), time, values2.data());
+			for (size_t i = 0; i < timelines2.size(); i++) {
+				float value1, value2;
+				timelines2[i]->getCurveValue(time, value1, value2);
+				if (!sameBits(values2[i * 2], value1) || !sameBits(values2[i * 2 + 1], value2)) batchMismatches++;
+			}
+		}
+	}
+	CHECK_MSG(mismatches == 0, "%s: %d curve values differ from the scan", path.c_str(), mismatches);
+	CHECK_MSG(batchMismatches == 0, "%s: %d batched curve values differ", path.c_str(), batchMismatches);
+	delete data;
+}
+
+int main() {
+#ifdef SPINE_NO_SIMD
+	printf("runtime built with SPINE_NO_SIMD\n");
+#endif
+	testBoundaries();
+	TestTextureLoader textureLoader;
+	int timelineCount = 0;
+	for (size_t r = 0; r < testRigCount; r++) {
+		Atlas atlas(assetPath(testRigs[r].atlas).c_str(), &textureLoader);
+		testRig(atlas, assetPath(testRigs[r].skeleton), timelineCount);
+	}
+	printf("%d curve timelines\n", timelineCount);
+	return testResult();
+}
@@ -0,0 +1,302 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated April 5, 2025. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2025, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+// File mapping: the snowglobe, raptor and spineboy atlases and .skel files are read through SpineExtension::mapFile() and,
+// with mapping turned off in the extension, through readFile(). Both must give the same data, and the mapped load must need
+// exactly the file size less peak heap, as parsing the mapping skips the heap copy. A batch of 200 loads of each is timed
+// and the peak resident set size growth while the batch is alive is printed for both.
+//
+// Names are still copied out of the mapping: .skel strings are length prefixed rather than NUL terminated and the mapping
+// is closed once parsing is done, so views into it could not outlive the load.
+
+#include "TestUtil.h"
+#include <chrono>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using namespace spine;
+
+namespace {
+	// Keeps the size of each allocation in front of it, to track the bytes in use and their peak.
+	class PeakExtension : public DefaultSpineExtension {
+	public:
+		PeakExtension() : mapping(true), used(0), peak(0) {
+		}
+
+		void *_alloc(size_t size, const char *file, int line) {
+			if (size == 0) return NULL;
+			return track(DefaultSpineExtension::_alloc(size + Header, file, line), size);
+		}
+
+		void *_calloc(size_t size, const char *file, int line) {
+			if (size == 0) return NULL;
+			return track(DefaultSpineExtension::_calloc(size + Header, file, line), size);
+		}
+
+		void *_realloc(void *ptr, size_t size, const char *file, int line) {
+			if (!ptr) return _alloc(size, file, line);
+			char *block = (char *) ptr - Header;
+			used -= *(size_t *) block;
+			return track(DefaultSpineExtension::_realloc(block, size + Header, file, line), size);
+		}
+
+		void _free(void *mem, const char *file, int line) {
+			if (!mem) return;
+			char *block = (char *) mem - Header;
+			used -= *(size_t *) block;
+			DefaultSpineExtension::_free(block, file, line);
+		}
+
+		const char *_mapFile(const String &path, int *length) {
+			if (mapping) return DefaultSpineExtension::_mapFile(path, length);
+			*length = 0;
+			return NULL;
+		}
+
+		void resetPeak() {
+			peak = used;
+		}
+
+		bool mapping;
+		size_t used;
+		size_t peak;
+
+	private:
+		static const size_t Header = 16;
+
+		void *track(void *block, size_t size) {
+			if (!block) return NULL;
+			*(size_t *) block = size;
+			used += size;
+			if (used > peak) peak = used;
+			return (char *) block + Header;
+		}
+	};
+
+	struct Load {
+		Atlas *atlas;
+		SkeletonData *data;
+	};
+
+	size_t fileSize(const std::string &path) {
+		FILE *file = fopen(path.c_str(), "rb");
+		if (!file) return 0;
+		fseek(file, 0, SEEK_END);
+		size_t size = (size_t) ftell(file);
+		fclose(file);
+		return size;
+	}
+
+	// A size in KB from /proc/self/status, eg "VmRSS:" or the peak "VmHWM:", 0 where it is not available.
+	size_t residentSize(const char *field) {
+		size_t size = 0;
+		FILE *file = fopen("/proc/self/status", "r");
+		if (!file) return 0;
+		char line[256];
+		size_t fieldLength = strlen(field);
+		while (fgets(line, sizeof(line), file)) {
+			if (!strncmp(line, field, fieldLength)) {
+				size = (size_t) strtoul(line + fieldLength, NULL, 10);
+				break;
+			}
+		}
+		fclose(file);
+		return size;
+	}
+}
+
+static PeakExtension *peakExtension() {
+	return (PeakExtension *) SpineExtension::getInstance();
+}
+
+namespace spine {
+	SpineExtension *getDefaultExtension() {
+		static PeakExtension extension;
+		return &extension;
+	}
+}
+
+static void compare(const TestRig &rig, Load &mapped, Load &copied) {
+	Vector<AtlasRegion *> &mappedRegions = mapped.atlas->getRegions(), &copiedRegions = copied.atlas->getRegions();
+	CHECK_MSG(mappedRegions.size() == copiedRegions.size(), "%s: region count", rig.atlas);
+	for (size_t i = 0; i < mappedRegions.size() && i < copiedRegions.size(); i++) {
+		CHECK_MSG(mappedRegions[i]->name == copiedRegions[i]->name && mappedRegions[i]->x == copiedRegions[i]->x &&
+						  mappedRegions[i]->y == copiedRegions[i]->y && mappedRegions[i]->width == copiedRegions[i]->width,
+				  "%s: region %s", rig.atlas, copiedRegions[i]->name.buffer());
+	}
+
+	SkeletonData &a = *mapped.data, &b = *copied.data;
+	CHECK_MSG(a.getBones().size() == b.getBones().size() && a.getSlots().size() == b.getSlots().size() &&
+					  a.getSkins().size() == b.getSkins().size() && a.getAnimations().size() == b.getAnimations().size(),
+			  "%s: counts", rig.skeleton);
+	for (size_t i = 0; i < a.getBones().size() && i < b.getBones().size(); i++) {
+		BoneData *boneA = a.getBones()[i], *boneB = b.getBones()[i];
+		CHECK_MSG(boneA->getName() == boneB->getName() && boneA->getX() == boneB->getX() &&
+						  boneA->getRotation() == boneB->getRotation() && boneA->getLength() == boneB->getLength(),
+				  "%s: bone %s", rig.skeleton, boneB->getName().buffer());
+	}
+	for (size_t i = 0; i < a.getSkins().size() && i < b.getSkins().size(); i++) {
+		Vector<Attachment *> attachmentsA, attachmentsB;
+		a.getSkins()[i]->findAttachmentsForSlot(0, attachmentsA);
+		b.getSkins()[i]->findAttachmentsForSlot(0, attachmentsB);
+		CHECK_MSG(a.getSkins()[i]->getName() == b.getSkins()[i]->getName() && attachmentsA.size() == attachmentsB.size(),
+				  "%s: skin %s", rig.skeleton, b.getSkins()[i]->getName().buffer());
+	}
+	for (size_t i = 0; i < a.getAnimations().size() && i < b.getAnimations().size(); i++) {
+		Animation *animationA = a.getAnimations()[i], *animationB = b.getAnimations()[i];
+		CHECK_MSG(animationA->getName() == animationB->getName() &&
+						  animationA->getDuration() == animationB->getDuration() &&
+						  animationA->getTimelines().size() == animationB->getTimelines().size(),
+				  "%s: animation %s", rig.skeleton, animationB->getName().buffer());
+	}
+}
+
+static Load load(const TestRig &rig, TextureLoader &textureLoader) {
+	Load load;
+	load.atlas = new Atlas(assetPath(rig.atlas).c_str(), &textureLoader);
+	load.data = readSkeletonData(*load.atlas, assetPath(rig.skeleton));
+	return load;
+}
+
+static void unload(Load &load) {
+	delete load.data;
+	delete load.atlas;
+}
+
+// The peak heap above the bytes in use before, while loading the atlas and then the skeleton data.
+static void measurePeak(const TestRig &rig, TextureLoader &textureLoader, bool mapping, size_t &atlasPeak,
+						size_t &skeletonPeak) {
+	PeakExtension *extension = peakExtension();
+	extension->mapping = mapping;
+	size_t before = extension->used;
+	extension->resetPeak();
+	Atlas *atlas = new Atlas(assetPath(rig.atlas).c_str(), &textureLoader);
+	atlasPeak = extension->peak - before;
+	before = extension->used;
+	extension->resetPeak();
+	SkeletonData *data = readSkeletonData(*atlas, assetPath(rig.skeleton));
+	skeletonPeak = extension->peak - before;
+	delete data;
+	delete atlas;
+	extension->mapping = true;
+}
+
+struct Batch {
+	double milliseconds;
+	size_t peakResident;
+	int failures;
+};
+
+// Loads a batch of the rig, keeping every load alive until the end. On Linux the batch runs in a forked process, so its
+// peak resident set size is not raised by batches run before it.
+static Batch loadBatch(const TestRig &rig, TextureLoader &textureLoader, bool mapping) {
+	Batch result = {0, 0, 0};
+#ifdef __linux__
+	int fds[2];
+	if (pipe(fds) != 0) return result;
+	pid_t child = fork();
+	if (child != 0) {
+		close(fds[1]);
+		if (read(fds[0], &result, sizeof(result)) != (ssize_t) sizeof(result)) result.failures = 1;
+		close(fds[0]);
+		waitpid(child, NULL, 0);
+		return result;
+	}
+	close(fds[0]);
+	size_t resident = residentSize("VmRSS:");
+#endif
+	const int batch = 200;
+	peakExtension()->mapping = mapping;
+	int failures = testFailures;
+	std::vector<Load> loads(batch);
+	std::chrono::high_resolution_clock::time_point t0 = std::chrono::high_resolution_clock::now();
+	for (int i = 0; i < batch; i++)
+		loads[i] = load(rig, textureLoader);
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	for (int i = 0; i < batch; i++)
+		unload(loads[i]);
+	peakExtension()->mapping = true;
+	result.milliseconds = std::chrono::duration<double, std::milli>(t1 - t0).count();
+	result.failures = testFailures - failures;
+#ifdef __linux__
+	result.peakResident = residentSize("VmHWM:") - resident;
+	if (write(fds[1], &result, sizeof(result)) != (ssize_t) sizeof(result)) _exit(1);
+	_exit(0);
+#endif
+	return result;
+}
+
+static void testRig(const TestRig &rig) {
+	TestTextureLoader textureLoader;
+
+	peakExtension()->mapping = false;
+	Load copied = load(rig, textureLoader);
+	peakExtension()->mapping = true;
+	Load mapped = load(rig, textureLoader);
+	if (!copied.data || !mapped.data) {
+		unload(copied);
+		unload(mapped);
+		return;
+	}
+	compare(rig, mapped, copied);
+	unload(copied);
+	unload(mapped);
+
+	size_t atlasSize = fileSize(assetPath(rig.atlas)), skeletonSize = fileSize(assetPath(rig.skeleton));
+	size_t mappedAtlasPeak, mappedSkeletonPeak, copiedAtlasPeak, copiedSkeletonPeak;
+	measurePeak(rig, textureLoader, true, mappedAtlasPeak, mappedSkeletonPeak);
+	measurePeak(rig, textureLoader, false, copiedAtlasPeak, copiedSkeletonPeak);
+	CHECK_MSG(copiedAtlasPeak == mappedAtlasPeak + atlasSize, "%s: peak heap %zu mapped, %zu copied, file %zu", rig.atlas,
+			  mappedAtlasPeak, copiedAtlasPeak, atlasSize);
+	CHECK_MSG(copiedSkeletonPeak == mappedSkeletonPeak + skeletonSize, "%s: peak heap %zu mapped, %zu copied, file %zu",
+			  rig.skeleton, mappedSkeletonPeak, copiedSkeletonPeak, skeletonSize);
+
+	Batch copiedBatch = loadBatch(rig, textureLoader, false);
+	Batch mappedBatch = loadBatch(rig, textureLoader, true);
+	CHECK_MSG(!copiedBatch.failures && !mappedBatch.failures, "%s: batch", rig.skeleton);
+	printf("%-32s peak heap %zu KB mapped, %zu KB copied; 200 loads %.1f ms mapped, %.1f ms copied; peak RSS +%zu KB "
+		   "mapped, +%zu KB copied\n",
+		   rig.skeleton, (mappedAtlasPeak > mappedSkeletonPeak ? mappedAtlasPeak : mappedSkeletonPeak) / 1024,
+		   (copiedAtlasPeak > copiedSkeletonPeak ? copiedAtlasPeak : copiedSkeletonPeak) / 1024, mappedBatch.milliseconds,
+		   copiedBatch.milliseconds, mappedBatch.peakResident, copiedBatch.peakResident);
+}
+
+int main() {
+	for (size_t r = 0; r < testRigCount; r++) {
+		if (!strcmp(testRigs[r].skeleton, "snowglobe/snowglobe-pro.skel") ||
+			!strcmp(testRigs[r].skeleton, "raptor/raptor-pro.skel") ||
+			!strcmp(testRigs[r].skeleton, "spineboy-pma/spineboy-pro.skel"))
+			testRig(testRigs[r]);
+	}
+	return testResult();
+}
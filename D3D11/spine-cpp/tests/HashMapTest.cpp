@@ -0,0 +1,314 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated April 5, 2025. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2025, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+// HashMap: random put, remove, find, reserve and clear sequences are replayed on a std::map, for integer, PropertyId and
+// String keys, and the map's contents and iteration must match after every step. A hash putting every key in a few buckets
+// makes long probe runs that wrap around the table, to exercise the backward shift of remove(). Every allocation must be
+// freed once the maps are deleted. Then the property ids of chibi-stickers and snowglobe are inserted and looked up the way
+// AnimationState does each time its animations change, timed against std::map.
+
+#include "TestUtil.h"
+#include <chrono>
+#include <map>
+#include <vector>
+
+using namespace spine;
+
+namespace {
+	class CountingExtension : public DefaultSpineExtension {
+	public:
+		CountingExtension() : allocations(0), frees(0) {
+		}
+
+		void *_alloc(size_t size, const char *file, int line) {
+			allocations++;
+			return DefaultSpineExtension::_alloc(size, file, line);
+		}
+
+		void *_calloc(size_t size, const char *file, int line) {
+			allocations++;
+			return DefaultSpineExtension::_calloc(size, file, line);
+		}
+
+		void *_realloc(void *ptr, size_t size, const char *file, int line) {
+			if (!ptr) allocations++;
+			return DefaultSpineExtension::_realloc(ptr, size, file, line);
+		}
+
+		void _free(void *mem, const char *file, int line) {
+			if (mem) frees++;
+			DefaultSpineExtension::_free(mem, file, line);
+		}
+
+		size_t allocations, frees;
+	};
+
+	// xorshift32, so runs are reproducible on every platform.
+	class Random {
+	public:
+		explicit Random(uint32_t seed) : _state(seed) {
+		}
+
+		uint32_t next(uint32_t bound) {
+			_state ^= _state << 13;
+			_state ^= _state >> 17;
+			_state ^= _state << 5;
+			return _state % bound;
+		}
+
+	private:
+		uint32_t _state;
+	};
+
+	// Puts every key in one of the last 4 slots, so probe runs wrap around to the start of the table.
+	struct ClusteredHash {
+		size_t operator()(const int &key) const {
+			return ~(size_t) (key & 3);
+		}
+	};
+
+	struct IntKeys {
+		typedef int Key;
+		typedef HashMapHash<int> Hash;
+
+		static int key(uint32_t i) {
+			return (int) i;
+		}
+	};
+
+	struct ClusteredKeys {
+		typedef int Key;
+		typedef ClusteredHash Hash;
+
+		static int key(uint32_t i) {
+			return (int) i * 7;
+		}
+	};
+
+	// Property ids put the property in the high bits and the bone or slot index in the low ones.
+	struct PropertyKeys {
+		typedef PropertyId Key;
+		typedef HashMapHash<PropertyId> Hash;
+
+		static PropertyId key(uint32_t i) {
+			return ((PropertyId) (i % 19) << 32) | (i / 19);
+		}
+	};
+
+	struct StringKeys {
+		typedef String Key;
+		typedef HashMapHash<String> Hash;
+
+		static String key(uint32_t i) {
+			String key("bone");
+			key.append((int) i);
+			return key;
+		}
+	};
+
+	String value(uint32_t i) {
+		String value("value");
+		value.append((int) i);
+		return value;
+	}
+}
+
+static CountingExtension *countingExtension() {
+	return (CountingExtension *) SpineExtension::getInstance();
+}
+
+namespace spine {
+	SpineExtension *getDefaultExtension() {
+		static CountingExtension extension;
+		return &extension;
+	}
+}
+
+static bool keyLess(int a, int b) {
+	return a < b;
+}
+
+static bool keyLess(PropertyId a, PropertyId b) {
+	return a < b;
+}
+
+static bool keyLess(const String &a, const String &b) {
+	return strcmp(a.buffer(), b.buffer()) < 0;
+}
+
+template<typename Keys, typename Map>
+static bool matches(const char *name, int step, HashMap<typename Keys::Key, String, typename Keys::Hash> &map, Map &expected) {
+	bool ok = true;
+	if (map.size() != expected.size()) {
+		CHECK_MSG(false, "%s step %d: size %zu, expected %zu", name, step, map.size(), expected.size());
+		return false;
+	}
+	// Iteration visits every entry once.
+	size_t visited = 0;
+	typename HashMap<typename Keys::Key, String, typename Keys::Hash>::Entries entries = map.getEntries();
+	while (entries.hasNext()) {
+		typename HashMap<typename Keys::Key, String, typename Keys::Hash>::Pair pair = entries.next();
+		typename Map::iterator found = expected.find(pair.key);
+		if (found == expected.end() || !(found->second == pair.value)) {
+			CHECK_MSG(false, "%s step %d: iterated an entry not in the std::map", name, step);
+			ok = false;
+		}
+		visited++;
+	}
+	if (visited != expected.size()) {
+		CHECK_MSG(false, "%s step %d: iterated %zu entries, expected %zu", name, step, visited, expected.size());
+		ok = false;
+	}
+	for (typename Map::iterator it = expected.begin(); it != expected.end(); ++it) {
+		if (!map.containsKey(it->first) || !(map[it->first] == it->second)) {
+			CHECK_MSG(false, "%s step %d: an entry of the std::map is missing", name, step);
+			ok = false;
+		}
+	}
+	return ok;
+}
+
+/// Replays random operations on keys 0 to keyCount - 1. Removes are as likely as puts, so the map churns around half full.
+template<typename Keys>
+static void testChurn(const char *name, uint32_t keyCount, int steps) {
+	typedef typename Keys::Key Key;
+	struct Less {
+		bool operator()(const Key &a, const Key &b) const {
+			return keyLess(a, b);
+		}
+	};
+	std::map<Key, String, Less> expected;
+	HashMap<Key, String, typename Keys::Hash> map;
+	Random random(0x9e3779b9u ^ keyCount);
+	for (int step = 0; step < steps; step++) {
+		uint32_t i = random.next(keyCount);
+		Key key = Keys::key(i);
+		uint32_t op = random.next(100);
+		if (op < 45) {
+			String v = value(i + (uint32_t) step);
+			map.put(key, v);
+			expected[key] = v;
+		} else if (op < 90) {
+			bool removed = map.remove(key);
+			CHECK_MSG(removed == (expected.erase(key) == 1), "%s step %d: remove", name, step);
+		} else if (op < 97) {
+			CHECK_MSG(map.containsKey(key) == (expected.count(key) == 1), "%s step %d: containsKey", name, step);
+		} else if (op < 99) {
+			map.reserve(expected.size() + random.next(keyCount));
+		} else if (random.next(10) == 0) {
+			map.clear();
+			expected.clear();
+		}
+		if ((step & 63) == 0 || op >= 97) {
+			if (!matches<Keys>(name, step, map, expected)) return;
+		}
+	}
+	matches<Keys>(name, steps, map, expected);
+
+	// Removing everything in random order leaves an empty map that still finds nothing.
+	std::vector<Key> keys;
+	for (typename std::map<Key, String, Less>::iterator it = expected.begin(); it != expected.end(); ++it)
+		keys.push_back(it->first);
+	while (!keys.empty()) {
+		size_t index = random.next((uint32_t) keys.size());
+		CHECK_MSG(map.remove(keys[index]), "%s: remove while emptying", name);
+		expected.erase(keys[index]);
+		keys[index] = keys.back();
+		keys.pop_back();
+		if (keys.size() % 16 == 0 && !matches<Keys>(name, steps, map, expected)) return;
+	}
+	CHECK(map.size() == 0);
+	for (uint32_t i = 0; i < keyCount; i++)
+		CHECK(!map.containsKey(Keys::key(i)));
+}
+
+static void benchmark(const TestRig &rig) {
+	TestTextureLoader textureLoader;
+	Atlas atlas(assetPath(rig.atlas).c_str(), &textureLoader);
+	SkeletonData *data = readSkeletonData(atlas, assetPath(rig.skeleton));
+	if (!data) return;
+	std::vector<PropertyId> ids;
+	Vector<Animation *> &animations = data->getAnimations();
+	for (size_t i = 0; i < animations.size(); i++) {
+		Vector<Timeline *> &timelines = animations[i]->getTimelines();
+		for (size_t ii = 0; ii < timelines.size(); ii++) {
+			Vector<PropertyId> &propertyIds = timelines[ii]->getPropertyIds();
+			for (size_t iii = 0; iii < propertyIds.size(); iii++)
+				ids.push_back(propertyIds[iii]);
+		}
+	}
+	delete data;
+
+	// As AnimationState::animationsChanged() and computeHold(): clear, then add each property id, noting those already there.
+	const int rounds = 200;
+	HashMap<PropertyId, bool> map;
+	std::map<PropertyId, bool> expected;
+	size_t found = 0, expectedFound = 0;
+	std::chrono::high_resolution_clock::time_point t0 = std::chrono::high_resolution_clock::now();
+	for (int round = 0; round < rounds; round++) {
+		map.clear();
+		for (size_t i = 0; i < ids.size(); i++) {
+			if (map.containsKey(ids[i]))
+				found++;
+			else
+				map.put(ids[i], true);
+		}
+	}
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	for (int round = 0; round < rounds; round++) {
+		expected.clear();
+		for (size_t i = 0; i < ids.size(); i++) {
+			if (!expected.insert(std::make_pair(ids[i], true)).second) expectedFound++;
+		}
+	}
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+	CHECK_MSG(found == expectedFound && map.size() == expected.size(), "%s: property ids", rig.skeleton);
+	double operations = (double) rounds * ids.size();
+	printf("%-40s %zu property ids, %zu distinct: HashMap %.1f ns, std::map %.1f ns per id\n", rig.skeleton, ids.size(),
+		   expected.size(), std::chrono::duration<double, std::nano>(t1 - t0).count() / operations,
+		   std::chrono::duration<double, std::nano>(t2 - t1).count() / operations);
+}
+
+int main() {
+	size_t live = countingExtension()->allocations - countingExtension()->frees;
+	testChurn<IntKeys>("int", 64, 20000);
+	testChurn<IntKeys>("int large", 5000, 50000);
+	testChurn<ClusteredKeys>("clustered", 48, 20000);
+	testChurn<PropertyKeys>("PropertyId", 1000, 30000);
+	testChurn<StringKeys>("String", 300, 20000);
+	size_t leaked = countingExtension()->allocations - countingExtension()->frees - live;
+	CHECK_MSG(leaked == 0, "%zu allocations not freed", leaked);
+
+	for (size_t r = 0; r < testRigCount; r++) {
+		if (!strcmp(testRigs[r].skeleton, "chibi-stickers/chibi-stickers.skel") ||
+			!strcmp(testRigs[r].skeleton, "snowglobe/snowglobe-pro.skel"))
+			benchmark(testRigs[r]);
+	}
+	return testResult();
+}
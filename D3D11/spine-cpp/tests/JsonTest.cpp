@@ -0,0 +1,429 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated April 5, 2025. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2025, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+// Json against a plain reference parser: every sample .json skeleton, a copy with all strings escaped and a document of
+// edge cases must give the same tree. Numbers must match strtof() bit for bit and strings the decoded escapes. The peak heap
+// of parsing each skeleton must be exactly the document, the text copy and the node blocks. It may exceed the peak of a tree
+// allocating every node and string separately by at most the text and one block, and both are printed.
+
+#include "TestUtil.h"
+#include <stdlib.h>
+#include <vector>
+
+using namespace spine;
+
+namespace {
+	// Keeps the size of each allocation in front of it, to track the bytes in use and their peak.
+	class PeakExtension : public DefaultSpineExtension {
+	public:
+		PeakExtension() : used(0), peak(0) {
+		}
+
+		void *_alloc(size_t size, const char *file, int line) {
+			if (size == 0) return NULL;
+			return track(DefaultSpineExtension::_alloc(size + Header, file, line), size);
+		}
+
+		void *_calloc(size_t size, const char *file, int line) {
+			if (size == 0) return NULL;
+			return track(DefaultSpineExtension::_calloc(size + Header, file, line), size);
+		}
+
+		void *_realloc(void *ptr, size_t size, const char *file, int line) {
+			if (!ptr) return _alloc(size, file, line);
+			char *block = (char *) ptr - Header;
+			used -= *(size_t *) block;
+			return track(DefaultSpineExtension::_realloc(block, size + Header, file, line), size);
+		}
+
+		void _free(void *mem, const char *file, int line) {
+			if (!mem) return;
+			char *block = (char *) mem - Header;
+			used -= *(size_t *) block;
+			DefaultSpineExtension::_free(block, file, line);
+		}
+
+		void resetPeak() {
+			peak = used;
+		}
+
+		size_t used;
+		size_t peak;
+
+	private:
+		static const size_t Header = 16;
+
+		void *track(void *block, size_t size) {
+			if (!block) return NULL;
+			*(size_t *) block = size;
+			used += size;
+			if (used > peak) peak = used;
+			return (char *) block + Header;
+		}
+	};
+}
+
+static PeakExtension *peakExtension() {
+	return (PeakExtension *) SpineExtension::getInstance();
+}
+
+namespace spine {
+	SpineExtension *getDefaultExtension() {
+		static PeakExtension extension;
+		return &extension;
+	}
+}
+
+namespace {
+	struct Node {
+		int type;
+		std::string name;
+		std::string string;
+		std::string number;
+		std::vector<Node> children;
+	};
+
+	// A straightforward recursive JSON parser, independent of Json.
+	class ReferenceParser {
+	public:
+		explicit ReferenceParser(const std::string &text) : _text(text), _index(0), failed(false) {
+		}
+
+		void parseValue(Node &node) {
+			skip();
+			char c = peek();
+			if (c == '{' || c == '[') {
+				node.type = c == '{' ? Json::JSON_OBJECT : Json::JSON_ARRAY;
+				_index++;
+				skip();
+				if (peek() == (c == '{' ? '}' : ']')) {
+					_index++;
+					return;
+				}
+				while (!failed) {
+					node.children.push_back(Node());
+					Node &child = node.children.back();
+					if (c == '{') {
+						skip();
+						parseString(child.name);
+						skip();
+						expect(':');
+					}
+					parseValue(child);
+					skip();
+					if (peek() == ',') {
+						_index++;
+						continue;
+					}
+					expect(c == '{' ? '}' : ']');
+					break;
+				}
+			} else if (c == '"') {
+				node.type = Json::JSON_STRING;
+				parseString(node.string);
+			} else if (_text.compare(_index, 4, "true") == 0) {
+				node.type = Json::JSON_TRUE;
+				_index += 4;
+			} else if (_text.compare(_index, 5, "false") == 0) {
+				node.type = Json::JSON_FALSE;
+				_index += 5;
+			} else if (_text.compare(_index, 4, "null") == 0) {
+				node.type = Json::JSON_NULL;
+				_index += 4;
+			} else {
+				node.type = Json::JSON_NUMBER;
+				size_t start = _index;
+				while (_index < _text.size() && strchr("+-.0123456789eE", _text[_index])) _index++;
+				node.number = _text.substr(start, _index - start);
+				if (node.number.empty()) failed = true;
+			}
+		}
+
+	private:
+		const std::string &_text;
+		size_t _index;
+
+	public:
+		bool failed;
+
+	private:
+		char peek() {
+			return _index < _text.size() ? _text[_index] : 0;
+		}
+
+		void skip() {
+			while (_index < _text.size() && (unsigned char) _text[_index] <= ' ') _index++;
+		}
+
+		void expect(char c) {
+			if (peek() != c) failed = true;
+			_index++;
+		}
+
+		unsigned hex4() {
+			unsigned value = (unsigned) strtoul(_text.substr(_index, 4).c_str(), NULL, 16);
+			_index += 4;
+			return value;
+		}
+
+		void parseString(std::string &out) {
+			expect('"');
+			while (!failed && peek() != '"') {
+				char c = _text[_index++];
+				if (c != '\\') {
+					out += c;
+					continue;
+				}
+				c = _text[_index++];
+				switch (c) {
+					case 'b': out += '\b'; break;
+					case 'f': out += '\f'; break;
+					case 'n': out += '\n'; break;
+					case 'r': out += '\r'; break;
+					case 't': out += '\t'; break;
+					case 'u': {
+						unsigned code = hex4();
+						if (code >= 0xD800 && code <= 0xDBFF) {
+							_index += 2;
+							code = 0x10000 + (((code & 0x3FF) << 10) | (hex4() & 0x3FF));
+						}
+						if (code < 0x80)
+							out += (char) code;
+						else if (code < 0x800) {
+							out += (char) (0xC0 | (code >> 6));
+							out += (char) (0x80 | (code & 0x3F));
+						} else if (code < 0x10000) {
+							out += (char) (0xE0 | (code >> 12));
+							out += (char) (0x80 | ((code >> 6) & 0x3F));
+							out += (char) (0x80 | (code & 0x3F));
+						} else {
+							out += (char) (0xF0 | (code >> 18));
+							out += (char) (0x80 | ((code >> 12) & 0x3F));
+							out += (char) (0x80 | ((code >> 6) & 0x3F));
+							out += (char) (0x80 | (code & 0x3F));
+						}
+						break;
+					}
+					default: out += c;
+				}
+			}
+			expect('"');
+		}
+	};
+
+	struct Mismatches {
+		int structure, numbers, strings;
+	};
+
+	void compare(Json *json, const Node &node, Mismatches &mismatches) {
+		if (json->getType() != node.type || json->getSize() != (int) node.children.size() ||
+			std::string(json->getName() ? json->getName() : "") != node.name) {
+			mismatches.structure++;
+			return;
+		}
+		if (node.type == Json::JSON_NUMBER) {
+			// The int conversion is only defined in range.
+			float expected = strtof(node.number.c_str(), NULL), actual = json->getValueFloat();
+			double value = strtod(node.number.c_str(), NULL);
+			bool intMatches = !(value > -2147483649.0 && value < 2147483648.0) || json->getValueInt() == (int) value;
+			if (memcmp(&expected, &actual, sizeof(float)) != 0 || !intMatches) mismatches.numbers++;
+		} else if (node.type == Json::JSON_STRING) {
+			if (node.string != json->getValueString()) mismatches.strings++;
+		}
+		Json *child = json->getChild();
+		for (size_t i = 0; i < node.children.size(); i++, child = child->getNext()) {
+			if (!child) {
+				mismatches.structure++;
+				return;
+			}
+			compare(child, node.children[i], mismatches);
+		}
+	}
+
+	// Rewrites the content of every string with escapes, a different escape for each character in turn, so escapes fall on
+	// every position of the SSE2 scan.
+	std::string escapeStrings(const std::string &text) {
+		std::string out;
+		bool inString = false;
+		int count = 0;
+		char buffer[8];
+		for (size_t i = 0; i < text.size(); i++) {
+			char c = text[i];
+			if (c == '"') {
+				inString = !inString;
+				out += c;
+			} else if (!inString || (unsigned char) c >= 0x80) {
+				out += c;
+			} else if (c == '\\') {
+				out += c;
+				out += text[++i];
+			} else {
+				switch (count++ % 4) {
+					case 0:
+						out += c;
+						break;
+					case 1:
+						snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+						out += buffer;
+						break;
+					case 2:
+						snprintf(buffer, sizeof(buffer), "\\u%04X", c);
+						out += buffer;
+						break;
+					default:
+						if (!strchr("bfnrtu", c)) out += '\\';
+						out += c;
+				}
+			}
+		}
+		return out;
+	}
+
+	void check(const char *label, const std::string &text, int *numberCount = NULL) {
+		ReferenceParser reference(text);
+		Node root;
+		reference.parseValue(root);
+		CHECK_MSG(!reference.failed, "%s: reference parse failed", label);
+		Json json(text.c_str(), (int) text.size());
+		CHECK_MSG(Json::getError() == NULL, "%s: %s", label, Json::getError());
+		Mismatches mismatches = {0, 0, 0};
+		compare(&json, root, mismatches);
+		CHECK_MSG(mismatches.structure == 0, "%s: %d items differ", label, mismatches.structure);
+		CHECK_MSG(mismatches.numbers == 0, "%s: %d numbers differ", label, mismatches.numbers);
+		CHECK_MSG(mismatches.strings == 0, "%s: %d strings differ", label, mismatches.strings);
+		if (numberCount) {
+			std::vector<const Node *> stack(1, &root);
+			while (!stack.empty()) {
+				const Node *node = stack.back();
+				stack.pop_back();
+				if (node->type == Json::JSON_NUMBER) (*numberCount)++;
+				for (size_t i = 0; i < node->children.size(); i++) stack.push_back(&node->children[i]);
+			}
+		}
+	}
+
+	// The nodes below and including node, and the bytes of their NUL terminated names and strings.
+	void countTree(const Node &node, size_t &nodes, size_t &stringBytes) {
+		nodes++;
+		if (!node.name.empty()) stringBytes += node.name.size() + 1;
+		if (node.type == Json::JSON_STRING) stringBytes += node.string.size() + 1;
+		for (size_t i = 0; i < node.children.size(); i++) countTree(node.children[i], nodes, stringBytes);
+	}
+
+	// The text copy and node blocks are kept until the tree is deleted, so the peak is known exactly from the text size and
+	// node count. A tree allocating each node and string separately would peak at the nodes plus the strings instead.
+	void checkPeak(const char *label, const std::string &text) {
+		ReferenceParser reference(text);
+		Node root;
+		reference.parseValue(root);
+		size_t nodes = 0, stringBytes = 0;
+		countTree(root, nodes, stringBytes);
+		const size_t blockNodes = 1024, textPadding = 16, documentSize = 4 * sizeof(void *);
+		size_t blocks = (nodes - 1 + blockNodes - 1) / blockNodes;
+		size_t expected = documentSize + text.size() + 1 + textPadding + blocks * (sizeof(void *) + blockNodes * sizeof(Json));
+
+		PeakExtension *extension = peakExtension();
+		size_t before = extension->used;
+		extension->resetPeak();
+		{
+			Json json(text.c_str(), (int) text.size());
+		}
+		size_t peak = extension->peak - before;
+		CHECK_MSG(extension->used == before, "%s: %zu bytes not freed", label, extension->used - before);
+		CHECK_MSG(peak == expected, "%s: peak heap %zu, expected %zu", label, peak, expected);
+		size_t separate = nodes * sizeof(Json) + stringBytes;
+		CHECK_MSG(peak <= separate + text.size() + sizeof(void *) + blockNodes * sizeof(Json),
+				  "%s: peak heap %zu is more than the text and a block above %zu", label, peak, separate);
+		printf("%-40s text %zu KB, peak heap %zu KB in place, %zu KB allocating nodes and strings separately\n", label,
+			   text.size() / 1024, peak / 1024, separate / 1024);
+	}
+
+	std::string readFile(const std::string &path) {
+		std::string text;
+		FILE *file = fopen(path.c_str(), "rb");
+		CHECK_MSG(file, "%s: not found", path.c_str());
+		if (!file) return text;
+		char buffer[4096];
+		size_t read;
+		while ((read = fread(buffer, 1, sizeof(buffer), file)) > 0) text.append(buffer, read);
+		fclose(file);
+		return text;
+	}
+}
+
+int main() {
+	int numberCount = 0;
+	for (size_t r = 0; r < testRigCount; r++) {
+		if (!testRigs[r].json) continue;
+		std::string path = assetPath(testRigs[r].json);
+		std::string text = readFile(path);
+		check(path.c_str(), text, &numberCount);
+		check((path + " escaped").c_str(), escapeStrings(text));
+		checkPeak(testRigs[r].json, text);
+	}
+	CHECK_MSG(numberCount > 50000, "only %d numbers checked", numberCount);
+
+	// Strings of every length around the 16 byte scan width, escapes at the edges, and numbers in and out of the exact range.
+	std::string edge = "{\"strings\":[";
+	for (int length = 0; length < 40; length++) {
+		edge += length ? ",\"" : "\"";
+		for (int i = 0; i < length; i++) edge += (char) ('a' + i % 26);
+		edge += "\",\"\\t";
+		for (int i = 0; i < length; i++) edge += (char) ('A' + i % 26);
+		edge += "\\\"\"";
+	}
+	edge += "],\"escapes\":\"\\b\\f\\n\\r\\t\\\"\\\\\\/\\u00e9\\u20ac\\ud83d\\ude00\",\"\\u006eame\":1,";
+	edge += "\"numbers\":[0,-0,1,-1,0.1,-0.5,1.5e3,2E-3,1e+2,16777217,16777216.5,0.30000001192092896,3.4028235e38,";
+	edge += "1e-45,1.17549435e-38,123456789,2147483647,-2147483648,9007199254740993,1234567890123456789012,";
+	edge += "0.000001,100000000000000000000,7.038531e-26,-12.125,0.0009765625,1e22,1e23,5e-324]}";
+	check("edge cases", edge);
+
+	// Random numbers with 1 to 25 digits, a decimal point anywhere and exponents on both sides of the exact range.
+	std::string random = "[";
+	unsigned long long seed = 12345;
+	char buffer[64];
+	for (int i = 0; i < 100000; i++) {
+		seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+		int digits = 1 + (int) ((seed >> 33) % 25), point = (int) ((seed >> 40) % (digits + 1)), exponent = (int) ((seed >> 48) % 81) - 40;
+		std::string number = (seed >> 20) & 1 ? "-" : "";
+		for (int d = 0; d < digits; d++) {
+			seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+			if (d == point && d > 0) number += '.';
+			number += (char) ('0' + (seed >> 33) % 10);
+		}
+		if ((seed >> 50) & 1) {
+			snprintf(buffer, sizeof(buffer), "e%d", exponent);
+			number += buffer;
+		}
+		random += i ? "," + number : number;
+	}
+	random += "]";
+	check("random numbers", random);
+	return testResult();
+}
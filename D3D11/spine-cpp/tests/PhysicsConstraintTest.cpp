@@ -0,0 +1,144 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated April 5, 2025. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2025, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+// PhysicsConstraint: the rigs with physics are held in their setup pose so every moving constraint substeps each update, and
+// the substeps reported by Skeleton::getPhysicsSteps() must add up to the time passed. After a long time jump, a step cap
+// must limit every constraint to that many substeps and report the dropped time, and a cap that is never reached must give
+// bit identical world transforms to no cap.
+
+#include "TestUtil.h"
+#include <cmath>
+
+using namespace spine;
+
+namespace spine {
+	SpineExtension *getDefaultExtension() {
+		static DefaultSpineExtension extension;
+		return &extension;
+	}
+}
+
+static const float delta = 1 / 60.0f, jump = 2;
+
+// Constraints that substep: active, mixed and with at least one property.
+static int movingConstraints(Skeleton &skeleton, float &expectedSteps, float time, float &maxStep) {
+	Vector<PhysicsConstraint *> &constraints = skeleton.getPhysicsConstraints();
+	int count = 0;
+	expectedSteps = 0;
+	maxStep = 0;
+	for (size_t i = 0; i < constraints.size(); i++) {
+		PhysicsConstraint &constraint = *constraints[i];
+		PhysicsConstraintData &data = constraint.getData();
+		if (!constraint.isActive() || constraint.getMix() == 0) continue;
+		if (data.getX() <= 0 && data.getY() <= 0 && data.getRotate() <= 0 && data.getShearX() <= 0 && data.getScaleX() <= 0) continue;
+		count++;
+		expectedSteps += time / data.getStep();
+		maxStep = MathUtil::max(maxStep, data.getStep());
+	}
+	return count;
+}
+
+static void update(Skeleton &skeleton, float time) {
+	skeleton.update(time);
+	skeleton.updateWorldTransform(Physics_Update);
+}
+
+static bool sameWorld(Skeleton &a, Skeleton &b) {
+	for (size_t i = 0; i < a.getBones().size(); i++) {
+		Bone &boneA = *a.getBones()[i], &boneB = *b.getBones()[i];
+		if (boneA.getA() != boneB.getA() || boneA.getB() != boneB.getB() || boneA.getC() != boneB.getC() ||
+			boneA.getD() != boneB.getD() || boneA.getWorldX() != boneB.getWorldX() || boneA.getWorldY() != boneB.getWorldY())
+			return false;
+	}
+	return true;
+}
+
+static void testSteps(Atlas &atlas, const std::string &path) {
+	SkeletonData *data = readSkeletonData(atlas, path);
+	if (!data) return;
+	{
+		Skeleton uncapped(data), unreached(data), capped(data);
+		unreached.setPhysicsMaxSteps(1000);
+		capped.setPhysicsMaxSteps(4);
+		Skeleton *skeletons[] = {&uncapped, &unreached, &capped};
+		for (int s = 0; s < 3; s++)
+			update(*skeletons[s], 0);
+
+		// Moves the skeleton around so the constraints have something to do.
+		int steps = 0, frames = 120, mismatches = 0;
+		for (int frame = 0; frame < frames; frame++) {
+			for (int s = 0; s < 3; s++) {
+				skeletons[s]->setX(std::sin(frame * 0.2f) * 50);
+				update(*skeletons[s], delta);
+			}
+			steps += uncapped.getPhysicsSteps();
+			CHECK(uncapped.getPhysicsTimeDropped() == 0 && capped.getPhysicsTimeDropped() == 0);
+			if (!sameWorld(uncapped, unreached) || !sameWorld(uncapped, capped)) mismatches++;
+		}
+		float expected, maxStep;
+		int moving = movingConstraints(uncapped, expected, frames * delta, maxStep);
+		CHECK_MSG(moving > 0, "%s: no moving physics constraints", path.c_str());
+		// Each constraint may take one substep more or less than its share of the time, plus rounding.
+		CHECK_MSG(std::fabs(steps - expected) <= moving + 0.5f, "%s: %d substeps, %.1f expected", path.c_str(), steps, expected);
+		CHECK_MSG(mismatches == 0, "%s: an unreached cap changed %d frames", path.c_str(), mismatches);
+
+		for (int s = 0; s < 3; s++) {
+			skeletons[s]->setX(200);
+			update(*skeletons[s], jump);
+		}
+		movingConstraints(uncapped, expected, jump, maxStep);
+		CHECK_MSG(std::fabs(uncapped.getPhysicsSteps() - expected) <= moving + 0.5f, "%s: %d substeps for the jump, %.1f expected",
+				  path.c_str(), uncapped.getPhysicsSteps(), expected);
+		CHECK(uncapped.getPhysicsTimeDropped() == 0 && unreached.getPhysicsTimeDropped() == 0);
+		CHECK(sameWorld(uncapped, unreached));
+		CHECK_MSG(capped.getPhysicsSteps() <= 4 * moving && capped.getPhysicsSteps() > 0, "%s: %d substeps with a cap of 4",
+				  path.c_str(), capped.getPhysicsSteps());
+		float dropped = capped.getPhysicsTimeDropped();
+		CHECK_MSG(dropped > jump - 5 * maxStep && dropped <= jump, "%s: %f seconds dropped", path.c_str(), dropped);
+		printf("%-40s %d constraints, %d substeps for a %gs jump, %d with a cap of 4, %.3fs dropped\n", path.c_str(), moving,
+			   uncapped.getPhysicsSteps(), jump, capped.getPhysicsSteps(), dropped);
+
+		for (int frame = 0; frame < 30; frame++) {
+			for (int s = 0; s < 3; s++)
+				update(*skeletons[s], delta);
+			CHECK(sameWorld(uncapped, unreached));
+		}
+	}
+	delete data;
+}
+
+int main() {
+	TestTextureLoader textureLoader;
+	size_t rigs[] = {0, 8};
+	for (size_t r = 0; r < 2; r++) {
+		Atlas atlas(assetPath(testRigs[rigs[r]].atlas).c_str(), &textureLoader);
+		testSteps(atlas, assetPath(testRigs[rigs[r]].skeleton));
+	}
+	return testResult();
+}
@@ -0,0 +1,287 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated April 5, 2025. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2025, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+// RTTI: identity is the address of each class's static rtti object, so a class with the same name in another namespace is
+// a different type, and attachments of custom classes report AttachmentType_Custom. For every attachment and timeline of the
+// sample rigs, getType() must agree with getRTTI(). Then the per frame type checks of SkeletonRenderer and
+// AnimationState::apply() on raptor and spineboy are timed comparing class names as before, comparing rtti addresses, and
+// switching on getType().
+
+#include "TestUtil.h"
+#include <spine/PhysicsConstraintTimeline.h>
+#include <spine/SequenceTimeline.h>
+#include <chrono>
+
+using namespace spine;
+
+namespace spine {
+	SpineExtension *getDefaultExtension() {
+		static DefaultSpineExtension extension;
+		return &extension;
+	}
+}
+
+// Classes named like the runtime's, so only their rtti addresses tell them apart.
+namespace other {
+	class MeshAttachment : public Attachment {
+	RTTI_DECL
+
+	public:
+		explicit MeshAttachment(const String &name) : Attachment(name) {
+		}
+
+		Attachment *copy() {
+			return new (__FILE__, __LINE__) MeshAttachment(getName());
+		}
+	};
+
+	class PathAttachment : public VertexAttachment {
+	RTTI_DECL
+
+	public:
+		explicit PathAttachment(const String &name) : VertexAttachment(name) {
+		}
+
+		Attachment *copy() {
+			return new (__FILE__, __LINE__) PathAttachment(getName());
+		}
+	};
+
+	RTTI_IMPL(MeshAttachment, Attachment)
+
+	RTTI_IMPL(PathAttachment, VertexAttachment)
+}
+
+namespace {
+	struct TypeRTTI {
+		int type;
+		const RTTI *rtti;
+	};
+
+	const TypeRTTI attachmentTypes[] = {
+			{AttachmentType_Region, &RegionAttachment::rtti},
+			{AttachmentType_Boundingbox, &BoundingBoxAttachment::rtti},
+			{AttachmentType_Mesh, &MeshAttachment::rtti},
+			{AttachmentType_Path, &PathAttachment::rtti},
+			{AttachmentType_Point, &PointAttachment::rtti},
+			{AttachmentType_Clipping, &ClippingAttachment::rtti},
+	};
+
+	// The physics constraint property timelines share one type, so those are checked with instanceOf().
+	const TypeRTTI timelineTypes[] = {
+			{TimelineType_Rotate, &RotateTimeline::rtti},
+			{TimelineType_Translate, &TranslateTimeline::rtti},
+			{TimelineType_TranslateX, &TranslateXTimeline::rtti},
+			{TimelineType_TranslateY, &TranslateYTimeline::rtti},
+			{TimelineType_Scale, &ScaleTimeline::rtti},
+			{TimelineType_ScaleX, &ScaleXTimeline::rtti},
+			{TimelineType_ScaleY, &ScaleYTimeline::rtti},
+			{TimelineType_Shear, &ShearTimeline::rtti},
+			{TimelineType_ShearX, &ShearXTimeline::rtti},
+			{TimelineType_ShearY, &ShearYTimeline::rtti},
+			{TimelineType_Inherit, &InheritTimeline::rtti},
+			{TimelineType_RGBA, &RGBATimeline::rtti},
+			{TimelineType_RGB, &RGBTimeline::rtti},
+			{TimelineType_Alpha, &AlphaTimeline::rtti},
+			{TimelineType_RGBA2, &RGBA2Timeline::rtti},
+			{TimelineType_RGB2, &RGB2Timeline::rtti},
+			{TimelineType_Attachment, &AttachmentTimeline::rtti},
+			{TimelineType_Deform, &DeformTimeline::rtti},
+			{TimelineType_Sequence, &SequenceTimeline::rtti},
+			{TimelineType_Event, &EventTimeline::rtti},
+			{TimelineType_DrawOrder, &DrawOrderTimeline::rtti},
+			{TimelineType_IkConstraint, &IkConstraintTimeline::rtti},
+			{TimelineType_TransformConstraint, &TransformConstraintTimeline::rtti},
+			{TimelineType_PathConstraintPosition, &PathConstraintPositionTimeline::rtti},
+			{TimelineType_PathConstraintSpacing, &PathConstraintSpacingTimeline::rtti},
+			{TimelineType_PathConstraintMix, &PathConstraintMixTimeline::rtti},
+			{TimelineType_PhysicsConstraint, &PhysicsConstraintTimeline::rtti},
+			{TimelineType_PhysicsConstraintReset, &PhysicsConstraintResetTimeline::rtti},
+	};
+
+	const RTTI *findRTTI(const TypeRTTI *types, size_t count, int type) {
+		for (size_t i = 0; i < count; i++)
+			if (types[i].type == type) return types[i].rtti;
+		return NULL;
+	}
+
+	// RTTI::isExactly() before it compared addresses.
+	bool sameClassName(const RTTI &a, const RTTI &b) {
+		return strcmp(a.getClassName(), b.getClassName()) == 0;
+	}
+}
+
+static void testIdentity() {
+	other::MeshAttachment mesh("mesh");
+	CHECK(!strcmp(mesh.getRTTI().getClassName(), MeshAttachment::rtti.getClassName()));
+	CHECK(!mesh.getRTTI().isExactly(MeshAttachment::rtti));
+	CHECK(!mesh.getRTTI().instanceOf(VertexAttachment::rtti));
+	CHECK(mesh.getRTTI().isExactly(other::MeshAttachment::rtti));
+	CHECK(mesh.getRTTI().instanceOf(Attachment::rtti));
+	CHECK(mesh.getType() == AttachmentType_Custom);
+
+	other::PathAttachment path("path");
+	CHECK(!path.getRTTI().isExactly(PathAttachment::rtti));
+	CHECK(path.getRTTI().instanceOf(VertexAttachment::rtti));
+	CHECK(path.getRTTI().instanceOf(Attachment::rtti));
+	CHECK(path.getType() == AttachmentType_Custom);
+	CHECK(!MeshAttachment::rtti.instanceOf(other::MeshAttachment::rtti));
+	CHECK(MeshAttachment::rtti.instanceOf(VertexAttachment::rtti));
+	CHECK(!VertexAttachment::rtti.instanceOf(MeshAttachment::rtti));
+
+	Attachment *copy = mesh.copy();
+	CHECK(copy->getRTTI().isExactly(other::MeshAttachment::rtti) && copy->getType() == AttachmentType_Custom);
+	delete copy;
+}
+
+static void testRig(const TestRig &rig) {
+	TestTextureLoader textureLoader;
+	Atlas atlas(assetPath(rig.atlas).c_str(), &textureLoader);
+	SkeletonData *data = readSkeletonData(atlas, assetPath(rig.skeleton));
+	if (!data) return;
+
+	size_t attachmentTypeCount = sizeof(attachmentTypes) / sizeof(attachmentTypes[0]);
+	for (size_t i = 0; i < data->getSkins().size(); i++) {
+		Skin::AttachmentMap::Entries entries = data->getSkins()[i]->getAttachments();
+		while (entries.hasNext()) {
+			Attachment *attachment = entries.next()._attachment;
+			const RTTI *rtti = findRTTI(attachmentTypes, attachmentTypeCount, attachment->getType());
+			bool vertex = attachment->getType() != AttachmentType_Region && attachment->getType() != AttachmentType_Point;
+			CHECK_MSG(rtti && attachment->getRTTI().isExactly(*rtti) &&
+							  attachment->getRTTI().instanceOf(VertexAttachment::rtti) == vertex,
+					  "%s: attachment %s is a %s with type %d", rig.skeleton, attachment->getName().buffer(),
+					  attachment->getRTTI().getClassName(), attachment->getType());
+		}
+	}
+
+	size_t timelineTypeCount = sizeof(timelineTypes) / sizeof(timelineTypes[0]);
+	for (size_t i = 0; i < data->getAnimations().size(); i++) {
+		Vector<Timeline *> &timelines = data->getAnimations()[i]->getTimelines();
+		for (size_t ii = 0; ii < timelines.size(); ii++) {
+			Timeline *timeline = timelines[ii];
+			const RTTI *rtti = findRTTI(timelineTypes, timelineTypeCount, timeline->getType());
+			bool matches = rtti && (timeline->getType() == TimelineType_PhysicsConstraint
+											? timeline->getRTTI().instanceOf(*rtti)
+											: timeline->getRTTI().isExactly(*rtti));
+			CHECK_MSG(matches, "%s: timeline %s with type %d", rig.skeleton, timeline->getRTTI().getClassName(),
+					  timeline->getType());
+		}
+	}
+	delete data;
+}
+
+// Per frame, as SkeletonRenderer: the type of each slot's attachment, and as AnimationState::apply(): the timelines of the
+// animation with the most of them that need special handling.
+static void benchmark(const TestRig &rig) {
+	TestTextureLoader textureLoader;
+	Atlas atlas(assetPath(rig.atlas).c_str(), &textureLoader);
+	SkeletonData *data = readSkeletonData(atlas, assetPath(rig.skeleton));
+	if (!data) return;
+	Vector<Attachment *> attachments;
+	{
+		Skeleton skeleton(data);
+		skeleton.setSkin(data->getDefaultSkin());
+		skeleton.setSlotsToSetupPose();
+		for (size_t i = 0; i < skeleton.getSlots().size(); i++)
+			if (skeleton.getSlots()[i]->getAttachment()) attachments.add(skeleton.getSlots()[i]->getAttachment());
+	}
+	Animation *animation = NULL;
+	for (size_t i = 0; i < data->getAnimations().size(); i++) {
+		if (!animation || data->getAnimations()[i]->getTimelines().size() > animation->getTimelines().size())
+			animation = data->getAnimations()[i];
+	}
+	Vector<Timeline *> &timelines = animation->getTimelines();
+
+	const int frames = 20000;
+	size_t counts[3][6] = {};
+	double nanoseconds[3];
+	for (int method = 0; method < 3; method++) {
+		size_t *count = counts[method];
+		std::chrono::high_resolution_clock::time_point t0 = std::chrono::high_resolution_clock::now();
+		for (int frame = 0; frame < frames; frame++) {
+			for (size_t i = 0; i < attachments.size(); i++) {
+				Attachment *attachment = attachments[i];
+				if (method == 0) {
+					const RTTI &rtti = attachment->getRTTI();
+					if (sameClassName(rtti, RegionAttachment::rtti)) count[0]++;
+					else if (sameClassName(rtti, MeshAttachment::rtti)) count[1]++;
+					else if (sameClassName(rtti, ClippingAttachment::rtti)) count[2]++;
+				} else if (method == 1) {
+					const RTTI &rtti = attachment->getRTTI();
+					if (rtti.isExactly(RegionAttachment::rtti)) count[0]++;
+					else if (rtti.isExactly(MeshAttachment::rtti)) count[1]++;
+					else if (rtti.isExactly(ClippingAttachment::rtti)) count[2]++;
+				} else {
+					AttachmentType type = attachment->getType();
+					if (type == AttachmentType_Region) count[0]++;
+					else if (type == AttachmentType_Mesh) count[1]++;
+					else if (type == AttachmentType_Clipping) count[2]++;
+				}
+			}
+			for (size_t i = 0; i < timelines.size(); i++) {
+				Timeline *timeline = timelines[i];
+				if (method == 0) {
+					const RTTI &rtti = timeline->getRTTI();
+					if (sameClassName(rtti, AttachmentTimeline::rtti)) count[3]++;
+					else if (sameClassName(rtti, DrawOrderTimeline::rtti)) count[4]++;
+					else if (sameClassName(rtti, RotateTimeline::rtti)) count[5]++;
+				} else if (method == 1) {
+					const RTTI &rtti = timeline->getRTTI();
+					if (rtti.isExactly(AttachmentTimeline::rtti)) count[3]++;
+					else if (rtti.isExactly(DrawOrderTimeline::rtti)) count[4]++;
+					else if (rtti.isExactly(RotateTimeline::rtti)) count[5]++;
+				} else {
+					TimelineType type = timeline->getType();
+					if (type == TimelineType_Attachment) count[3]++;
+					else if (type == TimelineType_DrawOrder) count[4]++;
+					else if (type == TimelineType_Rotate) count[5]++;
+				}
+			}
+		}
+		std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+		nanoseconds[method] = std::chrono::duration<double, std::nano>(t1 - t0).count() / frames;
+	}
+	CHECK_MSG(!memcmp(counts[0], counts[1], sizeof(counts[0])) && !memcmp(counts[0], counts[2], sizeof(counts[0])),
+			  "%s: dispatch differs", rig.skeleton);
+	printf("%-32s %zu attachments, %zu timelines: class names %.0f ns, rtti addresses %.0f ns, getType() %.0f ns per frame\n",
+		   rig.skeleton, attachments.size(), timelines.size(), nanoseconds[0], nanoseconds[1], nanoseconds[2]);
+	delete data;
+}
+
+int main() {
+	testIdentity();
+	for (size_t r = 0; r < testRigCount; r++)
+		testRig(testRigs[r]);
+	for (size_t r = 0; r < testRigCount; r++) {
+		if (!strcmp(testRigs[r].skeleton, "raptor/raptor-pro.skel") ||
+			!strcmp(testRigs[r].skeleton, "spineboy-pma/spineboy-pro.skel"))
+			benchmark(testRigs[r]);
+	}
+	return testResult();
+}
@@ -0,0 +1,153 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated April 5, 2025. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2025, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+// Steady state frames must not allocate: every sample rig is updated, applied and rendered for 1000 frames with a
+// SkeletonRenderer reserved for the rig, and a counting SpineExtension must see no allocation after frame 10.
+
+#include "TestUtil.h"
+
+using namespace spine;
+
+namespace {
+	class CountingExtension : public DefaultSpineExtension {
+	public:
+		CountingExtension() : allocations(0) {
+		}
+
+		void *_alloc(size_t size, const char *file, int line) {
+			allocations++;
+			return DefaultSpineExtension::_alloc(size, file, line);
+		}
+
+		void *_calloc(size_t size, const char *file, int line) {
+			allocations++;
+			return DefaultSpineExtension::_calloc(size, file, line);
+		}
+
+		void *_realloc(void *ptr, size_t size, const char *file, int line) {
+			allocations++;
+			return DefaultSpineExtension::_realloc(ptr, size, file, line);
+		}
+
+		size_t allocations;
+	};
+
+	// Upper bounds of the vertices and indices a frame of the data can draw: for each slot the largest attachment of
+	// any skin. Clipping may add vertices, so the bounds are doubled when the data has clipping attachments.
+	void measure(SkeletonData &data, size_t &vertexCount, size_t &indexCount, size_t &clipVertexCount) {
+		size_t slotCount = data.getSlots().size();
+		Vector<size_t> vertices, indices;
+		vertices.setSize(slotCount, 0);
+		indices.setSize(slotCount, 0);
+		clipVertexCount = 0;
+		for (size_t i = 0; i < data.getSkins().size(); i++) {
+			Skin::AttachmentMap::Entries entries = data.getSkins()[i]->getAttachments();
+			while (entries.hasNext()) {
+				Skin::AttachmentMap::Entry &entry = entries.next();
+				Attachment *attachment = entry._attachment;
+				size_t slotVertices = 0, slotIndices = 0;
+				if (attachment->getRTTI().isExactly(RegionAttachment::rtti)) {
+					slotVertices = 4;
+					slotIndices = 6;
+				} else if (attachment->getRTTI().isExactly(MeshAttachment::rtti)) {
+					MeshAttachment *mesh = static_cast<MeshAttachment *>(attachment);
+					slotVertices = mesh->getWorldVerticesLength() >> 1;
+					slotIndices = mesh->getTriangles().size();
+				} else if (attachment->getRTTI().isExactly(ClippingAttachment::rtti)) {
+					size_t clipVertices = static_cast<ClippingAttachment *>(attachment)->getWorldVerticesLength() >> 1;
+					if (clipVertices > clipVertexCount) clipVertexCount = clipVertices;
+				}
+				if (slotVertices > vertices[entry._slotIndex]) vertices[entry._slotIndex] = slotVertices;
+				if (slotIndices > indices[entry._slotIndex]) indices[entry._slotIndex] = slotIndices;
+			}
+		}
+		vertexCount = indexCount = 0;
+		for (size_t i = 0; i < slotCount; i++) {
+			vertexCount += vertices[i];
+			indexCount += indices[i];
+		}
+		if (clipVertexCount) {
+			vertexCount *= 2;
+			indexCount *= 2;
+		}
+	}
+}
+
+static CountingExtension *countingExtension() {
+	return (CountingExtension *) SpineExtension::getInstance();
+}
+
+namespace spine {
+	SpineExtension *getDefaultExtension() {
+		static CountingExtension extension;
+		return &extension;
+	}
+}
+
+static void testRig(Atlas &atlas, const std::string &path) {
+	SkeletonData *data = readSkeletonData(atlas, path);
+	if (!data) return;
+	{
+		Skeleton skeleton(data);
+		skeleton.reserveDeform();
+		AnimationStateData stateData(data);
+		stateData.setDefaultMix(0.2f);
+		AnimationState state(&stateData);
+		// Every animation is queued up front, plus the entry mixed from and the empty one.
+		state.reserve(data->getAnimations().size() + 2);
+		queueAnimations(state, *data);
+		SkeletonRenderer renderer;
+		size_t vertexCount, indexCount, clipVertexCount;
+		measure(*data, vertexCount, indexCount, clipVertexCount);
+		renderer.reserve(vertexCount, indexCount, data->getSlots().size(), clipVertexCount);
+
+		size_t allocations = 0;
+		int firstFrame = -1;
+		for (int frame = 0; frame < 1000; frame++) {
+			size_t before = countingExtension()->allocations;
+			advance(state, skeleton, 1 / 60.0f);
+			renderer.render(skeleton);
+			if (frame < 10) continue;
+			size_t frameAllocations = countingExtension()->allocations - before;
+			if (frameAllocations && firstFrame < 0) firstFrame = frame;
+			allocations += frameAllocations;
+		}
+		CHECK_MSG(allocations == 0, "%s: %zu allocations after frame 10, the first in frame %d", path.c_str(), allocations, firstFrame);
+	}
+	delete data;
+}
+
+int main() {
+	TestTextureLoader textureLoader;
+	for (size_t r = 0; r < testRigCount; r++) {
+		Atlas atlas(assetPath(testRigs[r].atlas).c_str(), &textureLoader);
+		testRig(atlas, assetPath(testRigs[r].skeleton));
+	}
+	return testResult();
+}
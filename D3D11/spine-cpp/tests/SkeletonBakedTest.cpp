@@ -0,0 +1,166 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated April 5, 2025. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2025, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+// SkeletonBaker and SkeletonBaked: every sample rig is baked from its .skel and .json data, loaded back and played next
+// to the source data, which must pose identically. Truncated and corrupted baked data must fail to load without crashing.
+
+#include "TestUtil.h"
+#include <cmath>
+#include <vector>
+
+using namespace spine;
+
+namespace spine {
+	SpineExtension *getDefaultExtension() {
+		static DefaultSpineExtension extension;
+		return &extension;
+	}
+}
+
+static void compareData(const char *path, SkeletonData &expected, SkeletonData &actual) {
+	CHECK_MSG(expected.getBones().size() == actual.getBones().size(), "%s: bones", path);
+	CHECK_MSG(expected.getSlots().size() == actual.getSlots().size(), "%s: slots", path);
+	CHECK_MSG(expected.getSkins().size() == actual.getSkins().size(), "%s: skins", path);
+	CHECK_MSG(expected.getEvents().size() == actual.getEvents().size(), "%s: events", path);
+	CHECK_MSG(expected.getAnimations().size() == actual.getAnimations().size(), "%s: animations", path);
+	CHECK_MSG(expected.getIkConstraints().size() == actual.getIkConstraints().size(), "%s: IK constraints", path);
+	CHECK_MSG(expected.getTransformConstraints().size() == actual.getTransformConstraints().size(), "%s: transform constraints", path);
+	CHECK_MSG(expected.getPathConstraints().size() == actual.getPathConstraints().size(), "%s: path constraints", path);
+	CHECK_MSG(expected.getPhysicsConstraints().size() == actual.getPhysicsConstraints().size(), "%s: physics constraints", path);
+	for (size_t i = 0; i < expected.getBones().size() && i < actual.getBones().size(); i++)
+		CHECK_MSG(expected.getBones()[i]->getName() == actual.getBones()[i]->getName(), "%s: bone %zu", path, i);
+	for (size_t i = 0; i < expected.getAnimations().size() && i < actual.getAnimations().size(); i++) {
+		Animation *animation = expected.getAnimations()[i];
+		CHECK_MSG(animation->getName() == actual.getAnimations()[i]->getName(), "%s: animation %zu", path, i);
+		CHECK_MSG(animation->getTimelines().size() == actual.getAnimations()[i]->getTimelines().size(), "%s: %s timelines", path,
+				  animation->getName().buffer());
+	}
+}
+
+// Plays both data sets side by side and compares bones, slot colors and attachments every frame.
+static void comparePoses(const char *path, SkeletonData &expectedData, SkeletonData &actualData) {
+	Skeleton expected(&expectedData), actual(&actualData);
+	AnimationStateData expectedStateData(&expectedData), actualStateData(&actualData);
+	AnimationState expectedState(&expectedStateData), actualState(&actualStateData);
+	queueAnimations(expectedState, expectedData);
+	queueAnimations(actualState, actualData);
+	float maxDelta = 0;
+	int attachmentMismatches = 0;
+	for (int frame = 0; frame < 600; frame++) {
+		advance(expectedState, expected, 1 / 60.0f);
+		advance(actualState, actual, 1 / 60.0f);
+		for (size_t i = 0; i < expected.getBones().size(); i++) {
+			Bone *a = expected.getBones()[i], *b = actual.getBones()[i];
+			maxDelta = std::fmax(maxDelta, std::fabs(a->getWorldX() - b->getWorldX()) + std::fabs(a->getWorldY() - b->getWorldY()));
+			maxDelta = std::fmax(maxDelta, std::fabs(a->getA() - b->getA()) + std::fabs(a->getD() - b->getD()));
+		}
+		for (size_t i = 0; i < expected.getSlots().size(); i++) {
+			Slot *a = expected.getSlots()[i], *b = actual.getSlots()[i];
+			maxDelta = std::fmax(maxDelta, std::fabs(a->getColor().a - b->getColor().a));
+			Attachment *attachmentA = a->getAttachment(), *attachmentB = b->getAttachment();
+			if ((attachmentA == NULL) != (attachmentB == NULL) || (attachmentA && attachmentA->getName() != attachmentB->getName()))
+				attachmentMismatches++;
+		}
+	}
+	CHECK_MSG(maxDelta < 1e-3f, "%s: poses differ by %f", path, maxDelta);
+	CHECK_MSG(attachmentMismatches == 0, "%s: %d attachment mismatches", path, attachmentMismatches);
+}
+
+static void testRoundTrip(Atlas &atlas, const std::string &path) {
+	SkeletonData *source = readSkeletonData(atlas, path);
+	if (!source) return;
+	SkeletonBaker baker;
+	Vector<unsigned char> baked;
+	bool written = baker.write(*source, baked);
+	CHECK_MSG(written, "%s: %s", path.c_str(), baker.getError().buffer());
+	if (written) {
+		SkeletonBaked loader(&atlas);
+		CHECK(SkeletonBaked::isBaked(baked.buffer(), (int) baked.size()));
+		SkeletonData *data = loader.readSkeletonData(baked.buffer(), (int) baked.size());
+		CHECK_MSG(data, "%s: %s", path.c_str(), loader.getError().buffer());
+		if (data) {
+			compareData(path.c_str(), *source, *data);
+			comparePoses(path.c_str(), *source, *data);
+			delete data;
+		}
+	}
+	delete source;
+}
+
+// Truncates the data and overwrites every word with values that break counts and indices. Loading must fail or succeed,
+// but never read or allocate out of bounds, which a sanitizer build verifies.
+static void testCorruptData(Atlas &atlas, const std::string &path) {
+	SkeletonData *source = readSkeletonData(atlas, path);
+	if (!source) return;
+	SkeletonBaker baker;
+	Vector<unsigned char> baked;
+	CHECK(baker.write(*source, baked));
+	delete source;
+	int length = (int) baked.size();
+	std::vector<unsigned char> data(baked.buffer(), baked.buffer() + length);
+
+	int loaded = 0;
+	for (int truncated = 16; truncated < length; truncated += truncated < 4096 ? 4 : 997) {
+		std::vector<unsigned char> input(data.begin(), data.begin() + truncated);
+		memcpy(&input[12], &truncated, 4);
+		SkeletonBaked loader(&atlas);
+		SkeletonData *skeletonData = loader.readSkeletonData(input.data(), truncated);
+		if (skeletonData) loaded++;
+		CHECK(skeletonData || !loader.getError().isEmpty());
+		delete skeletonData;
+	}
+	CHECK_MSG(loaded == 0, "%s: %d truncated files loaded", path.c_str(), loaded);
+
+	const int values[] = {-1, -2, 0x7fffffff, 0x40000000, 1000000};
+	std::vector<unsigned char> input(data);
+	for (int offset = 16; offset + 4 <= length; offset += offset < 8192 ? 4 : 52) {
+		for (int i = 0; i < 5; i++) {
+			memcpy(&input[offset], &values[i], 4);
+			SkeletonBaked loader(&atlas);
+			SkeletonData *skeletonData = loader.readSkeletonData(input.data(), length);
+			CHECK(skeletonData || !loader.getError().isEmpty());
+			delete skeletonData;
+		}
+		memcpy(&input[offset], &data[offset], 4);
+	}
+}
+
+int main() {
+	TestTextureLoader textureLoader;
+	for (size_t r = 0; r < testRigCount; r++) {
+		Atlas atlas(assetPath(testRigs[r].atlas).c_str(), &textureLoader);
+		testRoundTrip(atlas, assetPath(testRigs[r].skeleton));
+		if (testRigs[r].json) testRoundTrip(atlas, assetPath(testRigs[r].json));
+	}
+	Atlas atlas(assetPath("raptor/raptor-pma.atlas").c_str(), &textureLoader);
+	testCorruptData(atlas, assetPath("raptor/raptor-pro.skel"));
+	Atlas meshAtlas(assetPath("vine-pma/vine-pma.atlas").c_str(), &textureLoader);
+	testCorruptData(meshAtlas, assetPath("vine-pma/vine-pro.skel"));
+	return testResult();
+}
@@ -0,0 +1,157 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated April 5, 2025. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2025, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+// Stress test of SkeletonBatch: many instances of all sample rigs are updated and rendered with different thread counts,
+// which must give identical results, and batches are created and destroyed repeatedly. All memory goes through a
+// DebugExtension, which must be back at its starting point at the end.
+
+#include "TestUtil.h"
+#include <spine/Debug.h>
+#include <spine/SkeletonBatch.h>
+#include <vector>
+
+using namespace spine;
+
+namespace spine {
+	SpineExtension *getDefaultExtension() {
+		static DefaultSpineExtension defaultExtension;
+		static DebugExtension extension(&defaultExtension);
+		return &extension;
+	}
+}
+
+namespace {
+	void hash(uint64_t &h, const void *data, size_t size) {
+		const unsigned char *bytes = (const unsigned char *) data;
+		for (size_t i = 0; i < size; i++) {
+			h ^= bytes[i];
+			h *= 1099511628211ull;
+		}
+	}
+
+	/// Hashes the commands of each instance, rendered() runs concurrently but each instance on one thread.
+	class HashListener : public SkeletonBatchListener {
+	public:
+		explicit HashListener(size_t count) : hashes(count, 1469598103934665603ull) {
+		}
+
+		void rendered(SkeletonBatch &batch, size_t index, RenderCommand *commands, int thread) {
+			SP_UNUSED(batch);
+			SP_UNUSED(thread);
+			uint64_t &h = hashes[index];
+			for (RenderCommand *command = commands; command; command = command->next) {
+				hash(h, command->positions, command->numVertices * 2 * sizeof(float));
+				hash(h, command->uvs, command->numVertices * 2 * sizeof(float));
+				hash(h, command->colors, command->numVertices * sizeof(uint32_t));
+				hash(h, command->indices, command->numIndices * sizeof(uint16_t));
+			}
+		}
+
+		std::vector<uint64_t> hashes;
+	};
+
+	struct Rig {
+		Atlas *atlas;
+		SkeletonData *data;
+		AnimationStateData *stateData;
+	};
+
+	std::vector<uint64_t> run(std::vector<Rig> &rigs, int threadCount, size_t count, int frames) {
+		std::vector<Skeleton *> skeletons;
+		std::vector<AnimationState *> states;
+		HashListener listener(count);
+		{
+			SkeletonBatch batch(threadCount);
+			batch.setListener(&listener);
+			for (size_t i = 0; i < count; i++) {
+				Rig &rig = rigs[i % rigs.size()];
+				Skeleton *skeleton = new (__FILE__, __LINE__) Skeleton(rig.data);
+				AnimationState *state = new (__FILE__, __LINE__) AnimationState(rig.stateData);
+				queueAnimations(*state, *rig.data);
+				state->update(i * 0.013f);
+				skeletons.push_back(skeleton);
+				states.push_back(state);
+				CHECK(batch.add(skeleton, state) == i);
+			}
+			for (int frame = 0; frame < frames; frame++)
+				batch.update(1 / 60.0f);
+			if (threadCount > 1) CHECK(batch.getThreadCount() == threadCount);
+		}
+		for (size_t i = 0; i < count; i++) {
+			delete states[i];
+			delete skeletons[i];
+		}
+		return listener.hashes;
+	}
+}
+
+int main() {
+	DebugExtension *extension = (DebugExtension *) SpineExtension::getInstance();
+	size_t startMemory = extension->getUsedMemory();
+	{
+		TestTextureLoader textureLoader;
+		std::vector<Rig> rigs;
+		for (size_t r = 0; r < testRigCount; r++) {
+			Rig rig;
+			rig.atlas = new (__FILE__, __LINE__) Atlas(assetPath(testRigs[r].atlas).c_str(), &textureLoader);
+			rig.data = readSkeletonData(*rig.atlas, assetPath(testRigs[r].skeleton));
+			if (!rig.data) {
+				delete rig.atlas;
+				continue;
+			}
+			rig.stateData = new (__FILE__, __LINE__) AnimationStateData(rig.data);
+			rig.stateData->setDefaultMix(0.2f);
+			rigs.push_back(rig);
+		}
+
+		// Results must not depend on the thread count or scheduling.
+		std::vector<uint64_t> expected = run(rigs, 1, 240, 120);
+		const int threadCounts[] = {2, 3, 8, 16};
+		for (int i = 0; i < 4; i++) {
+			std::vector<uint64_t> hashes = run(rigs, threadCounts[i], 240, 120);
+			for (size_t ii = 0; ii < hashes.size(); ii++)
+				CHECK_MSG(hashes[ii] == expected[ii], "%d threads, instance %zu differs", threadCounts[i], ii);
+		}
+
+		// Starting and stopping pools, with and without work.
+		for (int i = 0; i < 50; i++) {
+			SkeletonBatch batch(1 + i % 8);
+			if (i & 1) batch.update(1 / 60.0f);
+		}
+		run(rigs, 8, 16, 200);
+
+		for (size_t i = 0; i < rigs.size(); i++) {
+			delete rigs[i].stateData;
+			delete rigs[i].data;
+			delete rigs[i].atlas;
+		}
+	}
+	CHECK_MSG(extension->getUsedMemory() == startMemory, "%zu bytes not freed", extension->getUsedMemory() - startMemory);
+	return testResult();
+}
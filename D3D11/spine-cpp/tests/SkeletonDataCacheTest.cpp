@@ -0,0 +1,295 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated April 5, 2025. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2025, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+// SkeletonDataCache: acquiring the same files N times reads them once, equivalent paths share an entry, entries are
+// reference counted, released entries are evicted least recently used first once over the budget, and the hit, miss and
+// eviction counters match. Threads acquiring and releasing concurrently must end with the same counts. Loads done by an
+// AsyncLoader are adopted by the cache, or deleted if their files are cached already.
+
+#include "TestUtil.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace spine;
+
+namespace spine {
+	SpineExtension *getDefaultExtension() {
+		static DefaultSpineExtension extension;
+		return &extension;
+	}
+}
+
+namespace {
+	// Counts the pages loaded and unloaded, from any thread.
+	class CountingTextureLoader : public TextureLoader {
+	public:
+		CountingTextureLoader() : loads(0), unloads(0) {
+		}
+
+		void load(AtlasPage &page, const String &path) {
+			SP_UNUSED(path);
+			page.texture = (void *) (uintptr_t) (0x1000 + page.index);
+			page.width = 1024;
+			page.height = 1024;
+			loads++;
+		}
+
+		void unload(void *texture) {
+			SP_UNUSED(texture);
+			unloads++;
+		}
+
+		std::atomic<int> loads, unloads;
+	};
+}
+
+static String path(const char *file) {
+	return assetPath(file).c_str();
+}
+
+static void testDedupe() {
+	const TestRig &rig = testRigs[7];
+	CountingTextureLoader textureLoader;
+	{
+		SkeletonDataCache cache(&textureLoader);
+		const int count = 50;
+		SkeletonDataCache::Entry *first = cache.acquire(path(rig.atlas), path(rig.skeleton));
+		CHECK_MSG(first, "%s", cache.getError().buffer());
+		if (!first) return;
+		int pages = (int) first->getAtlas()->getPages().size();
+		for (int i = 1; i < count; i++)
+			CHECK(cache.acquire(path(rig.atlas), path(rig.skeleton)) == first);
+		CHECK(first->getReferenceCount() == count);
+		CHECK(cache.getMisses() == 1);
+		CHECK(cache.getHits() == (size_t) count - 1);
+		CHECK(textureLoader.loads == pages);
+
+		// "." and ".." segments and doubled separators name the same files.
+		std::string skeleton = assetPath(rig.skeleton), atlas = assetPath(rig.atlas);
+		size_t slash = skeleton.rfind('/');
+		std::string dotted = skeleton.substr(0, slash) + "/./../" + skeleton.substr(skeleton.rfind('/', slash - 1) + 1);
+		std::string doubled = atlas.substr(0, atlas.rfind('/')) + "//" + atlas.substr(atlas.rfind('/') + 1);
+		SkeletonDataCache::Entry *same = cache.acquire(doubled.c_str(), dotted.c_str());
+		CHECK_MSG(same == first, "%s %s", doubled.c_str(), dotted.c_str());
+		if (same) cache.release(same);
+
+		// Another scale is another entry, sharing the atlas.
+		SkeletonDataCache::Entry *scaled = cache.acquire(path(rig.atlas), path(rig.skeleton), 2);
+		CHECK(scaled && scaled != first);
+		CHECK(scaled && scaled->getAtlas() == first->getAtlas());
+		CHECK(scaled && scaled->getScale() == 2);
+		CHECK(cache.getMisses() == 2);
+		CHECK(textureLoader.loads == pages);
+		CHECK(cache.getEntryCount() == 2);
+
+		// Released entries stay cached until evicted.
+		for (int i = 0; i < count; i++)
+			cache.release(first);
+		CHECK(first->getReferenceCount() == 0);
+		CHECK(cache.acquire(path(rig.atlas), path(rig.skeleton)) == first);
+		cache.release(first);
+		CHECK(cache.getEvictions() == 0);
+
+		// A failed read is a miss with an error, not an entry.
+		CHECK(cache.acquire(path(rig.atlas), path("missing.skel")) == NULL);
+		CHECK(!cache.getError().isEmpty());
+		CHECK(cache.getEntryCount() == 2);
+
+		cache.resetCounters();
+		CHECK(cache.getHits() == 0 && cache.getMisses() == 0 && cache.getEvictions() == 0);
+		if (scaled) cache.release(scaled);
+	}
+	CHECK(textureLoader.unloads == textureLoader.loads);
+}
+
+static void testEviction() {
+	CountingTextureLoader textureLoader;
+	SkeletonDataCache cache(&textureLoader);
+	const size_t count = 4;
+	SkeletonDataCache::Entry *entries[count];
+	for (size_t i = 0; i < count; i++) {
+		entries[i] = cache.acquire(path(testRigs[i].atlas), path(testRigs[i].skeleton));
+		CHECK_MSG(entries[i], "%s", cache.getError().buffer());
+		if (!entries[i]) return;
+		CHECK(entries[i]->getSize() > 0);
+	}
+	size_t size = cache.getSize();
+	CHECK(size > 0);
+
+	// Acquired entries are kept over budget.
+	cache.setBudget(0);
+	CHECK(cache.getEntryCount() == count);
+	CHECK(cache.getEvictions() == 0);
+	CHECK(cache.getSize() == size);
+
+	// Entry 0 is used again after the others are released, so entry 1 is the least recently used.
+	cache.setBudget(size);
+	for (size_t i = 0; i < count; i++)
+		cache.release(entries[i]);
+	CHECK(cache.acquire(path(testRigs[0].atlas), path(testRigs[0].skeleton)) == entries[0]);
+	cache.release(entries[0]);
+	CHECK(cache.getEntryCount() == count);
+
+	cache.setBudget(size - 1);
+	CHECK(cache.getEvictions() == 1);
+	CHECK(cache.getEntryCount() == count - 1);
+	CHECK(cache.getSize() < size);
+	cache.setBudget(size);
+	cache.resetCounters();
+	SkeletonDataCache::Entry *entry = cache.acquire(path(testRigs[1].atlas), path(testRigs[1].skeleton));
+	CHECK(cache.getMisses() == 1);
+	if (entry) cache.release(entry);
+	entry = cache.acquire(path(testRigs[0].atlas), path(testRigs[0].skeleton));
+	CHECK(entry == entries[0]);
+	CHECK(cache.getHits() == 1);
+	if (entry) cache.release(entry);
+
+	// A budget of 0 keeps nothing released, as does clear().
+	cache.resetCounters();
+	cache.setBudget(0);
+	CHECK(cache.getEntryCount() == 0);
+	CHECK(cache.getEvictions() == count);
+	CHECK(cache.getSize() == 0);
+	CHECK(textureLoader.unloads == textureLoader.loads);
+
+	cache.setBudget(size);
+	entry = cache.acquire(path(testRigs[0].atlas), path(testRigs[0].skeleton));
+	cache.clear();
+	CHECK(cache.getEntryCount() == 1);
+	if (entry) cache.release(entry);
+	cache.clear();
+	CHECK(cache.getEntryCount() == 0);
+	CHECK(cache.getSize() == 0);
+}
+
+static void testThreads() {
+	CountingTextureLoader textureLoader;
+	SkeletonDataCache cache(&textureLoader);
+	const int threadCount = 4, iterations = 100;
+	const size_t rigCount = 3;
+	std::atomic<int> failures(0);
+	std::vector<std::thread> threads;
+	for (int t = 0; t < threadCount; t++) {
+		threads.push_back(std::thread([&cache, &failures, t]() {
+			for (int i = 0; i < iterations; i++) {
+				const TestRig &rig = testRigs[(i + t) % rigCount];
+				SkeletonDataCache::Entry *entry = cache.acquire(path(rig.atlas), path(rig.skeleton));
+				if (!entry || !entry->getSkeletonData())
+					failures++;
+				else
+					cache.release(entry);
+			}
+		}));
+	}
+	for (size_t i = 0; i < threads.size(); i++)
+		threads[i].join();
+	CHECK(failures == 0);
+	CHECK(cache.getMisses() == rigCount);
+	CHECK(cache.getHits() == (size_t) (threadCount * iterations) - rigCount);
+	CHECK(cache.getEntryCount() == rigCount);
+	cache.clear();
+	CHECK(cache.getEntryCount() == 0);
+	CHECK(textureLoader.unloads == textureLoader.loads);
+}
+
+static void testAsyncLoad() {
+	const TestRig &rig = testRigs[7];
+	CountingTextureLoader textureLoader;
+	{
+		SkeletonDataCache cache(&textureLoader);
+		AsyncLoader loader(&textureLoader, 2);
+
+		// A done load becomes the entry, and later acquires of its files hit it.
+		AsyncLoad *load = loader.load(path(rig.atlas), path(rig.skeleton));
+		loader.finish(load);
+		SkeletonData *loaded = load->getSkeletonData();
+		SkeletonDataCache::Entry *entry = cache.acquire(*load);
+		CHECK_MSG(entry, "%s", cache.getError().buffer());
+		if (!entry) return;
+		CHECK(entry->getSkeletonData() == loaded);
+		CHECK(!load->getSkeletonData() && !load->getAtlas());
+		delete load;
+		CHECK(cache.acquire(path(rig.atlas), path(rig.skeleton)) == entry);
+		CHECK(cache.getMisses() == 1 && cache.getHits() == 1);
+		int loads = textureLoader.loads;
+
+		// Loading the files again gives the cached entry, the loaded copy is deleted with its textures.
+		load = loader.load(path(rig.atlas), path(rig.skeleton));
+		loader.finish(load);
+		CHECK(cache.acquire(*load) == entry);
+		CHECK(cache.getHits() == 2);
+		CHECK(textureLoader.unloads == textureLoader.loads - loads);
+		delete load;
+
+		// Another scale is a new entry. Its skeleton data uses the atlas it was loaded with, while acquires by path keep
+		// sharing the cached atlas.
+		load = loader.load(path(rig.atlas), path(rig.skeleton), 2);
+		loader.finish(load);
+		Atlas *loadedAtlas = load->getAtlas();
+		SkeletonDataCache::Entry *scaled = cache.acquire(*load);
+		delete load;
+		CHECK(scaled && scaled != entry && scaled->getAtlas() == loadedAtlas && scaled->getAtlas() != entry->getAtlas());
+		CHECK(cache.getEntryCount() == 2);
+		if (scaled) cache.release(scaled);
+		size_t budget = cache.getBudget();
+		cache.setBudget(0);
+		CHECK(cache.getEvictions() == 1);
+		cache.setBudget(budget);
+		loads = textureLoader.loads;
+		SkeletonDataCache::Entry *other = cache.acquire(path(rig.atlas), path(rig.skeleton), 3);
+		CHECK(other && other->getAtlas() == entry->getAtlas());
+		CHECK(textureLoader.loads == loads);
+		if (other) cache.release(other);
+
+		// Failed loads give NULL and the load's error.
+		load = loader.load(path(rig.atlas), path("missing/missing.skel"));
+		loader.finish(load);
+		CHECK(cache.acquire(*load) == NULL);
+		CHECK(cache.getError().length() > 0);
+		delete load;
+
+		CHECK(entry->getReferenceCount() == 3);
+		for (int i = 0; i < 3; i++)
+			cache.release(entry);
+		cache.clear();
+		CHECK(cache.getEntryCount() == 0);
+		CHECK(cache.getSize() == 0);
+	}
+	CHECK_MSG(textureLoader.unloads == textureLoader.loads, "%d of %d pages unloaded", (int) textureLoader.unloads,
+			  (int) textureLoader.loads);
+}
+
+int main() {
+	testDedupe();
+	testEviction();
+	testThreads();
+	testAsyncLoad();
+	return testResult();
+}
@@ -0,0 +1,219 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated April 5, 2025. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2025, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+// SkeletonGeometry: the triangles of its draw ranges, expanded through their indices, must equal those of the commands of
+// render(Skeleton &), vertex for vertex, with the same texture and blend mode. Covers every sample rig, the clipping of
+// coin-pro and a generated skeleton above 64k vertices, whose commands are merged and rebased until a range would pass
+// 16 bit indices. Each is built with colors per vertex and with colors left out of the layout, per range then.
+
+#include "TestUtil.h"
+#include <vector>
+
+using namespace spine;
+
+namespace spine {
+	SpineExtension *getDefaultExtension() {
+		static DefaultSpineExtension extension;
+		return &extension;
+	}
+}
+
+namespace {
+	struct Corner {
+		float x, y, u, v;
+		uint32_t color, darkColor;
+		void *texture;
+		BlendMode blendMode;
+
+		bool operator==(const Corner &other) const {
+			return x == other.x && y == other.y && u == other.u && v == other.v && color == other.color &&
+				   darkColor == other.darkColor && texture == other.texture && blendMode == other.blendMode;
+		}
+	};
+
+}
+
+static const VertexLayout coloredLayout(24, 0, 8, 16, 20);
+static const VertexLayout uncoloredLayout(16, 0, 8);
+
+static void expandCommands(RenderCommand *command, std::vector<Corner> &corners) {
+	corners.clear();
+	for (; command; command = command->next) {
+		for (int32_t i = 0; i < command->numIndices; i++) {
+			uint16_t index = command->indices[i];
+			Corner corner = {command->positions[index << 1], command->positions[(index << 1) + 1], command->uvs[index << 1],
+							 command->uvs[(index << 1) + 1], command->colors[index], command->darkColors[index],
+							 command->texture, command->blendMode};
+			corners.push_back(corner);
+		}
+	}
+}
+
+// Returns false if an index leaves its range or a range its buffers.
+static bool expandGeometry(SkeletonGeometry &geometry, std::vector<Corner> &corners) {
+	corners.clear();
+	const VertexLayout &layout = geometry.getLayout();
+	const uint8_t *vertices = (const uint8_t *) geometry.getVertices();
+	Vector<DrawRange> &ranges = geometry.getDrawRanges();
+	for (size_t r = 0; r < ranges.size(); r++) {
+		DrawRange &range = ranges[r];
+		if (range.vertexCount > 0x10000 || (size_t) (range.vertexStart + range.vertexCount) > geometry.getVertexCount() ||
+			(size_t) (range.indexStart + range.indexCount) > geometry.getIndexCount())
+			return false;
+		for (int32_t i = 0; i < range.indexCount; i++) {
+			uint16_t index = geometry.getIndices()[range.indexStart + i];
+			if (index >= range.vertexCount) return false;
+			const uint8_t *vertex = vertices + (range.vertexStart + index) * layout.stride;
+			const float *position = (const float *) (vertex + layout.position), *uv = (const float *) (vertex + layout.uv);
+			Corner corner = {position[0], position[1], uv[0], uv[1],
+							 layout.color >= 0 ? *(const uint32_t *) (vertex + layout.color) : range.color,
+							 layout.darkColor >= 0 ? *(const uint32_t *) (vertex + layout.darkColor) : range.darkColor,
+							 range.texture, range.blendMode};
+			corners.push_back(corner);
+		}
+	}
+	return true;
+}
+
+static void compare(const char *name, int frame, const std::vector<Corner> &expected, Skeleton &skeleton, SkeletonGeometry &geometry) {
+	std::vector<Corner> actual;
+	geometry.build(skeleton);
+	bool valid = expandGeometry(geometry, actual);
+	CHECK_MSG(valid, "%s frame %d: a draw range or index is out of bounds", name, frame);
+	if (!valid) return;
+	CHECK_MSG(expected.size() == actual.size(), "%s frame %d: %zu corners, expected %zu", name, frame, actual.size(), expected.size());
+	size_t mismatches = 0;
+	for (size_t i = 0; i < expected.size() && i < actual.size(); i++)
+		if (!(expected[i] == actual[i])) mismatches++;
+	CHECK_MSG(mismatches == 0, "%s frame %d: %zu corners differ", name, frame, mismatches);
+}
+
+static bool hasClipping(SkeletonData &data) {
+	for (size_t i = 0; i < data.getSkins().size(); i++) {
+		Skin::AttachmentMap::Entries entries = data.getSkins()[i]->getAttachments();
+		while (entries.hasNext())
+			if (entries.next()._attachment->getRTTI().isExactly(ClippingAttachment::rtti)) return true;
+	}
+	return false;
+}
+
+// Returns true if the rig has clipping attachments.
+static bool testRig(Atlas &atlas, const std::string &path) {
+	SkeletonData *data = readSkeletonData(atlas, path);
+	if (!data) return false;
+	bool clipping = hasClipping(*data);
+	{
+		Skeleton skeleton(data);
+		AnimationStateData stateData(data);
+		AnimationState state(&stateData);
+		queueAnimations(state, *data);
+		SkeletonRenderer renderer;
+		SkeletonGeometry colored(coloredLayout), uncolored(uncoloredLayout);
+		std::vector<Corner> expected;
+		for (int frame = 1; frame <= 300; frame++) {
+			advance(state, skeleton, 1 / 30.0f);
+			if (frame % 5) continue;
+			expandCommands(renderer.render(skeleton), expected);
+			compare(path.c_str(), frame, expected, skeleton, colored);
+			compare(path.c_str(), frame, expected, skeleton, uncolored);
+		}
+	}
+	delete data;
+	return clipping;
+}
+
+// 70 slots with a 1000 vertex, 3000 index mesh each. The renderer splits commands every 21 slots to keep their index
+// counts below 0xffff, SkeletonGeometry merges them back into ranges of up to 65 slots, the most that 16 bit indices
+// reach, which gives 4 commands and 2 ranges. Left out of the layout, the color changing every 30 slots splits commands
+// too, and only those with the same color merge, which gives 3 ranges.
+static void testLargeSkeleton(Atlas &atlas) {
+	const int slotCount = 70, meshVertices = 1000;
+	SkeletonData *data = new (__FILE__, __LINE__) SkeletonData();
+	BoneData *bone = new (__FILE__, __LINE__) BoneData(0, "root");
+	data->getBones().add(bone);
+	Skin *skin = new (__FILE__, __LINE__) Skin("default");
+	data->getSkins().add(skin);
+	data->setDefaultSkin(skin);
+	for (int i = 0; i < slotCount; i++) {
+		SlotData *slot = new (__FILE__, __LINE__) SlotData(i, String("slot").append(i), *bone);
+		slot->getColor().set(1, (i / 30) / 2.0f, 1, 1);
+		slot->setAttachmentName("mesh");
+		data->getSlots().add(slot);
+		MeshAttachment *mesh = new (__FILE__, __LINE__) MeshAttachment("mesh");
+		mesh->setRegion(atlas.getRegions()[0]);
+		mesh->setWorldVerticesLength(meshVertices << 1);
+		mesh->getVertices().setSize(meshVertices << 1, 0);
+		mesh->getRegionUVs().setSize(meshVertices << 1, 0);
+		for (int v = 0; v < meshVertices; v++) {
+			mesh->getVertices()[v << 1] = (float) (v % 40) + i;
+			mesh->getVertices()[(v << 1) + 1] = (float) (v / 40) - i;
+			mesh->getRegionUVs()[v << 1] = (v % 40) / 39.0f;
+			mesh->getRegionUVs()[(v << 1) + 1] = (v / 40) / 24.0f;
+		}
+		mesh->getTriangles().setSize(meshVertices * 3, 0);
+		for (int t = 0; t < meshVertices; t++) {
+			mesh->getTriangles()[t * 3] = (unsigned short) t;
+			mesh->getTriangles()[t * 3 + 1] = (unsigned short) ((t + 1) % meshVertices);
+			mesh->getTriangles()[t * 3 + 2] = (unsigned short) ((t + 2) % meshVertices);
+		}
+		mesh->updateRegion();
+		skin->setAttachment(i, "mesh", mesh);
+	}
+	data->buildNameIndex();
+	{
+		Skeleton skeleton(data);
+		skeleton.setToSetupPose();
+		skeleton.updateWorldTransform(Physics_None);
+		SkeletonRenderer renderer;
+		SkeletonGeometry colored(coloredLayout), uncolored(uncoloredLayout);
+		std::vector<Corner> expected;
+		expandCommands(renderer.render(skeleton), expected);
+		compare("large", 0, expected, skeleton, colored);
+		CHECK(colored.getVertexCount() == (size_t) (slotCount * meshVertices));
+		CHECK(colored.getRenderer().getDrawCallCount() == 4);
+		CHECK(colored.getDrawRanges().size() == 2);
+		compare("large uncolored", 0, expected, skeleton, uncolored);
+		CHECK(uncolored.getRenderer().getDrawCallCount() == 5);
+		CHECK(uncolored.getDrawRanges().size() == 3);
+	}
+	delete data;
+}
+
+int main() {
+	TestTextureLoader textureLoader;
+	int clippingRigs = 0;
+	for (size_t r = 0; r < testRigCount; r++) {
+		Atlas atlas(assetPath(testRigs[r].atlas).c_str(), &textureLoader);
+		if (testRig(atlas, assetPath(testRigs[r].skeleton))) clippingRigs++;
+	}
+	CHECK_MSG(clippingRigs > 0, "no sample rig with clipping");
+	Atlas atlas(assetPath(testRigs[0].atlas).c_str(), &textureLoader);
+	testLargeSkeleton(atlas);
+	return testResult();
+}
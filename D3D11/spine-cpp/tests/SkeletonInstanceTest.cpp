@@ -0,0 +1,114 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated April 5, 2025. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2025, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+// SkeletonInstance: a pose stored mid animation, reset with setToSetupPose() and loaded into a skeleton must match a plain
+// Skeleton reset with Skeleton::setToSetupPose(), including attachments, sequence indices and deform.
+
+#include "TestUtil.h"
+
+using namespace spine;
+
+namespace spine {
+	SpineExtension *getDefaultExtension() {
+		static DefaultSpineExtension extension;
+		return &extension;
+	}
+}
+
+static void compareSkeletons(const char *path, int frame, Skeleton &expected, Skeleton &actual) {
+	int boneMismatches = 0, slotMismatches = 0;
+	for (size_t i = 0; i < expected.getBones().size(); i++) {
+		Bone *a = expected.getBones()[i], *b = actual.getBones()[i];
+		if (a->getX() != b->getX() || a->getY() != b->getY() || a->getRotation() != b->getRotation() ||
+			a->getScaleX() != b->getScaleX() || a->getScaleY() != b->getScaleY() || a->getShearX() != b->getShearX() ||
+			a->getShearY() != b->getShearY() || a->getWorldX() != b->getWorldX() || a->getWorldY() != b->getWorldY())
+			boneMismatches++;
+	}
+	for (size_t i = 0; i < expected.getSlots().size(); i++) {
+		Slot *a = expected.getSlots()[i], *b = actual.getSlots()[i];
+		bool same = a->getAttachment() == b->getAttachment() && a->getSequenceIndex() == b->getSequenceIndex() &&
+					a->getDeform().size() == b->getDeform().size() && a->getColor().r == b->getColor().r &&
+					a->getColor().g == b->getColor().g && a->getColor().b == b->getColor().b && a->getColor().a == b->getColor().a &&
+					expected.getDrawOrder()[i]->getData().getIndex() == actual.getDrawOrder()[i]->getData().getIndex();
+		for (size_t n = 0; same && n < a->getDeform().size(); n++)
+			same = a->getDeform()[n] == b->getDeform()[n];
+		if (!same) slotMismatches++;
+	}
+	CHECK_MSG(boneMismatches == 0, "%s frame %d: %d bones differ", path, frame, boneMismatches);
+	CHECK_MSG(slotMismatches == 0, "%s frame %d: %d slots differ", path, frame, slotMismatches);
+}
+
+// Stores the animated pose every few frames, resets it with setToSetupPose() and loads it into a second skeleton, which
+// must equal the animated skeleton reset to its setup pose. Returns the number of stored slots with deform or a sequence
+// index, which setToSetupPose() had to clear.
+static int testSetupPose(Atlas &atlas, const std::string &path) {
+	SkeletonData *data = readSkeletonData(atlas, path);
+	if (!data) return 0;
+	Skeleton expected(data), actual(data);
+	Vector<Skin *> &skins = data->getSkins();
+	if (skins.size() > 1) {
+		expected.setSkin(skins[skins.size() - 1]);
+		actual.setSkin(skins[skins.size() - 1]);
+	}
+	expected.setToSetupPose();
+	actual.setToSetupPose();
+	AnimationStateData stateData(data);
+	AnimationState state(&stateData);
+	queueAnimations(state, *data);
+	SkeletonInstance instance(data);
+	int staleSlots = 0;
+	for (int frame = 1; frame <= 300; frame++) {
+		advance(state, expected, 1 / 30.0f);
+		if (frame % 7) continue;
+		instance.store(expected);
+		for (size_t i = 0; i < expected.getSlots().size(); i++) {
+			Slot *slot = expected.getSlots()[i];
+			if (slot->getDeform().size() || slot->getSequenceIndex() != -1) staleSlots++;
+		}
+		instance.setToSetupPose();
+		instance.load(actual);
+		expected.setToSetupPose();
+		expected.updateWorldTransform(Physics_None);
+		actual.updateWorldTransform(Physics_None);
+		compareSkeletons(path.c_str(), frame, expected, actual);
+	}
+	delete data;
+	return staleSlots;
+}
+
+int main() {
+	TestTextureLoader textureLoader;
+	int staleSlots = 0;
+	for (size_t r = 0; r < testRigCount; r++) {
+		Atlas atlas(assetPath(testRigs[r].atlas).c_str(), &textureLoader);
+		staleSlots += testSetupPose(atlas, assetPath(testRigs[r].skeleton));
+	}
+	CHECK_MSG(staleSlots > 0, "no stored deform or sequence index");
+	return testResult();
+}
@@ -0,0 +1,303 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated April 5, 2025. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2025, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+// Skeleton: every sample rig is played with a compact pose and with separately allocated bones, switching skins and rebuilding
+// the update cache as it goes. The world transforms must be bit identical, and the compact bones must be one block in bone
+// order. Switching between skins requiring different bones of the same count must rebuild the update cache, not reuse it.
+// Skipping unchanged bone subtrees must give the same world transforms as a skeleton forced to recompute every bone, while
+// playing, idle, with an additive track, while moving and when poses are loaded from SkeletonInstances.
+
+#include "TestUtil.h"
+
+using namespace spine;
+
+namespace spine {
+	SpineExtension *getDefaultExtension() {
+		static DefaultSpineExtension extension;
+		return &extension;
+	}
+}
+
+static bool sameWorld(Bone &a, Bone &b) {
+	return a.getA() == b.getA() && a.getB() == b.getB() && a.getC() == b.getC() && a.getD() == b.getD() &&
+		   a.getWorldX() == b.getWorldX() && a.getWorldY() == b.getWorldY() && a.isActive() == b.isActive();
+}
+
+// Index of the entry in the skeleton's bones or constraints, so the update caches of two skeletons can be compared.
+static int cacheIndex(Skeleton &skeleton, Updatable *updatable) {
+	const RTTI &rtti = updatable->getRTTI();
+	if (rtti.isExactly(Bone::rtti)) return skeleton.getBones().indexOf(static_cast<Bone *>(updatable));
+	if (rtti.isExactly(IkConstraint::rtti)) return 1000 + skeleton.getIkConstraints().indexOf(static_cast<IkConstraint *>(updatable));
+	if (rtti.isExactly(TransformConstraint::rtti))
+		return 2000 + skeleton.getTransformConstraints().indexOf(static_cast<TransformConstraint *>(updatable));
+	if (rtti.isExactly(PathConstraint::rtti))
+		return 3000 + skeleton.getPathConstraints().indexOf(static_cast<PathConstraint *>(updatable));
+	return 4000 + skeleton.getPhysicsConstraints().indexOf(static_cast<PhysicsConstraint *>(updatable));
+}
+
+static void testCompactPose(Atlas &atlas, const std::string &path) {
+	SkeletonData *data = readSkeletonData(atlas, path);
+	if (!data) return;
+	{
+		Skeleton normal(data), compact(data, true);
+		CHECK(!normal.isCompactPose() && compact.isCompactPose());
+		Vector<Bone *> &bones = compact.getBones();
+		for (size_t i = 0; i < bones.size(); i++)
+			CHECK_MSG(bones[i] == bones[0] + i, "%s: compact bone %d is not in the block", path.c_str(), (int) i);
+
+		AnimationStateData stateData(data);
+		stateData.setDefaultMix(0.2f);
+		AnimationState normalState(&stateData), compactState(&stateData);
+		queueAnimations(normalState, *data);
+		queueAnimations(compactState, *data);
+		Vector<Skin *> &skins = data->getSkins();
+		int mismatches = 0, cacheMismatches = 0;
+		for (int frame = 0; frame < 600; frame++) {
+			if (frame % 100 == 50 && skins.size() > 1) {
+				Skin *skin = skins[(frame / 100 + 1) % skins.size()];
+				Skeleton *skeletons[] = {&normal, &compact};
+				for (int s = 0; s < 2; s++) {
+					skeletons[s]->setSkin(skin);
+					skeletons[s]->setSlotsToSetupPose();
+					skeletons[s]->updateCache();
+				}
+			}
+			// Moves the skeletons too, so root dependent world transforms are recomputed.
+			normal.setX(frame % 200 < 100 ? 0.0f : 10.0f);
+			compact.setX(normal.getX());
+			advance(normalState, normal, 1 / 30.0f);
+			advance(compactState, compact, 1 / 30.0f);
+
+			const Vector<Updatable *> &normalCache = normal.getUpdateCacheList(), &compactCache = compact.getUpdateCacheList();
+			if (normalCache.size() != compactCache.size()) cacheMismatches++;
+			else
+				for (size_t i = 0; i < normalCache.size(); i++)
+					if (cacheIndex(normal, normalCache[i]) != cacheIndex(compact, compactCache[i])) cacheMismatches++;
+			for (size_t i = 0; i < bones.size(); i++) {
+				if (sameWorld(*normal.getBones()[i], *bones[i])) continue;
+				if (!mismatches)
+					fprintf(stderr, "%s: bone %s differs, frame %d\n", path.c_str(), bones[i]->getData().getName().buffer(), frame);
+				mismatches++;
+			}
+		}
+		CHECK_MSG(mismatches == 0, "%s: %d compact bone world transforms differ", path.c_str(), mismatches);
+		CHECK_MSG(cacheMismatches == 0, "%s: %d update cache entries differ", path.c_str(), cacheMismatches);
+	}
+	delete data;
+}
+
+// Two leaf bones are made skin required, each by its own skin, so switching skins keeps the update cache size but swaps a bone.
+static void testSkinSwitch(Atlas &atlas, const std::string &path) {
+	SkeletonData *data = readSkeletonData(atlas, path);
+	if (!data) return;
+	BoneData *leaves[2] = {NULL, NULL};
+	Vector<BoneData *> &boneData = data->getBones();
+	for (size_t i = boneData.size(); i-- > 1 && !leaves[1];) {
+		bool leaf = true;
+		for (size_t ii = i + 1; ii < boneData.size() && leaf; ii++)
+			if (boneData[ii]->getParent() == boneData[i]) leaf = false;
+		if (leaf) leaves[leaves[0] ? 1 : 0] = boneData[i];
+	}
+	Skin first("first"), second("second");
+	first.getBones().add(leaves[0]);
+	second.getBones().add(leaves[1]);
+	leaves[0]->setSkinRequired(true);
+	leaves[1]->setSkinRequired(true);
+	{
+		Skeleton skeleton(data), expected(data);
+		skeleton.setSkin(&first);
+		skeleton.updateCache();
+		skeleton.updateWorldTransform(Physics_None);
+		size_t cacheSize = skeleton.getUpdateCacheList().size();
+
+		skeleton.setSkin(&second);
+		skeleton.updateCache();
+		CHECK(skeleton.getUpdateCacheList().size() == cacheSize);
+		skeleton.setToSetupPose();
+		skeleton.updateWorldTransform(Physics_None);
+
+		expected.setSkin(&second);
+		expected.updateCache();
+		expected.setToSetupPose();
+		expected.updateWorldTransform(Physics_None);
+		// Bones deactivated by the switch keep their last world transform.
+		for (size_t i = 0; i < boneData.size(); i++)
+			if (expected.getBones()[i]->isActive())
+				CHECK_MSG(sameWorld(*skeleton.getBones()[i], *expected.getBones()[i]), "%s: bone %s after the skin switch",
+						  path.c_str(), boneData[i]->getName().buffer());
+	}
+	delete data;
+}
+
+enum Scenario {
+	Scenario_Playing,
+	Scenario_Idle,
+	Scenario_Additive,
+	Scenario_Moved,
+	Scenario_Count
+};
+
+static const char *scenarioNames[] = {"playing", "idle", "additive", "moved"};
+
+// Marks every bone dirty through the public API, so the next updateWorldTransform() recomputes all of them.
+static void forceFullUpdate(Skeleton &skeleton) {
+	Vector<Bone *> &bones = skeleton.getBones();
+	for (size_t i = 0; i < bones.size(); i++)
+		bones[i]->setA(bones[i]->getA());
+}
+
+static size_t cacheBoneCount(Skeleton &skeleton) {
+	const Vector<Updatable *> &cache = skeleton.getUpdateCacheList();
+	size_t count = 0;
+	for (size_t i = 0; i < cache.size(); i++)
+		if (cache[i]->getRTTI().isExactly(Bone::rtti)) count++;
+	return count;
+}
+
+static int compareWorld(Skeleton &expected, Skeleton &actual) {
+	int mismatches = 0;
+	for (size_t i = 0; i < expected.getBones().size(); i++)
+		if (!sameWorld(*expected.getBones()[i], *actual.getBones()[i])) mismatches++;
+	return mismatches;
+}
+
+static void step(AnimationState *state, Skeleton &skeleton, float delta, bool force) {
+	if (state) {
+		state->update(delta);
+		state->apply(skeleton);
+	}
+	skeleton.update(delta);
+	if (force) forceFullUpdate(skeleton);
+	skeleton.updateWorldTransform(Physics_Update);
+}
+
+static void testSkipping(SkeletonData *data, const std::string &path, Scenario scenario) {
+	Skeleton skipping(data), forced(data);
+	AnimationStateData stateData(data);
+	stateData.setDefaultMix(0.2f);
+	AnimationState skippingState(&stateData), forcedState(&stateData);
+	queueAnimations(skippingState, *data);
+	queueAnimations(forcedState, *data);
+	Vector<Animation *> &animations = data->getAnimations();
+	if (scenario == Scenario_Additive && animations.size() > 1) {
+		AnimationState *states[] = {&skippingState, &forcedState};
+		for (int s = 0; s < 2; s++) {
+			TrackEntry *entry = states[s]->setAnimation(1, animations[animations.size() - 1], true);
+			entry->setMixBlend(MixBlend_Add);
+			entry->setAlpha(0.5f);
+		}
+	}
+	int mismatches = 0, countErrors = 0;
+	size_t skippingCount = 0, forcedCount = 0;
+	for (int frame = 0; frame < 300; frame++) {
+		if (scenario == Scenario_Moved && frame % 20 == 10) {
+			Skeleton *skeletons[] = {&skipping, &forced};
+			for (int s = 0; s < 2; s++) {
+				skeletons[s]->setPosition((float) (frame % 7), (float) -(frame % 5));
+				skeletons[s]->setScaleX(frame % 40 == 10 ? -1.0f : 1.0f);
+				skeletons[s]->setScaleY(frame % 60 == 10 ? 0.5f : 1.0f);
+			}
+		}
+		bool animate = scenario != Scenario_Idle || frame < 30;
+		step(animate ? &skippingState : NULL, skipping, 1 / 30.0f, false);
+		step(animate ? &forcedState : NULL, forced, 1 / 30.0f, true);
+		int frameMismatches = compareWorld(forced, skipping);
+		if (frameMismatches && !mismatches)
+			fprintf(stderr, "%s, %s: %d bones differ, frame %d\n", path.c_str(), scenarioNames[scenario], frameMismatches, frame);
+		mismatches += frameMismatches;
+		if (forced.getUpdatedBoneCount() != cacheBoneCount(forced)) countErrors++;
+		if (skipping.getUpdatedBoneCount() > forced.getUpdatedBoneCount()) countErrors++;
+		if (frame >= 30) {
+			skippingCount += skipping.getUpdatedBoneCount();
+			forcedCount += forced.getUpdatedBoneCount();
+		}
+	}
+	CHECK_MSG(mismatches == 0, "%s, %s: %d bone world transforms differ", path.c_str(), scenarioNames[scenario], mismatches);
+	CHECK_MSG(countErrors == 0, "%s, %s: %d frames with a wrong updated bone count", path.c_str(), scenarioNames[scenario],
+			  countErrors);
+	if (scenario != Scenario_Idle) return;
+	// Idle rigs only recompute constrained bones and their children.
+	CHECK_MSG(skippingCount < forcedCount, "%s, idle: every bone recomputed", path.c_str());
+	printf("%-40s idle: %.1f of %.1f bones recomputed\n", path.c_str(), skippingCount / 270.0f, forcedCount / 270.0f);
+}
+
+// Two instances with different animations are posed in turn through one shared skeleton, so every load replaces the pose
+// the world transforms were computed from. Each must match its own skeleton forced to a full update.
+static void testInstanceSkipping(SkeletonData *data, const std::string &path) {
+	Vector<Animation *> &animations = data->getAnimations();
+	if (animations.size() == 0) return;
+	Skeleton shared(data), forced0(data), forced1(data);
+	SkeletonInstance instance0(data), instance1(data);
+	SkeletonInstance *instances[] = {&instance0, &instance1};
+	Skeleton *forced[] = {&forced0, &forced1};
+	Animation *played[] = {animations[0], animations[animations.size() - 1]};
+	int mismatches = 0;
+	float delta = 1 / 30.0f;
+	for (int frame = 0; frame < 200; frame++) {
+		for (int i = 0; i < 2; i++) {
+			float last = frame * delta, time = (frame + 1) * delta;
+			instances[i]->load(shared);
+			played[i]->apply(shared, last, time, true, NULL, 1, MixBlend_Replace, MixDirection_In);
+			shared.update(delta);
+			shared.updateWorldTransform(Physics_Update);
+			instances[i]->store(shared);
+
+			played[i]->apply(*forced[i], last, time, true, NULL, 1, MixBlend_Replace, MixDirection_In);
+			forced[i]->update(delta);
+			forceFullUpdate(*forced[i]);
+			forced[i]->updateWorldTransform(Physics_Update);
+			int frameMismatches = compareWorld(*forced[i], shared);
+			if (frameMismatches && !mismatches)
+				fprintf(stderr, "%s, instance %d: %d bones differ, frame %d\n", path.c_str(), i, frameMismatches, frame);
+			mismatches += frameMismatches;
+		}
+	}
+	CHECK_MSG(mismatches == 0, "%s, instances: %d bone world transforms differ", path.c_str(), mismatches);
+}
+
+int main() {
+	TestTextureLoader textureLoader;
+	for (size_t r = 0; r < testRigCount; r++) {
+		Atlas atlas(assetPath(testRigs[r].atlas).c_str(), &textureLoader);
+		testCompactPose(atlas, assetPath(testRigs[r].skeleton));
+	}
+	for (size_t r = 0; r < testRigCount; r++) {
+		Atlas atlas(assetPath(testRigs[r].atlas).c_str(), &textureLoader);
+		std::string path = assetPath(testRigs[r].skeleton);
+		SkeletonData *data = readSkeletonData(atlas, path);
+		if (!data) continue;
+		for (int scenario = 0; scenario < Scenario_Count; scenario++)
+			testSkipping(data, path, (Scenario) scenario);
+		testInstanceSkipping(data, path);
+		delete data;
+	}
+	Atlas atlas(assetPath(testRigs[9].atlas).c_str(), &textureLoader);
+	testSkinSwitch(atlas, assetPath(testRigs[9].skeleton));
+	return testResult();
+}
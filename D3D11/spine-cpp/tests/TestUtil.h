@@ -0,0 +1,140 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated April 5, 2025. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2025, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_TestUtil_h
+#define Spine_TestUtil_h
+
+#include <spine/spine.h>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+// Minimal test helpers: CHECK() reports a failure and continues, tests return testResult() from main().
+static int testFailures = 0;
+
+#define CHECK(condition) \
+	do { \
+		if (!(condition)) { \
+			testFailures++; \
+			fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+		} \
+	} while (0)
+
+#define CHECK_MSG(condition, ...) \
+	do { \
+		if (!(condition)) { \
+			testFailures++; \
+			fprintf(stderr, "%s:%d: check failed: %s: ", __FILE__, __LINE__, #condition); \
+			fprintf(stderr, __VA_ARGS__); \
+			fprintf(stderr, "\n"); \
+		} \
+	} while (0)
+
+inline int testResult() {
+	if (testFailures) fprintf(stderr, "%d check(s) failed\n", testFailures);
+	return testFailures ? 1 : 0;
+}
+
+// SPINE_TEST_ASSETS is set by the build to the sample assets directory.
+inline std::string assetPath(const char *path) {
+	return std::string(SPINE_TEST_ASSETS) + "/" + path;
+}
+
+struct TestRig {
+	const char *atlas;
+	const char *skeleton;
+	const char *json;
+};
+
+// The sample rigs with their binary and, where exported, JSON skeleton data.
+static const TestRig testRigs[] = {
+		{"celestial-circus/celestial-circus.atlas", "celestial-circus/celestial-circus.skel", NULL},
+		{"chibi-stickers/chibi-stickers.atlas", "chibi-stickers/chibi-stickers.skel", "chibi-stickers/chibi-stickers.json"},
+		{"cloud-pot/cloud-pot.atlas", "cloud-pot/cloud-pot.skel", NULL},
+		{"coin-pro/coin-pma.atlas", "coin-pro/coin-pro.skel", "coin-pro/coin-pro.json"},
+		{"dragon/dragon-pma.atlas", "dragon/dragon-ess.skel", NULL},
+		{"goblins/goblins-pma.atlas", "goblins/goblins-pro.skel", "goblins/goblins-pro.json"},
+		{"owl-pma/owl-pma.atlas", "owl-pma/owl-pro.skel", "owl-pma/owl-pro.json"},
+		{"raptor/raptor-pma.atlas", "raptor/raptor-pro.skel", "raptor/raptor-pro.json"},
+		{"snowglobe/snowglobe-pma.atlas", "snowglobe/snowglobe-pro.skel", "snowglobe/snowglobe-pro.json"},
+		{"spineboy-pma/spineboy-pma.atlas", "spineboy-pma/spineboy-pro.skel", "spineboy-pma/spineboy-pro.json"},
+		{"stretchyman-pma/stretchyman-pma.atlas", "stretchyman-pma/stretchyman-pro.skel", "stretchyman-pma/stretchyman-pro.json"},
+		{"vine-pma/vine-pma.atlas", "vine-pma/vine-pro.skel", "vine-pma/vine-pro.json"},
+};
+
+static const size_t testRigCount = sizeof(testRigs) / sizeof(testRigs[0]);
+
+// Gives every page a distinct fake texture so commands can be checked against their page.
+class TestTextureLoader : public spine::TextureLoader {
+public:
+	void load(spine::AtlasPage &page, const spine::String &path) {
+		SP_UNUSED(path);
+		page.texture = (void *) (uintptr_t) (0x1000 + page.index);
+		page.width = 1024;
+		page.height = 1024;
+	}
+
+	void unload(void *texture) {
+		SP_UNUSED(texture);
+	}
+};
+
+inline spine::SkeletonData *readSkeletonData(spine::Atlas &atlas, const std::string &path) {
+	spine::SkeletonData *data;
+	if (path.size() > 5 && path.compare(path.size() - 5, 5, ".json") == 0) {
+		spine::SkeletonJson json(&atlas);
+		data = json.readSkeletonDataFile(path.c_str());
+		CHECK_MSG(data, "%s: %s", path.c_str(), json.getError().buffer());
+	} else {
+		spine::SkeletonBinary binary(&atlas);
+		data = binary.readSkeletonDataFile(path.c_str());
+		CHECK_MSG(data, "%s: %s", path.c_str(), binary.getError().buffer());
+	}
+	return data;
+}
+
+// Plays every animation of the data in a queue, so a run covers all of them.
+inline void queueAnimations(spine::AnimationState &state, spine::SkeletonData &data) {
+	spine::Vector<spine::Animation *> &animations = data.getAnimations();
+	for (size_t i = 0; i < animations.size(); i++) {
+		if (i == 0)
+			state.setAnimation(0, animations[i], true);
+		else
+			state.addAnimation(0, animations[i], false, 0.5f);
+	}
+}
+
+inline void advance(spine::AnimationState &state, spine::Skeleton &skeleton, float delta) {
+	state.update(delta);
+	state.apply(skeleton);
+	skeleton.update(delta);
+	skeleton.updateWorldTransform(spine::Physics_Update);
+}
+
+#endif /* Spine_TestUtil_h */
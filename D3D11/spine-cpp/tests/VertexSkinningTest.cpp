@@ -0,0 +1,191 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated April 5, 2025. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2025, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+// VertexSkinning: every sample rig is played and the world vertices of each weighted attachment are computed with every
+// kernel the CPU supports, whole, from the second batch on and interleaved with a stride. They must be bit identical to the
+// scalar loop. Replacing an attachment's bones or vertices with same sized arrays must not leave a stale layout, and the bone
+// matrix snapshot must only be refreshed once a weighted attachment needs it.
+
+#include "TestUtil.h"
+#include <vector>
+
+using namespace spine;
+
+namespace spine {
+	SpineExtension *getDefaultExtension() {
+		static DefaultSpineExtension extension;
+		return &extension;
+	}
+}
+
+static const int stride = 5;
+
+// Computes the world vertices with the kernel: whole with stride 2, from the second batch on and whole with a stride.
+static std::vector<float> skin(SkinningKernel kernel, Slot &slot, VertexAttachment &attachment) {
+	VertexSkinning::setKernel(kernel);
+	size_t length = attachment.getWorldVerticesLength();
+	size_t start = SkinningLayout::BatchSize * 2;
+	std::vector<float> out(length * 2 + length / 2 * stride + 2, 0);
+	attachment.computeWorldVertices(slot, 0, length, out.data(), 0, 2);
+	if (length > start) attachment.computeWorldVertices(slot, start, length - start, out.data(), length, 2);
+	attachment.computeWorldVertices(slot, 0, length, out.data(), length * 2, stride);
+	return out;
+}
+
+static bool weighted(Attachment *attachment) {
+	return attachment && attachment->getRTTI().instanceOf(VertexAttachment::rtti) &&
+		   static_cast<VertexAttachment *>(attachment)->getBones().size() > 0;
+}
+
+static void testRig(Atlas &atlas, const std::string &path) {
+	SkeletonData *data = readSkeletonData(atlas, path);
+	if (!data) return;
+	SkinningKernel supported = VertexSkinning::getSupportedKernel();
+	{
+		Skeleton skeleton(data);
+		AnimationStateData stateData(data);
+		stateData.setDefaultMix(0.2f);
+		AnimationState state(&stateData);
+		queueAnimations(state, *data);
+		int mismatches = 0, snapshotErrors = 0, attachments = 0;
+		for (int frame = 0; frame < 300; frame++) {
+			advance(state, skeleton, 1 / 30.0f);
+			if (skeleton.getBoneMatrices().isValid()) snapshotErrors++;
+			Vector<Slot *> &slots = skeleton.getDrawOrder();
+			for (size_t i = 0; i < slots.size(); i++) {
+				Slot &slot = *slots[i];
+				if (!weighted(slot.getAttachment())) continue;
+				VertexAttachment &attachment = *static_cast<VertexAttachment *>(slot.getAttachment());
+				attachments++;
+				std::vector<float> expected = skin(SkinningKernel_Scalar, slot, attachment);
+				for (int kernel = SkinningKernel_Scalar + 1; kernel <= supported; kernel++) {
+					if (skin((SkinningKernel) kernel, slot, attachment) != expected) {
+						if (!mismatches)
+							fprintf(stderr, "%s: kernel %d differs on %s, frame %d\n", path.c_str(), kernel,
+									attachment.getName().buffer(), frame);
+						mismatches++;
+					}
+					if (!skeleton.getBoneMatrices().isValid()) snapshotErrors++;
+				}
+			}
+		}
+		CHECK_MSG(mismatches == 0, "%s: %d attachment frames differ from the scalar loop", path.c_str(), mismatches);
+		CHECK_MSG(snapshotErrors == 0, "%s: bone matrices refreshed eagerly or not at all %d times", path.c_str(),
+				  snapshotErrors);
+		printf("%-40s %d weighted attachment frames\n", path.c_str(), attachments);
+	}
+	delete data;
+}
+
+// Replaces the bones and vertices of a weighted mesh with same sized arrays, through the setters and in place.
+static void testReplace(Atlas &atlas, const std::string &path) {
+	SkeletonData *data = readSkeletonData(atlas, path);
+	if (!data) return;
+	SkinningKernel supported = VertexSkinning::getSupportedKernel();
+	{
+		Skeleton skeleton(data);
+		skeleton.setToSetupPose();
+		skeleton.updateWorldTransform(Physics_None);
+		Slot *slot = NULL;
+		for (size_t i = 0; i < skeleton.getSlots().size() && !slot; i++)
+			if (weighted(skeleton.getSlots()[i]->getAttachment())) slot = skeleton.getSlots()[i];
+		CHECK_MSG(slot, "%s has no weighted attachment", path.c_str());
+		if (!slot) {
+			delete data;
+			return;
+		}
+		VertexAttachment &attachment = *static_cast<VertexAttachment *>(slot->getAttachment());
+		int boneCount = (int) skeleton.getBones().size();
+
+		// Other weights and offsets.
+		Vector<float> vertices;
+		vertices.addAll(attachment.getVertices());
+		for (size_t i = 0; i < vertices.size(); i++)
+			vertices[i] = i % 3 == 2 ? 1 - vertices[i] : vertices[i] * 1.5f + 3;
+		attachment.setVertices(vertices);
+		std::vector<float> expected = skin(SkinningKernel_Scalar, *slot, attachment);
+		for (int kernel = SkinningKernel_Scalar + 1; kernel <= supported; kernel++)
+			CHECK_MSG(skin((SkinningKernel) kernel, *slot, attachment) == expected, "%s: setVertices, kernel %d", path.c_str(),
+					  kernel);
+
+		// Other bones, same influence counts.
+		Vector<int> bones;
+		bones.addAll(attachment.getBones());
+		for (size_t v = 0; v < bones.size(); v += bones[v] + 1)
+			for (int i = 1; i <= bones[v]; i++)
+				bones[v + i] = (bones[v + i] + 1) % boneCount;
+		attachment.setBones(bones);
+		expected = skin(SkinningKernel_Scalar, *slot, attachment);
+		for (int kernel = SkinningKernel_Scalar + 1; kernel <= supported; kernel++)
+			CHECK_MSG(skin((SkinningKernel) kernel, *slot, attachment) == expected, "%s: setBones, kernel %d", path.c_str(),
+					  kernel);
+
+		// In place, then updateSkinningLayout().
+		Vector<float> &inPlace = attachment.getVertices();
+		for (size_t i = 0; i < inPlace.size(); i++)
+			if (i % 3 != 2) inPlace[i] = -inPlace[i];
+		attachment.updateSkinningLayout();
+		expected = skin(SkinningKernel_Scalar, *slot, attachment);
+		for (int kernel = SkinningKernel_Scalar + 1; kernel <= supported; kernel++)
+			CHECK_MSG(skin((SkinningKernel) kernel, *slot, attachment) == expected, "%s: in place, kernel %d", path.c_str(),
+					  kernel);
+
+		// Bones not matching the vertices, until both are set, leave no layout.
+		Vector<int> single;
+		single.add(1);
+		single.add(0);
+		attachment.setBones(single);
+		CHECK(attachment.getSkinningLayout().getVertexCount() == 0);
+		Vector<float> singleVertices;
+		singleVertices.add(10);
+		singleVertices.add(20);
+		singleVertices.add(1);
+		attachment.setVertices(singleVertices);
+		attachment.setWorldVerticesLength(2);
+		CHECK(supported == SkinningKernel_Scalar || attachment.getSkinningLayout().getVertexCount() == 1);
+		expected = skin(SkinningKernel_Scalar, *slot, attachment);
+		for (int kernel = SkinningKernel_Scalar + 1; kernel <= supported; kernel++)
+			CHECK_MSG(skin((SkinningKernel) kernel, *slot, attachment) == expected, "%s: single vertex, kernel %d", path.c_str(),
+					  kernel);
+	}
+	delete data;
+}
+
+int main() {
+	printf("supported skinning kernel: %d\n", (int) VertexSkinning::getSupportedKernel());
+	TestTextureLoader textureLoader;
+	for (size_t r = 0; r < testRigCount; r++) {
+		Atlas atlas(assetPath(testRigs[r].atlas).c_str(), &textureLoader);
+		testRig(atlas, assetPath(testRigs[r].skeleton));
+	}
+	Atlas atlas(assetPath(testRigs[7].atlas).c_str(), &textureLoader);
+	testReplace(atlas, assetPath(testRigs[7].skeleton));
+	VertexSkinning::setKernel(VertexSkinning::getSupportedKernel());
+	return testResult();
+}